@@ -1,6 +1,7 @@
 #!/usr/bin/env python3
 
 import os
+import json
 import shutil
 import filecmp
 import textwrap
@@ -25,11 +26,14 @@ class TestResult(Enum):
 
 
 class Test():
-    def __init__(self, name: str, rom: str, code: str, screenshot: str, skip: bool = False):
+    def __init__(self, name: str, rom: str, frames: int, screenshot: str, skip: bool = False, **kwargs):
         self.name = name
 
         self.rom = rom
-        self.code = textwrap.dedent(code)
+        self.code = textwrap.dedent(f'''
+            frame {frames}
+            screenshot ./.tests_screenshots/{screenshot}
+        ''')
         self.screenshot = screenshot
         self.skip = skip
 
@@ -50,9 +54,12 @@ class Test():
             raise RuntimeError("The screenshot taken during the test doesn't match the expected one.")
 
 
-def main():
-    from suite import TESTS_SUITE
+def load_suite(path: Path):
+    with open(path, 'r', encoding='utf-8') as file:
+        return [Test(**test) for test in json.load(file)['tests']]
+
 
+def main():
     exit_code = 0
 
     parser = argparse.ArgumentParser(
@@ -81,8 +88,17 @@ def main():
         help="Show subcommands output",
     )
 
+    parser.add_argument(
+        '--suite',
+        nargs='?',
+        default=Path(os.path.realpath(__file__)).parent / 'suite.json',
+        help="Path to the test suite",
+    )
+
     args = parser.parse_args()
 
+    tests_suite = load_suite(Path(args.suite))
+
     hades_binary = Path(os.getcwd()) / args.binary
     rom_directory = Path(os.getcwd()) / args.roms
 
@@ -118,7 +134,7 @@ def main():
     print(f"┃ {'Name':30s} ┃ Res. ┃")
     print(f"┣━{'━' * 30}━╋━━━━━━┫")
 
-    for test in TESTS_SUITE:
+    for test in tests_suite:
         result = TestResult.FAIL
 
         try:
@@ -0,0 +1,69 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include <stdatomic.h>
+#include "hades.h"
+
+enum accuracy_results {
+    ACCURACY_PASS = 0,
+    ACCURACY_SKIP,
+    ACCURACY_FAIL,
+};
+
+/*
+** A test of the suite: the ROM is run for the given number of frames, and the hash of the
+** last frame must match the expected one.
+*/
+struct accuracy_test {
+    char *name;
+    char *rom;
+    char *screenshot;               // The name of the PNG written if the test fails
+    uint64_t frames;
+    uint64_t hash;                  // The hash of the expected frame, see `accuracy_hash_framebuffer()`
+    bool skip;
+
+    // Filled by the worker that ran the test
+    enum accuracy_results result;
+    uint64_t actual_hash;
+    char *error;
+};
+
+struct accuracy {
+    struct {
+        char const *suite_path;
+        char const *roms_dir;
+        char const *bios_path;
+        char const *output_dir;
+        size_t jobs;                // 0 to use one worker per core
+        bool verbose;
+    } args;
+
+    // The BIOS, shared by all the workers
+    uint8_t *bios;
+    size_t bios_size;
+
+    struct accuracy_test *tests;
+    size_t tests_len;
+
+    // The tests in the order they are run, the longest first so they don't end up
+    // running alone at the end.
+    struct accuracy_test **queue;
+
+    // The index in `queue` of the next test to run
+    atomic_size_t next;
+};
+
+/* accuracy/args.c */
+void accuracy_args_parse(struct accuracy *accuracy, int argc, char * const argv[]);
+
+/* accuracy/suite.c */
+bool accuracy_suite_load(struct accuracy *accuracy);
+void accuracy_suite_free(struct accuracy *accuracy);
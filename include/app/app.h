@@ -26,9 +26,33 @@
 #define MAX_QUICKSAVES              5
 #define POWER_SAVE_FRAME_DELAY      30
 #define MAX_GFX_PROGRAMS            10
+#define MAX_IO_WORKERS              2
 
 struct ImGuiIO;
 
+enum io_job_kind {
+    IO_JOB_SCREENSHOT,
+    IO_JOB_QUICKSAVE,
+    IO_JOB_QUICKLOAD,
+};
+
+/*
+** A file to read or write in the background by the I/O workers.
+**
+** The data is owned by the job: it is a copy of the framebuffer for a screenshot,
+** the content of the save state for a quicksave, and is filled by the worker for
+** a quickload.
+*/
+struct io_job {
+    enum io_job_kind kind;
+    char *path;
+    void *data;
+    size_t size;
+    int err;                    // The `errno` of the failure, 0 on success.
+    struct io_job *next;
+};
+
+
 enum texture_filter_kind {
     TEXTURE_FILTER_MIN = 0,
 
@@ -120,6 +144,29 @@ struct app {
 
         FILE *backup_file;
 
+        // Writes the backup storage on the disk in the background
+        struct backup_writer {
+            pthread_t thread;
+            pthread_mutex_t lock;
+            pthread_cond_t ready;
+            bool running;
+            bool flush;
+            bool exit;
+        } backup_writer;
+
+        // Encodes the screenshots and reads/writes the save states in the background
+        struct io_pool {
+            pthread_t threads[MAX_IO_WORKERS];
+            pthread_mutex_t lock;
+            pthread_cond_t ready;   // A job was queued or the workers must exit
+            pthread_cond_t idle;    // A job is done
+            struct io_job *pending;
+            struct io_job *running;
+            struct io_job *done;
+            bool started;
+            bool exit;
+        } io;
+
         bool is_started;
         bool is_running;
 
@@ -133,6 +180,9 @@ struct app {
         // Skip BIOS
         bool skip_bios;
 
+        // Run the hottest BIOS calls natively
+        bool hle_bios;
+
         // Backup storage
         struct {
             bool autodetect;
@@ -197,6 +247,7 @@ struct app {
     struct {
         char *sys_pictures_dir_path;
         char *sys_config_path;
+        char *sys_cache_dir_path;
 
         char *bios_path;
         char *recent_roms[MAX_RECENT_ROMS];
@@ -220,6 +271,7 @@ struct app {
 
     struct {
         bool mute;
+        bool sync;
         float level;
         uint32_t resample_frequency;
     } audio;
@@ -388,6 +440,7 @@ void app_emulator_exit(struct app *app);
 void app_emulator_key(struct app *app, enum keys key, bool pressed);
 void app_emulator_speed(struct app *app, uint32_t);
 void app_emulator_update_backup(struct app *app);
+void app_emulator_close_backup(struct app *app);
 void app_emulator_screenshot(struct app *app);
 void app_emulator_screenshot_path(struct app *app, char const *);
 void app_emulator_quicksave(struct app *app, size_t idx);
@@ -397,6 +450,7 @@ void app_emulator_quickload(struct app *app, size_t idx);
 
 void app_emulator_frame(struct app *app, size_t);
 void app_emulator_trace(struct app *app, size_t, void (*)(struct app *));
+void app_emulator_trace_binary(struct app *app, size_t, struct trace_ring *ring, bool mem);
 void app_emulator_step_in(struct app *app, size_t cnt);
 void app_emulator_step_over(struct app *app, size_t cnt);
 void app_emulator_set_breakpoints_list(struct app *app, struct breakpoint *breakpoints, size_t len);
@@ -404,7 +458,15 @@ void app_emulator_set_watchpoints_list(struct app *app, struct watchpoint *watch
 
 #endif
 
+/* io.c */
+void app_io_start(struct app *app);
+void app_io_push(struct app *app, enum io_job_kind kind, char const *path, void *data, size_t size);
+void app_io_wait(struct app *app);
+void app_io_process_done(struct app *app);
+void app_io_close(struct app *app);
+
 /* path.c */
 void app_paths_update(struct app *app);
 char const *app_path_config(struct app *app);
 char const *app_path_screenshots(struct app *app);
+char const *app_path_rom_cache(struct app *app);
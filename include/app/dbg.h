@@ -90,18 +90,27 @@ static char const * const cond_suffix[] = {
 enum args_type {
     ARGS_INTEGER,
     ARGS_STRING,
+    ARGS_CONDITION,
 };
 
 static char const * const args_type_names[] = {
     [ARGS_INTEGER] = "integer",
     [ARGS_STRING] = "string",
+    [ARGS_CONDITION] = "condition",
 };
 
+/*
+** An argument of a command.
+**
+** The expression following the keyword `if` isn't evaluated but compiled into a condition,
+** which replaces both of them in the arguments.
+*/
 struct arg {
     enum args_type type;
     union {
         uint64_t i64;
         char const *s;
+        struct condition cond;
     } value;
 };
 
@@ -136,6 +145,7 @@ enum commands_list {
     CMD_IO,
     CMD_KEY,
     CMD_SCREENSHOT,
+    CMD_LOG,
 };
 
 struct io_bitfield {
@@ -201,6 +211,9 @@ void debugger_cmd_io(struct app *, size_t, struct arg const *);
 /* app/dbg/cmd/key.c */
 void debugger_cmd_key(struct app *, size_t, struct arg const *);
 
+/* app/dbg/cmd/log.c */
+void debugger_cmd_log(struct app *, size_t, struct arg const *);
+
 /* app/dbg/cmd/print.c */
 void debugger_cmd_print(struct app *, size_t, struct arg const *);
 void debugger_cmd_print_u8(struct app const *, uint32_t, size_t, size_t);
@@ -41,6 +41,14 @@ enum operator {
     OP_BINARY_SUB,
     OP_BINARY_MUL,
     OP_BINARY_DIV,
+    OP_BINARY_EQ,
+    OP_BINARY_NE,
+    OP_BINARY_LT,
+    OP_BINARY_LE,
+    OP_BINARY_GT,
+    OP_BINARY_GE,
+    OP_BINARY_AND,
+    OP_BINARY_OR,
     _OP_BINARY_END_,
 };
 
@@ -53,6 +61,8 @@ struct token {
         TOKEN_IDENTIFIER,
         TOKEN_OPEN_PARENTHESIS,
         TOKEN_CLOSE_PARENTHESIS,
+        TOKEN_OPEN_BRACKET,
+        TOKEN_CLOSE_BRACKET,
         TOKEN_OPERATOR,
     } kind;
 
@@ -78,6 +88,7 @@ struct node {
         NODE_OP_UNARY,
         NODE_OP_BINARY,
         NODE_VARIABLE,
+        NODE_DEREF,
     } kind;
 
     union {
@@ -87,7 +98,7 @@ struct node {
     } value;
 
     struct node *lhs;  // For binary operators only
-    struct node *rhs;  // For unary and binary operators only
+    struct node *rhs;  // For unary and binary operators and dereferences only
 };
 
 struct ast {
@@ -102,6 +113,10 @@ struct eval {
 };
 
 struct app;
+struct condition;
+
+/* debugger/lang/compile.c */
+void debugger_lang_compile(struct eval *eval, struct app *app, struct ast const *ast, struct condition *cond);
 
 /* debugger/lang/eval.c */
 void debugger_lang_eval(struct eval *eval, struct app *app, struct ast const *ast);
@@ -115,6 +130,7 @@ void debugger_lang_parse(struct ast *ast, struct token const *tokens);
 /* debugger/lang/utils.c */
 void debugger_lang_dump_lexer(struct lexer const *lexer);
 void debugger_lang_dump_ast(struct ast const *ast);
+void debugger_lang_cleanup_node(struct node *node);
 void debugger_lang_cleanup(struct lexer *lexer, struct ast *ast, struct eval *eval);
 
 /* debugger/lang/variables.c */
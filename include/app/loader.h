@@ -0,0 +1,22 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include "hades.h"
+
+/*
+** The loader is shared by all the frontends and must not depend on SDL, OpenGL or ImGui.
+**
+** All its functions return `NULL` on success, or an allocated error message that must be freed.
+*/
+
+/* app/loader.c */
+char *app_load_bios(char const *path, uint8_t **data, size_t *size);
+char *app_load_rom(char const *path, char const *cache_dir, uint8_t **data, size_t *size);
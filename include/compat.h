@@ -105,6 +105,36 @@ hs_fexists(
     return (out);
 }
 
+/*
+** Retrieve the modification time and the size of the file at the given path.
+** Return true on error.
+*/
+static inline
+bool
+hs_stat(
+    char const *path,
+    uint64_t *mtime,
+    uint64_t *size
+) {
+    wchar_t *wpath;
+    struct _stat64 stbuf;
+    bool err;
+
+    wpath = hs_convert_to_wchar(path);
+    if (!wpath) {
+        return (true);
+    }
+
+    err = _wstat64(wpath, &stbuf) != 0;
+    if (!err) {
+        *mtime = stbuf.st_mtime;
+        *size = stbuf.st_size;
+    }
+
+    free(wpath);
+    return (err);
+}
+
 static inline
 char *
 hs_fmtime(
@@ -165,6 +195,76 @@ hs_time(void)
     return (time);
 }
 
+/*
+** Write `size` bytes of `data` at the given offset of the file.
+** Return true on error.
+*/
+static inline
+bool
+hs_pwrite(
+    FILE *file,
+    void const *data,
+    size_t size,
+    uint64_t offset
+) {
+    return (_fseeki64(file, offset, SEEK_SET) || fwrite(data, size, 1, file) != 1 || fflush(file));
+}
+
+/*
+** Make sure everything written to the file reached the disk.
+*/
+static inline
+void
+hs_fsync(
+    FILE *file
+) {
+    _commit(_fileno(file));
+}
+
+/*
+** Return a monotonic timestamp, in nanoseconds.
+*/
+static inline
+uint64_t
+hs_time_ns(void)
+{
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return ((uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000ull + (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000ull / frequency.QuadPart);
+}
+
+/*
+** Sleep until the given timestamp, as returned by `hs_time_ns()`.
+*/
+static inline
+void
+hs_sleep_until_ns(
+    uint64_t deadline
+) {
+    uint64_t now;
+
+    now = hs_time_ns();
+    if (now < deadline) {
+        hs_usleep((deadline - now) / 1000);
+    }
+}
+
+/*
+** Return the number of cores of the host.
+*/
+static inline
+size_t
+hs_nproc(void)
+{
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return (max(info.dwNumberOfProcessors, 1u));
+}
+
 static inline
 void
 hs_open_url(
@@ -177,6 +277,7 @@ hs_open_url(
 
 #include <sys/stat.h>
 #include <unistd.h>
+#include <errno.h>
 #include <time.h>
 
 #define hs_isatty(x)            isatty(x)
@@ -206,6 +307,118 @@ hs_time(void)
     return (ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
 }
 
+/*
+** Write `size` bytes of `data` at the given offset of the file.
+** Return true on error.
+*/
+static inline
+bool
+hs_pwrite(
+    FILE *file,
+    void const *data,
+    size_t size,
+    uint64_t offset
+) {
+    while (size) {
+        ssize_t out;
+
+        out = pwrite(fileno(file), data, size, offset);
+        if (out < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (true);
+        }
+
+        data = (uint8_t const *)data + out;
+        size -= out;
+        offset += out;
+    }
+    return (false);
+}
+
+/*
+** Make sure everything written to the file reached the disk.
+*/
+static inline
+void
+hs_fsync(
+    FILE *file
+) {
+#if defined(__APPLE__)
+    fsync(fileno(file));
+#else
+    fdatasync(fileno(file));
+#endif
+}
+
+/*
+** Return a monotonic timestamp, in nanoseconds.
+*/
+static inline
+uint64_t
+hs_time_ns(void)
+{
+    struct timespec ts;
+
+    hs_assert(clock_gettime(CLOCK_MONOTONIC, &ts) == 0);
+    return ((uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec);
+}
+
+/*
+** Sleep until the given timestamp, as returned by `hs_time_ns()`.
+**
+** Sleeping on an absolute deadline doesn't accumulate the latency of the wake-up
+** like a relative sleep would.
+*/
+static inline
+void
+hs_sleep_until_ns(
+    uint64_t deadline
+) {
+    struct timespec ts;
+
+    ts.tv_sec = deadline / 1000000000ull;
+    ts.tv_nsec = deadline % 1000000000ull;
+
+#if defined(__APPLE__)
+    {
+        uint64_t now;
+
+        now = hs_time_ns();
+        if (now < deadline) {
+            ts.tv_sec = (deadline - now) / 1000000000ull;
+            ts.tv_nsec = (deadline - now) % 1000000000ull;
+            while (nanosleep(&ts, &ts) && errno == EINTR);
+        }
+    }
+#else
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR);
+#endif
+}
+
+/*
+** Retrieve the modification time and the size of the file at the given path.
+** Return true on error.
+*/
+static inline
+bool
+hs_stat(
+    char const *path,
+    uint64_t *mtime,
+    uint64_t *size
+) {
+    struct stat stbuf;
+
+    if (stat(path, &stbuf)) {
+        return (true);
+    }
+
+    *mtime = stbuf.st_mtime;
+    *size = stbuf.st_size;
+    return (false);
+}
+
 static inline
 char *
 hs_fmtime(
@@ -227,6 +440,19 @@ hs_fmtime(
     return (out);
 }
 
+/*
+** Return the number of cores of the host.
+*/
+static inline
+size_t
+hs_nproc(void)
+{
+    long nproc;
+
+    nproc = sysconf(_SC_NPROCESSORS_ONLN);
+    return (nproc > 0 ? nproc : 1);
+}
+
 static inline
 void
 hs_open_url(
@@ -100,6 +100,12 @@ struct apu_rbuffer {
     size_t read_idx;
     size_t write_idx;
     size_t size;
+
+    // Each time the buffer runs dry, or is full, only counts once until it recovers.
+    uint64_t underruns;
+    uint64_t overruns;
+    bool starved;
+    bool overflowing;
 };
 
 struct apu {
@@ -11,34 +11,84 @@
 
 #include "hades.h"
 
+/*
+** The number of slots in a channel.
+** Must be a power of two.
+*/
+#define CHANNEL_SLOTS               256
+
+/*
+** The maximum size of an event sent through a channel.
+*/
+#define CHANNEL_EVENT_MAX_SIZE      240
+
 struct event_header {
     int32_t kind;
     size_t size;
 };
 
+/*
+** A slot of the channel's ring buffer.
+**
+** `sequence` tells the state of the slot:
+**   - `sequence == pos`: the slot is free and can be claimed by the producer that reserved position `pos`.
+**   - `sequence == pos + 1`: the slot holds the event pushed at position `pos` and is ready to be consumed.
+*/
+struct channel_slot {
+    atomic_size_t sequence;
+    union {
+        struct event_header header;
+        uint8_t raw[CHANNEL_EVENT_MAX_SIZE];
+    } event;
+};
+
+/*
+** A bounded, lock-free, multi-producers single-consumer channel.
+**
+** Producers never take a lock, unless the consumer is sleeping in `channel_wait()` and needs to be woken up.
+** The consumer side is serialized by `lock`, which is only contended by the consumers.
+*/
 struct channel {
-    struct event_header *events;    // An array of events.
-    size_t length;                  // The number of event in `events`
-    size_t size;                    // The sum of the size of all the events in `events`
-    size_t allocated_size;          // The size of the allocation of `events`
+    _Alignas(64) atomic_size_t tail;        // The next position to be claimed by a producer
+    _Alignas(64) size_t head;               // The next position to be consumed
+    atomic_size_t pending;                  // The number of events ready to be consumed
+    atomic_bool waiting;                    // True if the consumer is sleeping in `channel_wait()`
+    atomic_bool interrupted;                // Set by `channel_interrupt()` to wake up the consumer
 
     pthread_mutex_t lock;
     pthread_cond_t ready;
+
+    struct channel_slot slots[CHANNEL_SLOTS];
 };
 
 struct channels {
     struct channel messages;        // Sent by the frontned to the emulator
     struct channel notifications;   // Sent by the emulator to the frontend
 #ifdef WITH_DEBUGGER
-    struct channel debug;           // Sent by the emulator to the debugger
+    struct channel debug;           // Sent by the emulator to the debugger, dropped when full as the frontend may not have one
 #endif
 };
 
+/*
+** Return the number of events waiting to be consumed.
+**
+** This is cheap enough to be polled by the emulation loop and doesn't require the channel to be locked.
+*/
+static inline
+size_t
+channel_pending(
+    struct channel *channel
+) {
+    return (atomic_load_explicit(&channel->pending, memory_order_relaxed));
+}
+
 /* channel.c */
 void channel_init(struct channel *channel);
 void channel_lock(struct channel *channel);
 void channel_release(struct channel *channel);
 void channel_push(struct channel *channel, struct event_header const *event);
+bool channel_try_push(struct channel *channel, struct event_header const *event);
 void channel_wait(struct channel *channel);
-struct event_header const *channel_next(struct channel const *channel, struct event_header const *event);
-void channel_clear(struct channel *channel);
+void channel_interrupt(struct channel *channel);
+struct event_header const *channel_peek(struct channel *channel);
+void channel_pop(struct channel *channel);
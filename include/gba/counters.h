@@ -0,0 +1,83 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#ifdef WITH_COUNTERS
+
+#include <stdio.h>
+#include "hades.h"
+#include "gba/scheduler.h"
+
+struct gba;
+
+/*
+** Counters of the interpreter, used to find which handlers are worth specializing and
+** where the wait states come from.
+**
+** The cycles of an instruction are counted from its fetch to the end of its handler, so
+** they include the wait states of its memory accesses and of the DMAs it started.
+*/
+struct counter {
+    uint64_t count;
+    uint64_t cycles;
+};
+
+/*
+** The telemetry of the scheduler, for one kind of event.
+**
+** The lateness is how many cycles after its deadline the event was fired, which depends on
+** the granularity of the instructions and of the DMAs running at that time.
+**
+** The host time of the frame limiter includes the time it spends waiting.
+*/
+struct sched_counter {
+    uint64_t added;
+    uint64_t cancelled;
+    uint64_t fired;
+    uint64_t lateness;                  // The sum of the lateness of the fired events, in cycles
+    uint64_t lateness_max;
+    uint64_t time_ns;                   // The host time spent in the callbacks
+};
+
+struct counters {
+    struct counter arm[4096];           // Indexed like `arm_lut`
+    struct counter thumb[256];          // Indexed like `thumb_lut`
+    struct counter arm_cond_failed;     // The ARM instructions skipped because of their condition
+
+    // The memory accesses, indexed by region of the bus and access type (see `enum access_types`)
+    struct counter mem[16][2];
+
+    // The accesses to the game pak that were (or weren't) served by the prefetch buffer
+    uint64_t prefetch_hits;
+    uint64_t prefetch_misses;
+
+    struct sched_counter events[SCHED_EVENT_MAX];
+
+    // If set, called by the frame limiter at the end of each frame
+    void (*frame_cb)(struct gba const *gba, void *arg);
+    void *frame_arg;
+};
+
+static inline
+void
+counter_add(
+    struct counter *counter,
+    uint64_t cycles
+) {
+    ++counter->count;
+    counter->cycles += cycles;
+}
+
+/* gba/counters.c */
+extern char const * const sched_event_names[SCHED_EVENT_MAX];
+void counters_reset(struct gba *gba);
+bool counters_write_csv(struct gba const *gba, FILE *file);
+
+#endif /* WITH_COUNTERS */
@@ -0,0 +1,67 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#ifdef WITH_COVERAGE
+
+#include <stdio.h>
+#include "hades.h"
+#include "gba/memory.h"
+
+/*
+** The code coverage keeps one bit per halfword of the BIOS, EWRAM, IWRAM and ROM, set when
+** an instruction is executed at that address (both halfwords for an ARM instruction).
+**
+** Each of the 16 regions of the bus points to its bitmap, and the regions code can't be executed
+** from share a single byte whose mask is 0, so marking an address is always a single OR.
+*/
+#define COVERAGE_REGIONS        16
+
+// A coverage file is this magic, the CRC32 and the size of the ROM, followed by the bitmaps
+// of the BIOS, EWRAM, IWRAM and ROM (truncated to the size of the ROM).
+#define COVERAGE_FILE_MAGIC     "HSCOV001"
+
+struct coverage {
+    uint8_t *regions[COVERAGE_REGIONS];
+    uint32_t masks[COVERAGE_REGIONS];
+
+    uint8_t bios[BIOS_SIZE / 16];
+    uint8_t ewram[EWRAM_SIZE / 16];
+    uint8_t iwram[IWRAM_SIZE / 16];
+    uint8_t rom[CART_SIZE / 16];
+    uint8_t sink;
+};
+
+/*
+** Mark the instruction at `addr` as executed. `bits` is 0b1 for a Thumb instruction and
+** 0b11 for an ARM one.
+*/
+static inline
+void
+coverage_mark(
+    struct coverage *coverage,
+    uint32_t addr,
+    uint8_t bits
+) {
+    uint32_t region;
+
+    region = (addr >> 24) & (COVERAGE_REGIONS - 1);
+    addr &= coverage->masks[region];
+    coverage->regions[region][addr >> 4] |= bits << ((addr >> 1) & 0x7);
+}
+
+struct gba;
+
+/* gba/coverage.c */
+void coverage_reset(struct gba *gba);
+bool coverage_merge(struct gba *gba, uint8_t const *data, size_t size);
+bool coverage_write(struct gba const *gba, FILE *file);
+
+#endif /* WITH_COVERAGE */
@@ -0,0 +1,56 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include "gba/gba.h"
+
+/*
+** The game database is indexed by a perfect hash of the game code, generated at build
+** time by `source/gba/db/index.c`.
+**
+** The game codes are first spread into buckets, then each bucket is given a seed that
+** sends all of its codes to distinct slots. A lookup costs two hashes and one comparison.
+*/
+#define DB_INDEX_BUCKETS        512
+#define DB_INDEX_SLOTS          2048
+
+/*
+** A revision of a game, identified by the CRC32 of its ROM, whose features differ from the
+** ones of its game code in the database.
+*/
+struct game_revision {
+    uint32_t crc32;
+    char *code;
+    enum backup_storage_types storage;
+    uint64_t flags;
+};
+
+/* source/gba/db/games.c */
+extern struct game_entry const game_database[];
+extern size_t const game_database_len;
+extern struct game_revision const game_revisions[];
+extern size_t const game_revisions_len;
+
+static inline
+uint32_t
+db_index_hash(
+    uint8_t const *code,
+    uint32_t seed
+) {
+    uint32_t hash;
+
+    hash = ((uint32_t)code[0] | ((uint32_t)code[1] << 8) | ((uint32_t)code[2] << 16)) ^ (seed * 0x9E3779B9u);
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35u;
+    hash ^= hash >> 16;
+    return (hash);
+}
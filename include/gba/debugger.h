@@ -34,13 +34,129 @@ enum interrupt_reasons {
     GBA_INTERRUPT_REASON_FRAME_FINISHED,
 };
 
+/*
+** The condition of a breakpoint or a watchpoint, compiled by the debugger from an expression
+** into a small stack-based bytecode that the emulation thread evaluates without pausing.
+**
+** All values are unsigned 32-bit integers, and a condition without any instruction is always true.
+*/
+#define CONDITION_MAX_LEN       32
+#define CONDITION_STACK_LEN     16
+
+enum condition_opcodes {
+    CONDITION_OP_PUSH,          // Push `arg`
+    CONDITION_OP_REG,           // Push the register `arg`
+    CONDITION_OP_LOAD32,        // Replace the top of the stack by the word at that address
+    CONDITION_OP_NEG,
+    CONDITION_OP_ADD,
+    CONDITION_OP_SUB,
+    CONDITION_OP_MUL,
+    CONDITION_OP_DIV,
+    CONDITION_OP_EQ,
+    CONDITION_OP_NE,
+    CONDITION_OP_LT,
+    CONDITION_OP_LE,
+    CONDITION_OP_GT,
+    CONDITION_OP_GE,
+    CONDITION_OP_AND,
+    CONDITION_OP_OR,
+};
+
+struct condition_instr {
+    uint8_t op;
+    uint32_t arg;
+};
+
+struct condition {
+    struct condition_instr code[CONDITION_MAX_LEN];
+    size_t len;
+};
+
 struct breakpoint {
     uint32_t ptr;
+    struct condition cond;
 };
 
+// Marks a free slot of the breakpoints' hash set. The PC is always aligned so it can't match it.
+#define BREAKPOINT_SET_EMPTY    0xFFFFFFFF
+
+/*
+** A watchpoint on the `size` bytes starting at `ptr`.
+**
+** If `match_value` is set, a write watchpoint only triggers when the written value is `value`.
+*/
 struct watchpoint {
     uint32_t ptr;
+    uint32_t size;
     bool write;
+    bool match_value;
+    uint32_t value;
+    struct condition cond;
+};
+
+/*
+** The watchpoints are indexed by pages of 4KiB of the 28-bit address space of the GBA's bus
+** (the higher addresses are folded onto it, which only costs a few false positives).
+*/
+#define WATCHPOINT_PAGE_SHIFT   12
+#define WATCHPOINT_PAGE_COUNT   (1 << (28 - WATCHPOINT_PAGE_SHIFT))
+#define WATCHPOINT_PAGE(addr)   (((addr) >> WATCHPOINT_PAGE_SHIFT) & (WATCHPOINT_PAGE_COUNT - 1))
+
+/*
+** A record of a binary trace.
+**
+** Each traced instruction is described by the memory accesses it did (if enabled, one
+** TRACE_RECORD_MEM record each), followed by its TRACE_RECORD_INSN record, followed by
+** the new values of the registers it changed (see `changed`), packed by groups of
+** TRACE_RECORD_REGS_LEN in TRACE_RECORD_REGS records.
+*/
+enum trace_record_kinds {
+    TRACE_RECORD_INSN,
+    TRACE_RECORD_REGS,
+    TRACE_RECORD_MEM,
+};
+
+#define TRACE_RECORD_REGS_LEN   6
+
+struct trace_record {
+    uint8_t kind;
+    union {
+        struct {
+            uint32_t pc;
+            uint32_t opcode;
+            uint32_t cpsr;
+            uint16_t changed;       // A bitmask of the registers (r0-r14) changed by the instruction
+            uint64_t cycles;        // The value of the scheduler's cycle counter before the instruction
+        } insn;
+
+        uint32_t regs[TRACE_RECORD_REGS_LEN];
+
+        struct {
+            uint32_t addr;
+            uint32_t val;
+            uint8_t size;
+            bool write;
+        } mem;
+    };
+};
+
+static_assert(sizeof(struct trace_record) == 32);
+
+// A binary trace file is this magic followed by the records, the whole being compressed with gzip.
+#define TRACE_FILE_MAGIC        "HSTRACE1"
+
+/*
+** A single-producer single-consumer ring of trace records.
+**
+** The emulation thread waits for some space to be available when the ring is full, so
+** the trace is never truncated.
+*/
+#define TRACE_RING_LEN          (1 << 16)
+
+struct trace_ring {
+    struct trace_record records[TRACE_RING_LEN];
+    atomic_size_t head;     // Only written by the emulation thread
+    atomic_size_t tail;     // Only written by the reader
 };
 
 struct debugger {
@@ -49,21 +165,41 @@ struct debugger {
 
     bool interrupted;
 
+    /*
+    ** The breakpoints are stored in an open-addressing hash set of their addresses, so
+    ** checking the PC after each instruction costs the same no matter how many there are.
+    ** The condition of each slot is kept aside and only looked at when the address matches.
+    **
+    ** `len` is checked first, so nothing else is done while there are no breakpoints.
+    */
     struct {
-        struct breakpoint *list;
+        uint32_t *set;
+        struct condition *conds;
+        uint32_t set_bits;      // The set has `1 << set_bits` slots
         size_t len;
     } breakpoints;
 
+    /*
+    ** Each access first checks the bit of the page(s) it touches, and only the accesses
+    ** to a watched page go through the list of watchpoints.
+    */
     struct {
         struct watchpoint *list;
         size_t len;
-        void (*cleanup)(void *);
+        uint64_t read_pages[WATCHPOINT_PAGE_COUNT / 64];
+        uint64_t write_pages[WATCHPOINT_PAGE_COUNT / 64];
     } watchpoints;
 
+    /*
+    ** The trace either calls `tracer_cb` after each instruction or, if `ring` is set,
+    ** pushes a binary record of each instruction to it.
+    */
     struct {
         size_t count;
         void (*tracer_cb)(void *);
         void *arg;
+        struct trace_ring *ring;
+        bool mem;           // Also record the memory accesses (binary trace only)
     } trace;
 
     struct {
@@ -78,9 +214,31 @@ struct debugger {
 
 /* gba/debugger.c */
 void debugger_init(struct debugger *debugger);
+bool debugger_eval_condition(struct gba *gba, struct condition const *cond);
+void debugger_set_breakpoints(struct gba *gba, struct breakpoint const *breakpoints, size_t len);
 void debugger_eval_breakpoints(struct gba *gba);
+void debugger_set_watchpoints(struct gba *gba, struct watchpoint const *watchpoints, size_t len);
 void debugger_eval_write_watchpoints(struct gba *gba, uint32_t addr, size_t size, uint32_t);
 void debugger_eval_read_watchpoints(struct gba *gba, uint32_t addr, size_t size);
+void debugger_trace_mem(struct gba *gba, uint32_t addr, size_t size, uint32_t val, bool write);
 void debugger_execute_run_mode(struct gba *gba);
 
+/*
+** Return true if the access of `size` bytes at `addr` touches a page with at least one watchpoint.
+*/
+static inline
+bool
+debugger_is_page_watched(
+    uint64_t const *pages,
+    uint32_t addr,
+    size_t size
+) {
+    uint32_t first;
+    uint32_t last;
+
+    first = WATCHPOINT_PAGE(addr);
+    last = WATCHPOINT_PAGE(addr + size - 1);
+    return (((pages[first / 64] >> (first % 64)) | (pages[last / 64] >> (last % 64))) & 1);
+}
+
 #endif /* WITH_DEBUGGER */
@@ -53,6 +53,7 @@ struct message_reset {
 struct message_speed {
     struct event_header header;
     uint32_t speed;
+    bool audio_sync;
 };
 
 struct message_key {
@@ -79,6 +80,8 @@ struct message_trace {
     size_t count;
     void (*tracer_cb)(void *);
     void *arg;
+    struct trace_ring *ring;    // If set, `tracer_cb` is ignored and a binary trace is pushed to `ring`.
+    bool mem;
 };
 
 struct message_set_breakpoints_list {
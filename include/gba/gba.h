@@ -14,7 +14,8 @@
 #define GBA_SCREEN_REAL_WIDTH           308
 #define GBA_SCREEN_REAL_HEIGHT          228
 #define GBA_CYCLES_PER_PIXEL            4
-#define GBA_CYCLES_PER_FRAME            (CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH * GBA_SCREEN_REAL_HEIGHT)
+#define GBA_CYCLES_PER_SCANLINE         (GBA_CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH)
+#define GBA_CYCLES_PER_FRAME            (GBA_CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH * GBA_SCREEN_REAL_HEIGHT)
 #define GBA_CYCLES_PER_SECOND           ((uint64_t)(16 * 1024 * 1024))
 
 #include "hades.h"
@@ -26,7 +27,12 @@
 #include "gba/apu.h"
 #include "gba/io.h"
 #include "gba/gpio.h"
+#include "gba/link.h"
+#include "gba/hle.h"
 #include "gba/debugger.h"
+#include "gba/profiler.h"
+#include "gba/coverage.h"
+#include "gba/counters.h"
 
 enum gba_states {
     GBA_STATE_STOP = 0,
@@ -50,6 +56,28 @@ enum keys {
     KEY_MIN = KEY_A,
 };
 
+/*
+** Health metrics of the emulation, published by the frame limiter every `SCHED_FRAME_TIMES_LEN`
+** frames so the frontend can read them at any time without a lock.
+**
+** The times are in microseconds and computed over the last `SCHED_FRAME_TIMES_LEN` frames.
+*/
+struct emulation_stats {
+    atomic_uint frame_time_mean;
+    atomic_uint frame_time_p50;
+    atomic_uint frame_time_p99;
+    atomic_uint frame_time_max;
+    atomic_uint busy_time_mean;             // The part of a frame spent emulating and not waiting in the frame limiter
+    atomic_uint speed;                      // In percent of the speed of a real GBA
+
+    atomic_uint audio_fill;                 // In percent of the audio ring buffer's capacity
+    atomic_uint_fast64_t audio_underruns;   // The number of times the audio ring buffer ran dry
+    atomic_uint_fast64_t audio_overruns;    // The number of times the audio ring buffer was full and samples were dropped
+
+    atomic_uint_fast64_t frames;            // The number of frames since the last reset
+    atomic_uint_fast64_t dropped_frames;    // The number of frames the frame limiter gave up on catching up
+};
+
 struct shared_data {
     // The emulator's screen, as built by the PPU each frame.
     struct {
@@ -58,17 +86,22 @@ struct shared_data {
     } framebuffer;
 
     // The game's backup storage.
-    // There's no lock behind this data because
+    // There's no lock behind this data: a block is marked dirty after it is modified, so a frontend
+    // reading a block while it's being written will see it dirty again and write it once more later.
     struct {
         uint8_t *data;
         size_t size;
 
-        atomic_bool dirty; // Set to true when `data` is modified.
+        // One bit per `BACKUP_STORAGE_BLOCK_SIZE` bytes of `data`, set when that block is modified.
+        atomic_uint_fast64_t dirty[BACKUP_STORAGE_DIRTY_LEN];
     } backup_storage;
 
     // The frame counter, used for FPS calculations.
     atomic_uint frame_counter;
 
+    // Health metrics of the emulation.
+    struct emulation_stats stats;
+
     // Audio ring buffer.
     struct apu_rbuffer audio_rbuffer;
     pthread_mutex_t audio_rbuffer_mutex;
@@ -105,9 +138,27 @@ struct gba {
     struct io io;
     struct gpio gpio;
 
+    // The link cable, kept across resets
+    struct link_port link;
+
+    // The high-level emulation of the BIOS
+    struct hle hle;
+
 #ifdef WITH_DEBUGGER
     struct debugger debugger;
 #endif
+
+#ifdef WITH_PROFILER
+    struct profiler profiler;
+#endif
+
+#ifdef WITH_COVERAGE
+    struct coverage coverage;
+#endif
+
+#ifdef WITH_COUNTERS
+    struct counters counters;
+#endif
 };
 
 struct launch_config {
@@ -126,9 +177,17 @@ struct launch_config {
     // True if the BIOS should be skipped
     bool skip_bios;
 
+    // How the supported BIOS calls are run.
+    // Forced to `HLE_ON` if no BIOS is given.
+    enum hle_modes hle;
+
     // Speed. 0 = unlimited, 1 = 60fps, 2 = 120fps, etc.
     uint32_t speed;
 
+    // True if the emulation should be paced to the audio device instead of the clock.
+    // Only used at speed 1 and when the frontend has audio.
+    bool audio_sync;
+
     // Set to the frontend's audio frequency.
     // Can be 0 if the frontend has no audio.
     uint32_t audio_frequency;
@@ -142,6 +201,11 @@ struct launch_config {
         uint8_t *data;
         size_t size;
     } backup_storage;
+
+#ifdef WITH_PROFILER
+    // Sample the PC every `profiler_period` cycles, or 0 to disable the profiler.
+    uint64_t profiler_period;
+#endif
 };
 
 struct notification;
@@ -149,6 +213,7 @@ struct notification;
 /* source/gba.c */
 struct gba *gba_create(void);
 void gba_run(struct gba *gba);
+void gba_process_all_messages(struct gba *gba);
 void gba_delete(struct gba *gba);
 void gba_shared_framebuffer_lock(struct gba *gba);
 void gba_shared_framebuffer_release(struct gba *gba);
@@ -157,7 +222,9 @@ void gba_shared_audio_rbuffer_release(struct gba *gba);
 uint32_t gba_shared_audio_rbuffer_pop_sample(struct gba *gba);
 uint32_t gba_shared_reset_frame_counter(struct gba *gba);
 void gba_delete_notification(struct notification const *notif);
+void gba_delete_all_notifications(struct gba *gba);
 
 /* source/db.c */
-struct game_entry *db_lookup_game(uint8_t const *code);
+uint32_t db_rom_crc32(uint8_t const *rom, size_t rom_size);
+struct game_entry *db_lookup_game(uint8_t const *code, uint32_t crc32);
 struct game_entry *db_autodetect_game_features(uint8_t const *rom, size_t rom_size);
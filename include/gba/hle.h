@@ -0,0 +1,62 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include <stdio.h>
+#include "hades.h"
+
+/*
+** The high-level emulation of the BIOS runs the hottest software interrupts (the divisions,
+** the memory copies, the decompressors, etc.) natively instead of interpreting the BIOS.
+**
+** The cycles they take are approximated from the real BIOS: the memory accesses are charged
+** with the current wait states, on top of a fixed cost per call and per unit of work.
+**
+** The calls that aren't supported are run by the BIOS. If there is none, a small stub is
+** installed instead, which handles the IRQs and ignores the unsupported calls.
+*/
+enum hle_modes {
+    HLE_OFF = 0,
+    HLE_ON,
+
+    // Run each supported call with both the HLE and the BIOS and report the differences.
+    // The BIOS's result is the one kept.
+    HLE_CHECK,
+};
+
+#define HLE_SWI_LEN             0x100
+
+struct hle_stats {
+    uint64_t calls;
+    uint64_t mismatches;
+    uint64_t hle_cycles;                // The cycles the HLE would have taken
+    uint64_t lle_cycles;                // The cycles the BIOS took
+};
+
+struct hle {
+    enum hle_modes mode;
+    bool bios_stub;                     // True if no BIOS was given and the stub is used
+    bool waiting;                       // True while an `IntrWait` is run again and again
+
+    // The content of the RAMs before and after a call, only used by `HLE_CHECK`.
+    uint8_t *snapshot;
+    uint8_t *result;
+
+    struct hle_stats stats[HLE_SWI_LEN];    // Only filled by `HLE_CHECK`
+    uint64_t warned[HLE_SWI_LEN / 64];      // The unsupported calls already reported
+};
+
+struct gba;
+
+/* gba/hle.c */
+void hle_reset(struct gba *gba, enum hle_modes mode, bool bios_stub);
+void hle_cleanup(struct gba *gba);
+bool hle_swi(struct gba *gba, uint32_t comment);
+bool hle_write_report(struct gba const *gba, FILE *file);
@@ -146,6 +146,15 @@ enum io_regs {
     IO_REG_TM3CNT_LO    = 0x0400010C,
     IO_REG_TM3CNT_HI    = 0x0400010E,
 
+    /* Serial Communication (1) */
+    IO_REG_SIODATA32    = 0x04000120,
+    IO_REG_SIOMULTI0    = 0x04000120,
+    IO_REG_SIOMULTI1    = 0x04000122,
+    IO_REG_SIOMULTI2    = 0x04000124,
+    IO_REG_SIOMULTI3    = 0x04000126,
+    IO_REG_SIOMLT_SEND  = 0x0400012A,
+    IO_REG_SIODATA8     = 0x0400012A,
+
     /* Input */
     IO_REG_KEYINPUT     = 0x04000130,
     IO_REG_KEYCNT       = 0x04000132,
@@ -723,8 +732,21 @@ struct io {
         uint8_t bytes[2];
     } keycnt;
 
+    // REG_SIOMULTI0-3, the first two being also REG_SIODATA32
+    union {
+        uint16_t raw;
+        uint8_t bytes[2];
+    } siomulti[4];
+
+    // REG_SIOMLT_SEND, also REG_SIODATA8
+    union {
+        uint16_t raw;
+        uint8_t bytes[2];
+    } siomlt_send;
+
     // REG_SIOCNT
     union {
+        // Normal mode
         struct {
             uint16_t shift_clock: 1;
             uint16_t internal_shift_clock: 1;
@@ -738,12 +760,29 @@ struct io {
             uint16_t irq: 1;
             uint16_t : 1;
         } __packed;
+
+        // Multi-player mode
+        struct {
+            uint16_t baud_rate: 2;
+            uint16_t si_terminal: 1;
+            uint16_t sd_terminal: 1;
+            uint16_t multi_id: 2;
+            uint16_t multi_error: 1;
+            uint16_t : 5;
+            uint16_t mode: 2;
+            uint16_t : 2;
+        } __packed;
         uint16_t raw;
         uint8_t bytes[2];
     } siocnt;
 
     // REG_RCNT
     union {
+        struct {
+            uint16_t : 14;
+            uint16_t gpio_mode: 1;
+            uint16_t not_sio_mode: 1;
+        } __packed;
         uint16_t raw;
         uint8_t bytes[2];
     } rcnt;
@@ -849,6 +888,8 @@ static_assert(sizeof(((struct io *)NULL)->waveram) == 2 * (16 * sizeof(uint8_t))
 static_assert(sizeof(((struct io *)NULL)->keycnt) == sizeof(uint16_t));
 static_assert(sizeof(((struct io *)NULL)->keyinput) == sizeof(uint16_t));
 static_assert(sizeof(((struct io *)NULL)->siocnt) == sizeof(uint16_t));
+static_assert(sizeof(((struct io *)NULL)->rcnt) == sizeof(uint16_t));
+static_assert(sizeof(((struct io *)NULL)->siomulti) == 4 * sizeof(uint16_t));
 static_assert(sizeof(((struct io *)NULL)->int_enabled) == sizeof(uint16_t));
 static_assert(sizeof(((struct io *)NULL)->int_flag) == sizeof(uint16_t));
 static_assert(sizeof(((struct io *)NULL)->waitcnt) == sizeof(uint16_t));
@@ -0,0 +1,87 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include "hades.h"
+#include "gba/scheduler.h"
+
+#define LINK_MAX_PLAYERS        4
+
+// The default amount of cycles each emulator can run ahead of the others.
+// Transfers are delivered on time as long as they last at least twice that long.
+#define LINK_DEFAULT_QUANTUM    2048
+
+enum sio_modes {
+    SIO_MODE_NORMAL_8,
+    SIO_MODE_NORMAL_32,
+    SIO_MODE_MULTI,
+    SIO_MODE_UART,
+    SIO_MODE_GPIO,
+    SIO_MODE_JOYBUS,
+};
+
+/*
+** A link cable connecting up to `LINK_MAX_PLAYERS` emulators of the same process,
+** each running in its own thread.
+**
+** The emulators run freely in parallel, but none of them can be more than a quantum ahead
+** of the others: every quantum, each one publishes its cycle counter and waits for the
+** ones lagging too far behind.
+** Transfers are started by the first emulator (the parent), which posts them here. The
+** others pick them up at their next sync point and all the emulators meet at the end of
+** the transfer to exchange their data.
+**
+** Everything here is lock-free, the emulators only spin (and yield) while waiting.
+*/
+struct link {
+    uint64_t quantum;
+
+    struct gba *players[LINK_MAX_PLAYERS];
+    size_t players_len;
+
+    // False once the emulator left the link, the others stop waiting for it.
+    atomic_bool connected[LINK_MAX_PLAYERS];
+
+    // The cycle counter of each emulator at its last sync point.
+    atomic_uint_fast64_t cycles[LINK_MAX_PLAYERS];
+
+    // The last transfer each emulator reached the end of.
+    atomic_uint_fast64_t arrived[LINK_MAX_PLAYERS];
+
+    // The data sent by each emulator, for even and odd transfers.
+    // The lower 32 bits are the data itself, bit 32 is set if the emulator was ready to transfer.
+    atomic_uint_fast64_t data[2][LINK_MAX_PLAYERS];
+
+    // The last transfer started by the parent.
+    // `end` and `mode` are written before `seq` is incremented.
+    atomic_uint_fast64_t seq;
+    uint64_t end;
+    enum sio_modes mode;
+};
+
+/*
+** The emulator's end of the link cable.
+*/
+struct link_port {
+    struct link *link;          // NULL if the emulator isn't linked
+    size_t id;                  // The player number, 0 being the parent
+    uint64_t seq;               // The last transfer seen by the emulator
+};
+
+struct gba;
+
+/* gba/link.c */
+void link_init(struct link *link, uint64_t quantum);
+void link_connect(struct link *link, struct gba *gba);
+void link_disconnect(struct gba *gba);
+void link_reset(struct gba *gba);
+void link_sync(struct gba *gba, struct event_args args);
+void link_transfer_end(struct gba *gba, struct event_args args);
+void link_siocnt_write8(struct gba *gba, uint32_t byte, uint8_t val);
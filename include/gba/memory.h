@@ -113,6 +113,10 @@ enum access_types {
 #define EEPROM_64K_ADDR_MASK    (0x1FFF)
 #define EEPROM_64K_ADDR_LEN     (14)
 
+// The backup storage is tracked in blocks of this size to only write the modified parts to the disk.
+#define BACKUP_STORAGE_BLOCK_SIZE   (512)
+#define BACKUP_STORAGE_DIRTY_LEN    (FLASH128_SIZE / BACKUP_STORAGE_BLOCK_SIZE / 64)
+
 /*
 ** The different types of backup storage a game can use.
 */
@@ -238,6 +242,11 @@ struct memory {
     // Prefetch buffer
     struct prefetch_buffer pbuffer;
 
+    // The cycles taken by a bus access, indexed by access type and region.
+    // Updated each time REG_WAITCNT is written.
+    uint32_t access_time16[2][16];
+    uint32_t access_time32[2][16];
+
     // Open Bus
     uint32_t bios_bus;
 
@@ -272,11 +281,14 @@ uint8_t mem_io_read8(struct gba const *gba, uint32_t addr);
 void mem_io_write8(struct gba *gba, uint32_t addr, uint8_t val);
 
 /* gba/memory/memory.c */
+uint32_t mem_access_cycles(struct gba const *gba, uint32_t addr, uint32_t size, enum access_types access_type);
 void mem_access(struct gba *gba, uint32_t addr, uint32_t size, enum access_types access_type);
-void mem_update_waitstates(struct gba const *gba);
+void mem_update_waitstates(struct gba *gba);
 void mem_prefetch_buffer_access(struct gba *gba, uint32_t addr, uint32_t intended_cycles);
 void mem_prefetch_buffer_step(struct gba *gba, uint32_t cycles);
 uint32_t mem_openbus_read(struct gba const *gba, uint32_t addr);
+uint16_t mem_fetch16(struct gba *gba, uint32_t addr, enum access_types access_type);
+uint32_t mem_fetch32(struct gba *gba, uint32_t addr, enum access_types access_type);
 uint8_t mem_read8(struct gba *gba, uint32_t addr, enum access_types access_type);
 uint8_t mem_read8_raw(struct gba *gba, uint32_t addr);
 uint16_t mem_read16(struct gba *gba, uint32_t addr, enum access_types access_type);
@@ -295,6 +307,8 @@ void mem_write32_raw(struct gba *gba, uint32_t addr, uint32_t val);
 /* gba/memory/storage/eeprom.c */
 uint8_t mem_eeprom_read8(struct gba *gba);
 void mem_eeprom_write8(struct gba *gba, bool val);
+void mem_eeprom_write_bits(struct gba *gba, uint8_t const *bits, size_t len);
+void mem_eeprom_read_bits(struct gba *gba, uint8_t *bits, size_t len);
 
 /* gba/memory/storage/flash.c */
 uint8_t mem_flash_read8(struct gba const *gba, uint32_t addr);
@@ -303,7 +317,7 @@ void mem_flash_write8(struct gba *gba, uint32_t addr, uint8_t val);
 /* gba/memory/storage/storage.c */
 uint8_t mem_backup_storage_read8(struct gba const *gba, uint32_t addr);
 void mem_backup_storage_write8(struct gba *gba, uint32_t addr, uint8_t value);
-void mem_backup_storage_write_to_disk(struct gba *gba);
+void mem_backup_storage_mark_dirty(struct gba *gba, size_t offset, size_t len);
 
 /* gba/quicksave.c */
 void quicksave(struct gba const *gba, uint8_t **data, size_t *size);
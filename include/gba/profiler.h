@@ -0,0 +1,87 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#ifdef WITH_PROFILER
+
+#include <stdio.h>
+#include "hades.h"
+#include "gba/scheduler.h"
+
+/*
+** The guest code profiler samples the PC every `period` cycles and keeps a shadow call stack
+** of the game, so the samples can be exported as folded stacks (for flame graphs) and as a
+** histogram of the cycles spent at each address.
+**
+** The calls are the branches with link, the software interrupts and the IRQs. A frame is
+** popped when the PC is reloaded with its return address, whatever the instruction doing it.
+*/
+#define PROFILER_STACK_LEN      64
+
+/*
+** A node of the call tree: the function at `addr` called from the path of `parent`.
+** The node 0 is the root of the tree.
+*/
+struct profiler_node {
+    uint32_t parent;
+    uint32_t addr;
+    uint64_t samples;
+};
+
+struct profiler_frame {
+    uint32_t node;
+    uint32_t ret;
+};
+
+// Marks a free slot of the profiler's hash tables.
+#define PROFILER_SLOT_EMPTY     0xFFFFFFFF
+
+struct profiler {
+    uint64_t period;                // 0 if the profiler is disabled
+    uint64_t total;                 // The total number of samples
+    uint32_t pc;                    // The address of the instruction being executed
+
+    struct {
+        struct profiler_node *list;
+        size_t len;
+        size_t size;
+
+        // Open-addressing hash table of the indexes of the nodes, keyed by `(parent, addr)`
+        uint32_t *slots;
+        uint32_t slots_bits;
+    } nodes;
+
+    struct {
+        struct profiler_frame list[PROFILER_STACK_LEN];
+        size_t len;
+    } stack;
+
+    // Open-addressing hash table of the number of samples per address
+    struct {
+        uint32_t *addrs;
+        uint64_t *samples;
+        uint32_t bits;
+        size_t len;
+    } histogram;
+};
+
+struct gba;
+
+/* gba/profiler.c */
+void profiler_reset(struct gba *gba, uint64_t period);
+void profiler_resume(struct gba *gba);
+void profiler_cleanup(struct gba *gba);
+void profiler_sample(struct gba *gba, struct event_args args);
+void profiler_call(struct gba *gba, uint32_t addr, uint32_t ret);
+void profiler_return(struct gba *gba, uint32_t addr);
+void profiler_write_folded(struct gba const *gba, FILE *file);
+void profiler_write_histogram(struct gba const *gba, FILE *file);
+
+#endif /* WITH_PROFILER */
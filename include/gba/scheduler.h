@@ -11,6 +11,19 @@
 
 #define INVALID_EVENT_HANDLE    ((size_t)(-1))
 
+// Bounds of the adaptive slice of cycles run by `sched_run_slice()` between two checks of the message channel.
+#define SCHED_SLICE_MIN         (GBA_CYCLES_PER_SCANLINE)
+#define SCHED_SLICE_MAX         (GBA_CYCLES_PER_FRAME)
+
+// The frame limiter sleeps until this long before the deadline, and spins for the remaining time.
+#define SCHED_LIMITER_SPIN_NS   (1000 * 1000)
+
+// If the emulation falls behind by more than this amount of frames, the frame limiter gives up on catching up.
+#define SCHED_LIMITER_MAX_LAG   4
+
+// The amount of frame times the statistics are computed over.
+#define SCHED_FRAME_TIMES_LEN   128
+
 typedef size_t event_handler_t;
 
 enum sched_event_kind {
@@ -26,6 +39,11 @@ enum sched_event_kind {
     SCHED_EVENT_APU_WAVE_STEP,
     SCHED_EVENT_APU_NOISE_STEP,
     SCHED_EVENT_DMA_ADD_PENDING,
+    SCHED_EVENT_PROFILER_SAMPLE,
+    SCHED_EVENT_LINK_SYNC,
+    SCHED_EVENT_LINK_TRANSFER_END,
+
+    SCHED_EVENT_MAX,
 };
 
 enum sched_event_type {
@@ -65,14 +83,25 @@ struct scheduler {
 
     uint64_t next_event;            // The next event should occure when cycles == next_event
 
+    uint64_t slice;                 // The amount of cycles the next call to `sched_run_slice()` will run for
+
     struct scheduler_event *events;
     size_t events_size;
 
     uint32_t speed;                 // Speed. 0 = unlimited, 1 = 60fps, 2 = 120fps, etc.
+    bool audio_sync;                // Pace the emulation to the audio device instead of the clock (only at speed 1)
+    uint32_t audio_frequency;       // The amount of cycles between two audio samples, or 0 if there's no audio
 
+    // Frame limiter, all timestamps are in nanoseconds (see `hs_time_ns()`)
     uint64_t time_per_frame;
+    uint64_t next_frame_deadline;
     uint64_t time_last_frame;
-    uint64_t accumulated_time;
+
+    // The last frame times and the part of them spent emulating, in microseconds, used to compute `shared_data.stats`
+    uint32_t frame_times[SCHED_FRAME_TIMES_LEN];
+    uint32_t busy_times[SCHED_FRAME_TIMES_LEN];
+    size_t frame_times_idx;
+    size_t frame_times_len;
 };
 
 #define NEW_FIX_EVENT(_kind, _at)           \
@@ -130,6 +159,9 @@ event_handler_t sched_add_event(struct gba *gba, struct scheduler_event event);
 void sched_cancel_event(struct gba *gba, event_handler_t handler);
 void sched_process_events(struct gba *gba);
 void sched_run_for(struct gba *gba, uint64_t cycles);
+void sched_run_slice(struct gba *gba);
+void sched_reset_slice(struct gba *gba);
 void sched_frame_limiter(struct gba *gba,struct event_args args);
 void sched_reset_frame_limiter(struct gba *gba);
-void sched_update_speed(struct gba *gba, uint32_t speed);
+void sched_update_speed(struct gba *gba, uint32_t speed, bool audio_sync);
+void sched_publish_stats(struct gba *gba);
@@ -79,8 +79,8 @@
 #define STR(...)               XSTR(__VA_ARGS__)
 #define XCONCAT(a, b)           a ## b
 #define CONCAT(a, b)            XCONCAT(a, b)
-#define NTH(_0, _1, _2, _3, _4, _5, N, ...) N
-#define NARG(...)               NTH(, ##__VA_ARGS__, 5, 4, 3, 2, 1, 0)
+#define NTH(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...) N
+#define NARG(...)               NTH(, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
 
 /* Return the minimum between `a` and `b`. */
 #ifndef min
@@ -106,3 +106,42 @@
 
 /* Align `x` to the size of T */
 #define align(T, x)                             ((typeof(x))(align_on((x), sizeof(T))))
+
+/* The initial value of `hs_fnv1a()`. */
+#define HS_FNV1A_BASIS                          0xcbf29ce484222325ull
+
+/*
+** Continue the 64-bit FNV-1a hash `hash` with the given data.
+**
+** `hades-headless --hash` and the accuracy suite must agree on it, don't change it.
+*/
+static inline
+uint64_t
+hs_fnv1a(
+    uint64_t hash,
+    void const *data,
+    size_t size
+) {
+    uint8_t const *bytes;
+    size_t i;
+
+    bytes = data;
+    for (i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return (hash);
+}
+
+/*
+** Hash `key` on `bits` bits with Fibonacci hashing.
+**
+** The open-addressing tables using it are kept at most half full, so the probe sequences stay short.
+*/
+static inline
+uint32_t
+hs_fibonacci_hash(
+    uint32_t key,
+    uint32_t bits
+) {
+    return ((key * 0x9E3779B1u) >> (32 - bits));
+}
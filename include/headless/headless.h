@@ -0,0 +1,107 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include <pthread.h>
+#include "hades.h"
+#include "gba/gba.h"
+
+/*
+** A key press or release, read from the input script, that must be applied
+** at the beginning of the given frame.
+*/
+struct input_event {
+    uint64_t frame;
+    enum keys key;
+    bool pressed;
+};
+
+/*
+** An emulator linked to the main one, running the same game in its own thread.
+*/
+struct headless_peer {
+    struct gba *gba;
+    pthread_t thread;
+    uint64_t frames;
+    bool running;
+};
+
+struct headless {
+    struct gba *gba;
+
+    // The link cable and the other emulators, see `--link`
+    struct link link;
+    struct headless_peer peers[LINK_MAX_PLAYERS - 1];
+    size_t peers_len;
+
+    struct {
+        char const *rom_path;
+        char const *bios_path;
+        char const *config_path;
+        char const *input_path;
+        char const *screenshot_path;
+        char const *load_state_path;
+        char const *save_state_path;
+        char const *cache_dir;
+        char const *stats_path;
+        char const *profile_prefix;
+        char const *coverage_path;
+        char const *counters_path;
+        char const *counters_frames_path;
+        char const *hle_report_path;
+        uint64_t profile_period;
+        uint64_t frames;
+        uint64_t link_players;      // 0 if the emulator isn't linked
+        uint64_t link_quantum;
+        bool hash;
+        int skip_bios;              // -1 if not set on the command line
+        int hle;                    // -1 if not set on the command line
+    } args;
+
+    struct {
+        bool skip_bios;
+        enum hle_modes hle;
+
+        struct {
+            bool autodetect;
+            enum backup_storage_types type;
+        } backup_storage;
+
+        struct {
+            bool autodetect;
+            bool enabled;
+        } rtc;
+    } settings;
+
+    struct {
+        struct input_event *events;
+        size_t len;
+        size_t next;
+    } input;
+
+#ifdef WITH_COUNTERS
+    // The per-frame telemetry of the scheduler, see `--counters-frames`
+    struct {
+        FILE *file;
+        uint64_t frame;
+        struct sched_counter last[SCHED_EVENT_MAX];
+    } counters_frames;
+#endif
+};
+
+/* headless/args.c */
+void headless_args_parse(struct headless *headless, int argc, char * const argv[]);
+
+/* headless/config.c */
+bool headless_config_load(struct headless *headless);
+
+/* headless/input.c */
+bool headless_input_load(struct headless *headless);
+void headless_input_send(struct headless *headless, uint64_t frame);
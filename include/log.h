@@ -57,6 +57,85 @@ extern char const *g_white;
 extern bool g_verbose[HS_END];
 extern bool g_verbose_global;
 
+/*
+** The modules below `HS_CORE` are always available. The others are only useful to debug
+** the emulator, and their logs are in its hot paths: they can be removed entirely at
+** compile time by defining `WITHOUT_DEBUG_LOGS`.
+*/
+#ifdef WITHOUT_DEBUG_LOGS
+# define LOG_MODULE_ENABLED(module)     ((module) < HS_CORE)
+#else
+# define LOG_MODULE_ENABLED(module)     (true)
+#endif
+
+/*
+** Log the given formatted string, followed by a `\n`.
+**
+** The verbosity of the module is checked before the arguments are evaluated.
+*/
+#define logln(_module, ...)                                                     \
+    do {                                                                        \
+        if (LOG_MODULE_ENABLED(_module) && g_verbose_global && g_verbose[(_module)]) { \
+            log_print((_module), __VA_ARGS__);                                  \
+        }                                                                       \
+    } while (0)
+
+/*
+** A ring buffer keeping the last events logged with `logev()` in their binary form.
+**
+** Recording an event only costs a few stores: the format string is kept as is and its
+** arguments (integers or pointers to static strings) are only formatted when the ring
+** is dumped.
+**
+** Each event claims its slot atomically, so several emulators running in parallel in the
+** same process can share the ring. It must only be dumped when none of them is running.
+*/
+#define LOG_RING_LEN                    4096
+#define LOG_RING_MAX_ARGS               8
+
+struct log_ring_entry {
+    char const *fmt;
+    enum modules module;
+    uint64_t args[LOG_RING_MAX_ARGS];
+};
+
+extern bool g_log_ring_enabled;
+extern struct log_ring_entry g_log_ring[LOG_RING_LEN];
+extern atomic_uint_fast64_t g_log_ring_idx;
+
+#define LOG_ARG(_x)                     ((uint64_t)(uintptr_t)(_x))
+#define LOG_ARGS_0()
+#define LOG_ARGS_1(_1)                  LOG_ARG(_1)
+#define LOG_ARGS_2(_1, ...)             LOG_ARG(_1), LOG_ARGS_1(__VA_ARGS__)
+#define LOG_ARGS_3(_1, ...)             LOG_ARG(_1), LOG_ARGS_2(__VA_ARGS__)
+#define LOG_ARGS_4(_1, ...)             LOG_ARG(_1), LOG_ARGS_3(__VA_ARGS__)
+#define LOG_ARGS_5(_1, ...)             LOG_ARG(_1), LOG_ARGS_4(__VA_ARGS__)
+#define LOG_ARGS_6(_1, ...)             LOG_ARG(_1), LOG_ARGS_5(__VA_ARGS__)
+#define LOG_ARGS_7(_1, ...)             LOG_ARG(_1), LOG_ARGS_6(__VA_ARGS__)
+#define LOG_ARGS_8(_1, ...)             LOG_ARG(_1), LOG_ARGS_7(__VA_ARGS__)
+#define LOG_ARGS(...)                   CONCAT(LOG_ARGS_, NARG(__VA_ARGS__))(__VA_ARGS__)
+
+/*
+** Log an event of the emulation's hot paths.
+**
+** Like `logln()`, but the event is also recorded in the log ring if it is enabled.
+** The format must only use integer conversions or `%s` with static strings, and
+** the arguments may be evaluated twice.
+*/
+#define logev(_module, _fmt, ...)                                               \
+    do {                                                                        \
+        if (LOG_MODULE_ENABLED(_module)) {                                      \
+            if (unlikely(g_log_ring_enabled)) {                                 \
+                g_log_ring[atomic_fetch_add_explicit(&g_log_ring_idx, 1, memory_order_relaxed) % LOG_RING_LEN] = (struct log_ring_entry){ \
+                    .fmt = (_fmt),                                              \
+                    .module = (_module),                                        \
+                    .args = { LOG_ARGS(__VA_ARGS__) },                          \
+                };                                                              \
+            }                                                                   \
+            logln((_module), (_fmt), ##__VA_ARGS__);                            \
+        }                                                                       \
+    } while (0)
+
 static char const * const modules_str[] = {
     [HS_INFO]       = " INFO  ",
     [HS_ERROR]      = " ERROR ",
@@ -72,7 +151,9 @@ static char const * const modules_str[] = {
 };
 
 /* log.c */
-void logln(enum modules module, char const *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+void log_print(enum modules module, char const *fmt, ...) __attribute__ ((format (printf, 2, 3)));
+void log_ring_dump(FILE *file);
+void log_ring_clear(void);
 void panic(enum modules module, char const *fmt, ...) __attribute__ ((format (printf, 2, 3))) __attribute__((noreturn));
 void unimplemented(enum modules module, char const *fmt, ...) __attribute__ ((format (printf, 2, 3))) __attribute__((noreturn));
 void disable_colors(void);
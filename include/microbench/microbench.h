@@ -0,0 +1,48 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#pragma once
+
+#include "hades.h"
+#include "gba/gba.h"
+
+/*
+** A micro-benchmark of one of the hot paths of the emulator.
+**
+** `setup()` puts the emulator in the state the benchmark expects, from a reset.
+** `run()` then does `ops` operations, and is called many times in a row.
+** Both are given the benchmark's parameter, like the address of the region accessed.
+*/
+struct bench {
+    char const *name;
+    void (*setup)(struct gba *gba, uint32_t param);
+    void (*run)(struct gba *gba, uint32_t param, uint64_t ops);
+    uint32_t param;
+};
+
+struct microbench {
+    struct {
+        char * const *filters;      // Only the benchmarks whose name contains one of them are run
+        size_t filters_len;
+        uint64_t warmup;            // Amount of repetitions run before the measures
+        uint64_t reps;              // Amount of repetitions measured
+        uint64_t time_ms;           // The target duration of a repetition
+        bool csv;
+        bool list;
+    } args;
+
+    struct gba *gba;
+};
+
+/* microbench/args.c */
+void microbench_args_parse(struct microbench *microbench, int argc, char * const argv[]);
+
+/* microbench/benches.c */
+extern struct bench const benches[];
+extern size_t const benches_len;
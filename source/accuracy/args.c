@@ -0,0 +1,213 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <getopt.h>
+#include <stdio.h>
+#include "hades.h"
+#include "accuracy/accuracy.h"
+#include "compat.h"
+
+/*
+** Print the program's usage.
+*/
+static
+void
+print_usage(
+    FILE *file,
+    char const *name
+) {
+    fprintf(
+        file,
+        "Usage: %s [OPTION]... SUITE\n"
+        "\n"
+        "Options:\n"
+        "    -b, --bios=PATH                    Path pointing to the bios dump (default: \"bios.bin\")\n"
+        "    -r, --roms=PATH                    Path pointing to the test ROMs folder (default: \"roms\")\n"
+        "    -o, --output=PATH                  Write the last frame of the failed tests in PATH (default: \".tests_screenshots\")\n"
+        "    -j, --jobs=N                       Number of tests run in parallel (default: one per core)\n"
+        "        --color=[always|never|auto]    Adjust color settings (default: auto)\n"
+        "        --verbose                      Print the logs of the emulators\n"
+        "\n"
+        "    -h, --help                         Print this help and exit\n"
+        "    -v, --version                      Print the version information and exit\n"
+        "\n"
+        "The suite is a JSON file (see accuracy/suite.json) listing, for each test, its ROM, the\n"
+        "number of frames to run and the hash of the expected last frame, as printed by\n"
+        "`hades-headless --hash`.\n"
+        "",
+        name
+    );
+}
+
+/*
+** Parse the given command line arguments.
+*/
+void
+accuracy_args_parse(
+    struct accuracy *accuracy,
+    int argc,
+    char * const argv[]
+) {
+    char const *name;
+    uint32_t color;
+
+    color = 0;
+    name = argv[0];
+    while (true) {
+        int c;
+        int option_index;
+
+        enum cli_options {
+            CLI_HELP = 0,
+            CLI_VERSION,
+            CLI_BIOS,
+            CLI_ROMS,
+            CLI_OUTPUT,
+            CLI_JOBS,
+            CLI_COLOR,
+            CLI_VERBOSE,
+        };
+
+        static struct option long_options[] = {
+            [CLI_HELP]          = { "help",         no_argument,        0,  0 },
+            [CLI_VERSION]       = { "version",      no_argument,        0,  0 },
+            [CLI_BIOS]          = { "bios",         required_argument,  0,  0 },
+            [CLI_ROMS]          = { "roms",         required_argument,  0,  0 },
+            [CLI_OUTPUT]        = { "output",       required_argument,  0,  0 },
+            [CLI_JOBS]          = { "jobs",         required_argument,  0,  0 },
+            [CLI_COLOR]         = { "color",        optional_argument,  0,  0 },
+            [CLI_VERBOSE]       = { "verbose",      no_argument,        0,  0 },
+                                  { 0,              0,                  0,  0 }
+        };
+
+        c = getopt_long(
+            argc,
+            argv,
+            "hvb:r:o:j:",
+            long_options,
+            &option_index
+        );
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+            case 0: {
+                switch (option_index) {
+                    case CLI_HELP: { // --help
+                        print_usage(stdout, name);
+                        exit(EXIT_SUCCESS);
+                        break;
+                    };
+                    case CLI_VERSION: { // --version
+                        printf("Hades v" HADES_VERSION "\n");
+                        exit(EXIT_SUCCESS);
+                        break;
+                    };
+                    case CLI_BIOS: { // --bios
+                        accuracy->args.bios_path = optarg;
+                        break;
+                    };
+                    case CLI_ROMS: { // --roms
+                        accuracy->args.roms_dir = optarg;
+                        break;
+                    };
+                    case CLI_OUTPUT: { // --output
+                        accuracy->args.output_dir = optarg;
+                        break;
+                    };
+                    case CLI_JOBS: { // --jobs
+                        accuracy->args.jobs = strtoull(optarg, NULL, 0);
+                        break;
+                    };
+                    case CLI_COLOR: { // --color
+                        if (optarg) {
+                            if (!strcmp(optarg, "auto")) {
+                                color = 0;
+                                break;
+                            } else if (!strcmp(optarg, "never")) {
+                                color = 1;
+                                break;
+                            } else if (!strcmp(optarg, "always")) {
+                                color = 2;
+                                break;
+                            } else {
+                                print_usage(stderr, name);
+                                exit(EXIT_FAILURE);
+                            }
+                        } else {
+                            color = 0;
+                        }
+                        break;
+                    };
+                    case CLI_VERBOSE: { // --verbose
+                        accuracy->args.verbose = true;
+                        break;
+                    };
+                    default: {
+                        print_usage(stderr, name);
+                        exit(EXIT_FAILURE);
+                        break;
+                    };
+                }
+                break;
+            };
+            case 'b': {
+                accuracy->args.bios_path = optarg;
+                break;
+            };
+            case 'r': {
+                accuracy->args.roms_dir = optarg;
+                break;
+            };
+            case 'o': {
+                accuracy->args.output_dir = optarg;
+                break;
+            };
+            case 'j': {
+                accuracy->args.jobs = strtoull(optarg, NULL, 0);
+                break;
+            };
+            case 'h': {
+                print_usage(stdout, name);
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            case 'v': {
+                printf("Hades v" HADES_VERSION "\n");
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            default: {
+                print_usage(stderr, name);
+                exit(EXIT_FAILURE);
+                break;
+            };
+        }
+    }
+
+    if (argc - optind != 1) {
+        print_usage(stderr, name);
+        exit(EXIT_FAILURE);
+    }
+
+    accuracy->args.suite_path = argv[optind];
+
+    switch (color) {
+        case 0:
+            if (!hs_isatty(1)) {
+                disable_colors();
+            }
+            break;
+        case 1:
+            disable_colors();
+            break;
+    }
+}
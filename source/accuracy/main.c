@@ -0,0 +1,316 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** The accuracy test runner.
+**
+** All the tests of the suite are run in the same process, spread over a pool of workers
+** that each own an emulator. Like the headless frontend, the emulators aren't run in their
+** own thread: the workers process their messages synchronously and advance them one frame
+** at a time.
+**
+** The last frame of each test is compared with the expected one through their hash.
+** A screenshot is only written for the tests that fail.
+*/
+
+#define _GNU_SOURCE
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+
+#include <stb_image_write.h>
+#include <pthread.h>
+#include <inttypes.h>
+#include <errno.h>
+#include "hades.h"
+#include "accuracy/accuracy.h"
+#include "app/loader.h"
+#include "gba/gba.h"
+#include "gba/db.h"
+#include "gba/event.h"
+#include "compat.h"
+
+/*
+** Write the last frame of a failed test in the output folder.
+*/
+static
+void
+accuracy_write_screenshot(
+    struct accuracy const *accuracy,
+    struct gba const *gba,
+    struct accuracy_test *test
+) {
+    char path[4096];
+
+    snprintf(path, sizeof(path), "%s/%s", accuracy->args.output_dir, test->screenshot);
+
+    if (!stbi_write_png(
+        path,
+        GBA_SCREEN_WIDTH,
+        GBA_SCREEN_HEIGHT,
+        4,
+        gba->shared_data.framebuffer.data,
+        GBA_SCREEN_WIDTH * sizeof(uint32_t)
+    )) {
+        free(test->error);
+        hs_assert(-1 != asprintf(&test->error, "Failed to write the screenshot to \"%s\".", path));
+    }
+}
+
+/*
+** Run the given test on the given emulator and fill its result.
+*/
+static
+void
+accuracy_run_test(
+    struct accuracy const *accuracy,
+    struct gba *gba,
+    struct accuracy_test *test
+) {
+    struct message_reset event;
+    struct launch_config *config;
+    struct game_entry *game_entry;
+    char path[4096];
+    uint64_t frame;
+    char *err;
+
+    if (test->skip) {
+        test->result = ACCURACY_SKIP;
+        return ;
+    }
+
+    config = &event.config;
+    memset(config, 0, sizeof(*config));
+
+    snprintf(path, sizeof(path), "%s/%s", accuracy->args.roms_dir, test->rom);
+    err = app_load_rom(path, NULL, &config->rom.data, &config->rom.size);
+    if (err) {
+        test->result = ACCURACY_FAIL;
+        test->error = err;
+        return ;
+    }
+
+    game_entry = db_lookup_game(config->rom.data + 0xAC, db_rom_crc32(config->rom.data, config->rom.size));
+    if (!game_entry) {
+        game_entry = db_autodetect_game_features(config->rom.data, config->rom.size);
+    }
+
+    config->bios.data = accuracy->bios;
+    config->bios.size = accuracy->bios_size;
+    config->skip_bios = true;
+    config->hle = HLE_OFF;
+    config->speed = 0;
+    config->audio_frequency = 0;
+    config->rtc = (bool)(game_entry->flags & GAME_ENTRY_FLAGS_RTC);
+    config->backup_storage.type = game_entry->storage;
+    free(game_entry);
+
+    event.header.kind = MESSAGE_RESET;
+    event.header.size = sizeof(event);
+    channel_push(&gba->channels.messages, &event.header);
+    gba_process_all_messages(gba);
+
+    // None of the notifications is relevant to the tests.
+    gba_delete_all_notifications(gba);
+
+    // The ROM was copied by the reset
+    free(config->rom.data);
+
+    for (frame = 0; frame < test->frames; ++frame) {
+        sched_run_for(gba, GBA_CYCLES_PER_FRAME);
+        gba_delete_all_notifications(gba);
+    }
+
+    test->actual_hash = hs_fnv1a(HS_FNV1A_BASIS, gba->shared_data.framebuffer.data, sizeof(gba->shared_data.framebuffer.data));
+    if (test->actual_hash == test->hash) {
+        test->result = ACCURACY_PASS;
+        return ;
+    }
+
+    test->result = ACCURACY_FAIL;
+    hs_assert(-1 != asprintf(
+        &test->error,
+        "The last frame doesn't match the expected one (hash %016" PRIx64 ", expected %016" PRIx64 ").",
+        test->actual_hash,
+        test->hash
+    ));
+    accuracy_write_screenshot(accuracy, gba, test);
+}
+
+/*
+** Run the tests of the queue until it's empty.
+**
+** Each worker reuses the same emulator for all its tests, they are all started from a reset.
+*/
+static
+void *
+accuracy_worker(
+    void *raw
+) {
+    struct accuracy *accuracy;
+    struct gba *gba;
+
+    accuracy = raw;
+    gba = gba_create();
+
+    while (true) {
+        size_t idx;
+
+        idx = atomic_fetch_add(&accuracy->next, 1);
+        if (idx >= accuracy->tests_len) {
+            break;
+        }
+
+        accuracy_run_test(accuracy, gba, accuracy->queue[idx]);
+    }
+
+    gba_delete(gba);
+    return (NULL);
+}
+
+static
+int
+accuracy_cmp_frames(
+    void const *lhs,
+    void const *rhs
+) {
+    struct accuracy_test const *a;
+    struct accuracy_test const *b;
+
+    a = *(struct accuracy_test * const *)lhs;
+    b = *(struct accuracy_test * const *)rhs;
+    return ((a->frames < b->frames) - (a->frames > b->frames));
+}
+
+/*
+** Print the results of the suite, in its order, and return true if a test failed.
+*/
+static
+bool
+accuracy_print_results(
+    struct accuracy const *accuracy
+) {
+    size_t i;
+    bool failed;
+
+    failed = false;
+
+    printf("┏━%s━┳━━━━━━┓\n", "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+    printf("┃ %-30s ┃ Res. ┃\n", "Name");
+    printf("┣━%s━╋━━━━━━┫\n", "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+
+    for (i = 0; i < accuracy->tests_len; ++i) {
+        struct accuracy_test const *test;
+
+        test = accuracy->tests + i;
+        switch (test->result) {
+            case ACCURACY_PASS: printf("┃ %-30s ┃ %s%sPASS%s ┃\n", test->name, g_bold, g_green, g_reset); break;
+            case ACCURACY_SKIP: printf("┃ %-30s ┃ %s%sSKIP%s ┃\n", test->name, g_bold, g_yellow, g_reset); break;
+            case ACCURACY_FAIL: printf("┃ %-30s ┃ %s%sFAIL%s ┃\n", test->name, g_bold, g_red, g_reset); break;
+        }
+
+        if (test->result == ACCURACY_FAIL) {
+            failed = true;
+        }
+    }
+
+    printf("┗━%s━┻━━━━━━┛\n", "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━");
+
+    for (i = 0; i < accuracy->tests_len; ++i) {
+        struct accuracy_test const *test;
+
+        test = accuracy->tests + i;
+        if (test->error) {
+            printf("%s: %s\n", test->name, test->error);
+        }
+    }
+
+    return (failed);
+}
+
+int
+main(
+    int argc,
+    char *argv[]
+) {
+    struct accuracy accuracy;
+    pthread_t *workers;
+    size_t workers_len;
+    uint64_t start;
+    size_t i;
+    char *err;
+    int ret;
+
+    memset(&accuracy, 0, sizeof(accuracy));
+    workers = NULL;
+    ret = EXIT_FAILURE;
+
+    accuracy.args.bios_path = "bios.bin";
+    accuracy.args.roms_dir = "roms";
+    accuracy.args.output_dir = ".tests_screenshots";
+
+    accuracy_args_parse(&accuracy, argc, argv);
+
+    // The logs of the emulators would be interleaved, only keep the errors.
+    if (!accuracy.args.verbose) {
+        g_verbose[HS_INFO] = false;
+        g_verbose[HS_WARNING] = false;
+    }
+
+    if (accuracy_suite_load(&accuracy)) {
+        goto end;
+    }
+
+    err = app_load_bios(accuracy.args.bios_path, &accuracy.bios, &accuracy.bios_size);
+    if (err) {
+        logln(HS_ERROR, "%s", err);
+        free(err);
+        goto end;
+    }
+
+    if (!hs_fexists(accuracy.args.output_dir)) {
+        hs_mkdir(accuracy.args.output_dir);
+    }
+
+    accuracy.queue = calloc(accuracy.tests_len, sizeof(*accuracy.queue));
+    hs_assert(accuracy.queue);
+
+    for (i = 0; i < accuracy.tests_len; ++i) {
+        accuracy.queue[i] = accuracy.tests + i;
+    }
+
+    qsort(accuracy.queue, accuracy.tests_len, sizeof(*accuracy.queue), accuracy_cmp_frames);
+
+    workers_len = accuracy.args.jobs ? accuracy.args.jobs : hs_nproc();
+    workers_len = max(min(workers_len, accuracy.tests_len), 1);
+
+    workers = calloc(workers_len, sizeof(*workers));
+    hs_assert(workers);
+
+    start = hs_time_ns();
+
+    for (i = 0; i < workers_len; ++i) {
+        hs_assert(!pthread_create(workers + i, NULL, accuracy_worker, &accuracy));
+    }
+
+    for (i = 0; i < workers_len; ++i) {
+        pthread_join(workers[i], NULL);
+    }
+
+    if (!accuracy_print_results(&accuracy)) {
+        ret = EXIT_SUCCESS;
+    }
+
+    printf("%zu tests run in %.3fs with %zu workers.\n", accuracy.tests_len, (hs_time_ns() - start) / 1e9, workers_len);
+
+end:
+    free(workers);
+    free(accuracy.queue);
+    free(accuracy.bios);
+    accuracy_suite_free(&accuracy);
+    return (ret);
+}
@@ -0,0 +1,184 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <errno.h>
+#include <mjson.h>
+#include "hades.h"
+#include "accuracy/accuracy.h"
+#include "compat.h"
+
+/*
+** Read the whole content of the file at the given path, followed by a `\0`.
+*/
+static
+char *
+accuracy_read_file(
+    char const *path,
+    size_t *size
+) {
+    FILE *file;
+    char *buffer;
+    long file_len;
+
+    file = hs_fopen(path, "rb");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", path, strerror(errno));
+        return (NULL);
+    }
+
+    fseek(file, 0, SEEK_END);
+    file_len = ftell(file);
+    rewind(file);
+
+    buffer = calloc(1, file_len + 1);
+    hs_assert(buffer);
+
+    if (fread(buffer, 1, file_len, file) != (size_t)file_len) {
+        logln(HS_ERROR, "Failed to read \"%s\": %s.", path, strerror(errno));
+        free(buffer);
+        fclose(file);
+        return (NULL);
+    }
+
+    fclose(file);
+
+    *size = file_len;
+    return (buffer);
+}
+
+/*
+** Load the tests of the suite.
+**
+** The suite is an object whose `tests` key is an array of tests, each of them of the form:
+**
+**     {
+**         "name": "Jsmolka - arm.gba",
+**         "source": "https://github.com/jsmolka/gba-tests",  // Where the ROM comes from, ignored
+**         "rom": "jsmolka-arm.gba",           // Relative to the ROMs folder
+**         "frames": 10,
+**         "screenshot": "jsmolka_arm.png",    // Written in the output folder if the test fails
+**         "hash": "e5ab36d2fca96065",         // The hash of the expected last frame
+**         "skip": false                       // Optional
+**     }
+*/
+bool
+accuracy_suite_load(
+    struct accuracy *accuracy
+) {
+    char *data;
+    size_t data_len;
+    size_t i;
+    bool err;
+
+    data = accuracy_read_file(accuracy->args.suite_path, &data_len);
+    if (!data) {
+        return (true);
+    }
+
+    err = false;
+    for (i = 0; true; ++i) {
+        struct accuracy_test *test;
+        char path[64];
+        char str[4096];
+        char const *token;
+        char *end;
+        int token_len;
+        double frames;
+        int skip;
+
+        snprintf(path, sizeof(path), "$.tests[%zu]", i);
+        if (!mjson_find(data, data_len, path, &token, &token_len)) {
+            break;
+        }
+
+        accuracy->tests = realloc(accuracy->tests, sizeof(struct accuracy_test) * (accuracy->tests_len + 1));
+        hs_assert(accuracy->tests);
+
+        test = accuracy->tests + accuracy->tests_len;
+        memset(test, 0, sizeof(*test));
+        ++accuracy->tests_len;
+
+        snprintf(path, sizeof(path), "$.tests[%zu].name", i);
+        if (mjson_get_string(data, data_len, path, str, sizeof(str)) <= 0) {
+            logln(HS_ERROR, "%s: the test #%zu has no name.", accuracy->args.suite_path, i);
+            err = true;
+            goto end;
+        }
+        test->name = strdup(str);
+
+        snprintf(path, sizeof(path), "$.tests[%zu].rom", i);
+        if (mjson_get_string(data, data_len, path, str, sizeof(str)) <= 0) {
+            logln(HS_ERROR, "%s: the test \"%s\" has no ROM.", accuracy->args.suite_path, test->name);
+            err = true;
+            goto end;
+        }
+        test->rom = strdup(str);
+
+        snprintf(path, sizeof(path), "$.tests[%zu].screenshot", i);
+        if (mjson_get_string(data, data_len, path, str, sizeof(str)) <= 0) {
+            logln(HS_ERROR, "%s: the test \"%s\" has no screenshot.", accuracy->args.suite_path, test->name);
+            err = true;
+            goto end;
+        }
+        test->screenshot = strdup(str);
+
+        snprintf(path, sizeof(path), "$.tests[%zu].frames", i);
+        if (!mjson_get_number(data, data_len, path, &frames) || frames < 0) {
+            logln(HS_ERROR, "%s: the test \"%s\" has no number of frames.", accuracy->args.suite_path, test->name);
+            err = true;
+            goto end;
+        }
+        test->frames = (uint64_t)frames;
+
+        snprintf(path, sizeof(path), "$.tests[%zu].hash", i);
+        if (mjson_get_string(data, data_len, path, str, sizeof(str)) <= 0) {
+            logln(HS_ERROR, "%s: the test \"%s\" has no hash.", accuracy->args.suite_path, test->name);
+            err = true;
+            goto end;
+        }
+
+        errno = 0;
+        test->hash = strtoull(str, &end, 16);
+        if (errno || *end) {
+            logln(HS_ERROR, "%s: the hash of the test \"%s\" is malformed.", accuracy->args.suite_path, test->name);
+            err = true;
+            goto end;
+        }
+
+        snprintf(path, sizeof(path), "$.tests[%zu].skip", i);
+        if (mjson_get_bool(data, data_len, path, &skip)) {
+            test->skip = skip;
+        }
+    }
+
+end:
+    free(data);
+    return (err);
+}
+
+/*
+** Free the tests of the suite and their results.
+*/
+void
+accuracy_suite_free(
+    struct accuracy *accuracy
+) {
+    size_t i;
+
+    for (i = 0; i < accuracy->tests_len; ++i) {
+        free(accuracy->tests[i].name);
+        free(accuracy->tests[i].rom);
+        free(accuracy->tests[i].screenshot);
+        free(accuracy->tests[i].error);
+    }
+
+    free(accuracy->tests);
+    accuracy->tests = NULL;
+    accuracy->tests_len = 0;
+}
@@ -94,6 +94,10 @@ app_config_load(
         if (mjson_get_bool(data, data_len, "$.emulation.skip_bios", &b)) {
             app->emulation.skip_bios = b;
         }
+
+        if (mjson_get_bool(data, data_len, "$.emulation.hle_bios", &b)) {
+            app->emulation.hle_bios = b;
+        }
     }
 
     // Video
@@ -138,6 +142,10 @@ app_config_load(
             app->audio.mute = b;
         }
 
+        if (mjson_get_bool(data, data_len, "$.audio.sync", &b)) {
+            app->audio.sync = b;
+        }
+
         if (mjson_get_number(data, data_len, "$.audio.level", &d)) {
             app->audio.level = d;
             app->audio.level = max(0.f, min(app->audio.level, 1.f));
@@ -216,6 +224,7 @@ app_config_save(
             // Emulation
             "emulation": {
                 "skip_bios": %B,
+                "hle_bios": %B,
                 "speed": %d,
                 "unbounded": %B,
                 "backup_storage": {
@@ -241,6 +250,7 @@ app_config_save(
             // Audio
             "audio": {
                 "mute": %B,
+                "sync": %B,
                 "level": %g
             },
         }),
@@ -251,6 +261,7 @@ app_config_save(
         app->file.recent_roms[3],
         app->file.recent_roms[4],
         (int)app->emulation.skip_bios,
+        (int)app->emulation.hle_bios,
         (int)app->emulation.speed,
         (int)app->emulation.unbounded,
         (int)app->emulation.backup_storage.autodetect,
@@ -264,6 +275,7 @@ app_config_save(
         (int)app->video.lcd_grid,
         (int)app->gfx.texture_filter,
         (int)app->audio.mute,
+        (int)app->audio.sync,
         app->audio.level
     );
 
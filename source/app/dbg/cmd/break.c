@@ -25,20 +25,23 @@ debugger_cmd_break(
             printf("Breakpoints:\n");
             for (i = 0; i < app->debugger.breakpoints_len; ++i) {
                 printf(
-                    "  %s%2zi%s: %s0x%08x%s\n",
+                    "  %s%2zi%s: %s0x%08x%s%s\n",
                     g_light_green,
                     i + 1,
                     g_reset,
                     g_light_magenta,
                     app->debugger.breakpoints[i].ptr,
-                    g_reset
+                    g_reset,
+                    app->debugger.breakpoints[i].cond.len ? " (conditional)" : ""
                 );
             }
         } else {
             printf("There's no breakpoint.\n");
         }
-    } else if (argc == 1) {
+    } else if (argc == 1 || (argc == 2 && argv[1].type == ARGS_CONDITION)) {
         if (!debugger_check_arg_type(CMD_BREAK, &argv[0], ARGS_INTEGER)) {
+            struct breakpoint *bp;
+
             app->debugger.breakpoints = realloc(
                 app->debugger.breakpoints,
                 sizeof(struct breakpoint) * (app->debugger.breakpoints_len + 1)
@@ -46,13 +49,19 @@ debugger_cmd_break(
 
             hs_assert(app->debugger.breakpoints);
 
-            app->debugger.breakpoints[app->debugger.breakpoints_len].ptr = argv[0].value.i64;
+            bp = &app->debugger.breakpoints[app->debugger.breakpoints_len];
+            memset(bp, 0, sizeof(*bp));
+            bp->ptr = argv[0].value.i64;
+            if (argc == 2) {
+                bp->cond = argv[1].value.cond;
+            }
             ++app->debugger.breakpoints_len;
 
             printf(
-                "New breakpoint at address %s0x%08x%s\n",
+                "New %sbreakpoint at address %s0x%08x%s\n",
+                bp->cond.len ? "conditional " : "",
                 g_light_magenta,
-                app->debugger.breakpoints[app->debugger.breakpoints_len - 1].ptr,
+                bp->ptr,
                 g_reset
             );
 
@@ -0,0 +1,41 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <string.h>
+#include "hades.h"
+#include "app/app.h"
+#include "app/dbg.h"
+
+void
+debugger_cmd_log(
+    struct app *app __unused,
+    size_t argc,
+    struct arg const *argv
+) {
+    if (argc == 0) {
+        if (!g_log_ring_enabled && !g_log_ring_idx) {
+            printf("The log ring is empty, use \"%sverbose ring%s\" to start recording events.\n", g_light_green, g_reset);
+            return ;
+        }
+
+        log_ring_dump(stdout);
+    } else if (argc == 1) {
+        if (debugger_check_arg_type(CMD_LOG, &argv[0], ARGS_STRING)) {
+            return ;
+        }
+
+        if (!strcmp(argv[0].value.s, "clear")) {
+            log_ring_clear();
+        } else {
+            printf("Usage: %s\n", g_commands[CMD_LOG].usage);
+        }
+    } else {
+        printf("Usage: %s\n", g_commands[CMD_LOG].usage);
+    }
+}
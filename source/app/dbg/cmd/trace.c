@@ -7,9 +7,148 @@
 **
 \******************************************************************************/
 
+#include <archive.h>
+#include <archive_entry.h>
+#include <pthread.h>
+#include <string.h>
 #include "hades.h"
 #include "app/app.h"
 #include "app/dbg.h"
+#include "compat.h"
+
+/*
+** The writer of a binary trace, draining the ring filled by the emulation thread to the
+** compressed file.
+*/
+struct trace_writer {
+    struct trace_ring *ring;
+    struct archive *archive;
+    atomic_bool done;
+    size_t records;
+    bool failed;
+};
+
+static
+void *
+debugger_trace_writer(
+    void *raw_writer
+) {
+    struct trace_writer *writer;
+    struct trace_ring *ring;
+
+    writer = raw_writer;
+    ring = writer->ring;
+
+    while (true) {
+        size_t head;
+        size_t tail;
+        size_t len;
+        bool done;
+
+        // Must be loaded before `head` so no record pushed before the end of the trace is missed.
+        done = atomic_load_explicit(&writer->done, memory_order_acquire);
+        head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+        if (head == tail) {
+            if (done) {
+                break;
+            }
+
+            hs_usleep(1000);
+            continue;
+        }
+
+        // Write all the contiguous records at once.
+        len = min(head - tail, TRACE_RING_LEN - tail % TRACE_RING_LEN);
+
+        // Keep draining the ring after a failure, or the emulation thread would wait forever.
+        if (!writer->failed && archive_write_data(writer->archive, &ring->records[tail % TRACE_RING_LEN], len * sizeof(struct trace_record)) < 0) {
+            writer->failed = true;
+        }
+
+        writer->records += len;
+        atomic_store_explicit(&ring->tail, tail + len, memory_order_release);
+    }
+
+    return (NULL);
+}
+
+static
+void
+debugger_cmd_trace_binary(
+    struct app *app,
+    size_t count,
+    char const *path,
+    bool mem
+) {
+    struct trace_writer writer;
+    struct archive_entry *entry;
+    pthread_t thread;
+
+    memset(&writer, 0, sizeof(writer));
+
+    writer.ring = calloc(1, sizeof(struct trace_ring));
+    hs_assert(writer.ring);
+
+    writer.archive = archive_write_new();
+    hs_assert(writer.archive);
+
+    // The fastest compression level, so the writer keeps up with the emulation thread.
+    archive_write_add_filter_gzip(writer.archive);
+    archive_write_set_filter_option(writer.archive, "gzip", "compression-level", "1");
+    archive_write_set_format_raw(writer.archive);
+
+    if (archive_write_open_filename(writer.archive, path) != ARCHIVE_OK) {
+        printf("Failed to open %s: %s.\n", path, archive_error_string(writer.archive));
+        goto cleanup;
+    }
+
+    entry = archive_entry_new();
+    hs_assert(entry);
+    archive_entry_set_filetype(entry, AE_IFREG);
+    archive_entry_set_pathname(entry, "trace");
+
+    if (
+           archive_write_header(writer.archive, entry) != ARCHIVE_OK
+        || archive_write_data(writer.archive, TRACE_FILE_MAGIC, strlen(TRACE_FILE_MAGIC)) < 0
+    ) {
+        printf("Failed to write %s: %s.\n", path, archive_error_string(writer.archive));
+        archive_entry_free(entry);
+        goto cleanup;
+    }
+
+    archive_entry_free(entry);
+
+    if (pthread_create(&thread, NULL, debugger_trace_writer, &writer)) {
+        printf("Failed to start the writer of %s.\n", path);
+        goto cleanup;
+    }
+
+    app_emulator_trace_binary(app, count, writer.ring, mem);
+    debugger_wait_for_emulator(app);
+
+    atomic_store_explicit(&writer.done, true, memory_order_release);
+    pthread_join(thread, NULL);
+
+    if (writer.failed || archive_write_close(writer.archive) != ARCHIVE_OK) {
+        printf("Failed to write %s: %s.\n", path, archive_error_string(writer.archive));
+    } else {
+        printf(
+            "Trace of %s%zu%s records written to %s%s%s.\n",
+            g_light_magenta,
+            writer.records,
+            g_reset,
+            g_light_green,
+            path,
+            g_reset
+        );
+    }
+
+cleanup:
+    archive_write_free(writer.archive);
+    free(writer.ring);
+}
 
 void
 debugger_cmd_trace(
@@ -36,6 +175,21 @@ debugger_cmd_trace(
         app_emulator_trace(app, argv[0].value.i64, debugger_dump_context_compact);
         debugger_wait_for_emulator(app);
         debugger_dump_context_compact_header();
+    } else if (argc == 2 || argc == 3) {
+        if (
+               debugger_check_arg_type(CMD_TRACE, &argv[0], ARGS_INTEGER)
+            || debugger_check_arg_type(CMD_TRACE, &argv[1], ARGS_STRING)
+            || (argc == 3 && debugger_check_arg_type(CMD_TRACE, &argv[2], ARGS_STRING))
+        ) {
+            return ;
+        }
+
+        if (argc == 3 && strcmp(argv[2].value.s, "mem")) {
+            printf("Usage: %s\n", g_commands[CMD_TRACE].usage);
+            return ;
+        }
+
+        debugger_cmd_trace_binary(app, argv[0].value.i64, argv[1].value.s, argc == 3);
     } else {
         printf("Usage: %s\n", g_commands[CMD_TRACE].usage);
         return ;
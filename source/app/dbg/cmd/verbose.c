@@ -33,6 +33,8 @@ struct verbosity_arg verbosities[] = {
     { "timer",      g_verbose + HS_TIMER    },
     { "debug",      g_verbose + HS_DEBUG    },
 
+    { "ring",       &g_log_ring_enabled     },
+
     { NULL,         NULL                    },
 };
 
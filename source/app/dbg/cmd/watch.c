@@ -18,31 +18,63 @@ debugger_cmd_watch(
     size_t argc,
     struct arg const *argv
 ) {
+    struct condition const *cond;
+
     if (argc == 0) {
         if (app->debugger.watchpoints_len) {
             size_t i;
 
             printf("Watchpoints:\n");
             for (i = 0; i < app->debugger.watchpoints_len; ++i) {
+                struct watchpoint const *wp;
+
+                wp = &app->debugger.watchpoints[i];
                 printf(
-                    "  %s%2zi%s: %s0x%08x%s\n",
+                    "  %s%2zi%s: %s0x%08x%s (%s%s%s, %u byte%s",
                     g_light_green,
                     i + 1,
                     g_reset,
                     g_light_magenta,
-                    app->debugger.watchpoints[i].ptr,
-                    g_reset
+                    wp->ptr,
+                    g_reset,
+                    g_light_green,
+                    wp->write ? "write" : "read",
+                    g_reset,
+                    wp->size,
+                    wp->size > 1 ? "s" : ""
                 );
+
+                if (wp->match_value) {
+                    printf(", value %s0x%08x%s", g_light_magenta, wp->value, g_reset);
+                }
+
+                if (wp->cond.len) {
+                    printf(", conditional");
+                }
+
+                printf(")\n");
             }
         } else {
             printf("There's no watchpoint.\n");
         }
-    } else if (argc == 2) {
+        return ;
+    }
+
+    // The condition is always the last argument.
+    cond = NULL;
+    if (argv[argc - 1].type == ARGS_CONDITION) {
+        cond = &argv[argc - 1].value.cond;
+        --argc;
+    }
+
+    if (argc >= 2 && argc <= 4) {
         bool read;
         bool write;
 
         if (debugger_check_arg_type(CMD_WATCH, &argv[0], ARGS_STRING)
             || debugger_check_arg_type(CMD_WATCH, &argv[1], ARGS_INTEGER)
+            || (argc >= 3 && debugger_check_arg_type(CMD_WATCH, &argv[2], ARGS_INTEGER))
+            || (argc >= 4 && debugger_check_arg_type(CMD_WATCH, &argv[3], ARGS_INTEGER))
         ) {
             printf("Usage: %s\n", g_commands[CMD_WATCH].usage);
             return ;
@@ -51,14 +83,26 @@ debugger_cmd_watch(
         read = !strcmp(argv[0].value.s, "read") || !strcmp(argv[0].value.s, "r");
         write = !strcmp(argv[0].value.s, "write") || !strcmp(argv[0].value.s, "w");
 
-        if (read || write) {
+        if ((read || write) && !(read && argc == 4)) {
+            struct watchpoint *wp;
+
             app->debugger.watchpoints = realloc(
                 app->debugger.watchpoints,
                 sizeof(struct watchpoint) * (app->debugger.watchpoints_len + 1)
             );
+            hs_assert(app->debugger.watchpoints);
 
-            app->debugger.watchpoints[app->debugger.watchpoints_len].ptr = argv[1].value.i64;
-            app->debugger.watchpoints[app->debugger.watchpoints_len].write = write;
+            wp = &app->debugger.watchpoints[app->debugger.watchpoints_len];
+            wp->ptr = argv[1].value.i64;
+            wp->size = argc >= 3 ? max(argv[2].value.i64, 1) : 1;
+            wp->write = write;
+            wp->match_value = argc == 4;
+            wp->value = argc == 4 ? argv[3].value.i64 : 0;
+            if (cond) {
+                wp->cond = *cond;
+            } else {
+                memset(&wp->cond, 0, sizeof(wp->cond));
+            }
             ++app->debugger.watchpoints_len;
 
             printf(
@@ -72,7 +116,7 @@ debugger_cmd_watch(
             );
 
             app_emulator_set_watchpoints_list(app, app->debugger.watchpoints, app->debugger.watchpoints_len);
-        } else if (!strcmp(argv[0].value.s, "delete") || !strcmp(argv[0].value.s, "d")) {
+        } else if (argc == 2 && !cond && (!strcmp(argv[0].value.s, "delete") || !strcmp(argv[0].value.s, "d"))) {
             size_t idx;
 
             idx = argv[1].value.i64;
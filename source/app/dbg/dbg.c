@@ -90,22 +90,22 @@ struct command g_commands[] = {
     [CMD_BREAK] = {
         .name = "break",
         .alias = "b",
-        .usage = "break | break <ADDR> | break delete <ID>",
-        .description = "Add or remove a breakpoint.",
+        .usage = "break | break <ADDR> [if <COND>] | break delete <ID>",
+        .description = "Add or remove a breakpoint. A breakpoint with a condition only triggers when COND holds (eg. \"r0 == 0x1234 && [0x03001000] > 5\").",
         .func = debugger_cmd_break,
     },
     [CMD_WATCH] = {
         .name = "watch",
         .alias = "w",
-        .usage = "watch | watch <read|write> <ADDR> | watch delete <ID>",
-        .description = "Add or remove a watchpoint.",
+        .usage = "watch | watch <read|write> <ADDR> [SIZE] [VALUE] [if <COND>] | watch delete <ID>",
+        .description = "Add or remove a watchpoint. A write watchpoint with a VALUE only triggers when that value is written, and one with a condition only when COND holds.",
         .func = debugger_cmd_watch,
     },
     [CMD_TRACE] = {
         .name = "trace",
         .alias = "t",
-        .usage = "trace [N=1]",
-        .description = "Execute the next N instructions, dumping the content of all registers in between them.",
+        .usage = "trace [N=1] | trace <N> <FILE> [mem]",
+        .description = "Execute the next N instructions, dumping the content of all registers in between them. If a FILE is given, a compressed binary trace (including the memory accesses with \"mem\") is written to it instead, to be read with hades-trace.",
         .func = debugger_cmd_trace,
     },
     [CMD_VERBOSE] = {
@@ -150,6 +150,13 @@ struct command g_commands[] = {
         .description = "Store a screenshot of the screen in FILE.",
         .func = debugger_cmd_screenshot
     },
+    [CMD_LOG] = {
+        .name = "log",
+        .alias = NULL,
+        .usage = "log [clear]",
+        .description = "Print the last events recorded in the log ring (see \"verbose ring\"), or clear it.",
+        .func = debugger_cmd_log,
+    },
     {
         .name = NULL,
     }
@@ -250,12 +257,12 @@ debugger_process_all_notifs(
     {
         struct event_header const *event;
 
-        event = channel_next(channel, NULL);
+        event = channel_peek(channel);
         while (event) {
             debugger_process_notif(app, (struct notification const *)event);
-            event = channel_next(channel, event);
+            channel_pop(channel);
+            event = channel_peek(channel);
         }
-        channel_clear(channel);
     }
     channel_release(channel);
 }
@@ -279,15 +286,14 @@ debugger_wait_for_notif(
     while (!ok) {
         struct event_header const *event;
 
-        event = channel_next(channel, NULL);
+        event = channel_peek(channel);
         while (event) {
             debugger_process_notif(app, (struct notification const *)event);
             ok = (event->kind == kind);
-            event = channel_next(channel, event);
+            channel_pop(channel);
+            event = channel_peek(channel);
         }
 
-        channel_clear(channel);
-
         if (!ok) {
             channel_wait(channel);
         }
@@ -317,7 +323,7 @@ debugger_wait_for_emulator(
     while (state != GBA_STATE_PAUSE) {
         struct event_header const *event;
 
-        event = channel_next(channel, NULL);
+        event = channel_peek(channel);
         while (event) {
             debugger_process_notif(app, (struct notification const *)event);
 
@@ -327,11 +333,10 @@ debugger_wait_for_emulator(
                 state = GBA_STATE_PAUSE;
             }
 
-            event = channel_next(channel, event);
+            channel_pop(channel);
+            event = channel_peek(channel);
         }
 
-        channel_clear(channel);
-
         if (state != GBA_STATE_PAUSE) {
             channel_wait(channel);
         }
@@ -340,6 +345,25 @@ debugger_wait_for_emulator(
     channel_release(channel);
 }
 
+/*
+** Free the arguments built by `debugger_run_command()`.
+*/
+static
+void
+debugger_free_args(
+    struct arg *args,
+    size_t len
+) {
+    size_t i;
+
+    for (i = 0; i < len; ++i) {
+        if (args[i].type == ARGS_STRING) {
+            free((char *)args[i].value.s);
+        }
+    }
+    free(args);
+}
+
 static
 void
 debugger_run_command(
@@ -349,18 +373,29 @@ debugger_run_command(
 ) {
     struct arg *args;
     size_t len;
+    bool condition;
 
     args = NULL;
     len = 0;
+    condition = false;
 
     // Consume arguments to produce AST nodes
     while (ast->token) {
 
+        // The keyword `if` isn't an argument, it marks the next one as a condition.
+        if (!condition && ast->token->kind == TOKEN_IDENTIFIER && !strcmp(ast->token->value.identifier, "if")) {
+            ast->token = ast->token->next;
+            condition = true;
+            continue;
+        }
+
+        // The arguments don't point to the AST they were built from, so the previous one can go.
+        debugger_lang_cleanup_node(ast->root);
         debugger_lang_parse(ast, ast->token);
 
         if (ast->error) {
             printf("Error: %s.\n", ast->error);
-            // TODO FIXME free stuff
+            debugger_free_args(args, len);
             return ;
         }
 
@@ -368,8 +403,25 @@ debugger_run_command(
         hs_assert(args);
         ++len;
 
-        // A string is a unique NODE_VARIABLE that doesn't match any variable
-        if (ast->root->kind == NODE_VARIABLE && !debugger_lang_variables_lookup(app, ast->root->value.identifier)) {
+        if (condition) {
+            struct eval eval;
+
+            memset(&eval, 0, sizeof(eval));
+
+            // Not a string yet, so `debugger_free_args()` skips it if the compilation fails.
+            args[len - 1].type = ARGS_CONDITION;
+            debugger_lang_compile(&eval, app, ast, &args[len - 1].value.cond);
+
+            if (eval.error) {
+                printf("Error: %s.\n", eval.error);
+                free(eval.error);
+                debugger_free_args(args, len);
+                return ;
+            }
+
+            condition = false;
+        } else if (ast->root->kind == NODE_VARIABLE && !debugger_lang_variables_lookup(app, ast->root->value.identifier)) {
+            // A string is a unique NODE_VARIABLE that doesn't match any variable
             args[len - 1].type = ARGS_STRING;
             args[len - 1].value.s = strdup(ast->root->value.identifier);
         } else {
@@ -377,19 +429,25 @@ debugger_run_command(
 
             memset(&eval, 0, sizeof(eval));
 
+            // Not a string yet, so `debugger_free_args()` skips it if the evaluation fails.
+            args[len - 1].type = ARGS_INTEGER;
             debugger_lang_eval(&eval, app, ast);
 
             if (eval.error) {
                 printf("Error: %s.\n", eval.error);
-                // TODO FIXME free stuff
+                free(eval.error);
+                debugger_free_args(args, len);
                 return ;
             }
 
-            args[len - 1].type = ARGS_INTEGER;
             args[len - 1].value.i64 = eval.res;
         }
+    }
 
-        // TODO FIXME free stuff
+    if (condition) {
+        printf("Error: Missing condition after \"if\".\n");
+        debugger_free_args(args, len);
+        return ;
     }
 
     // Ensure the state of `is_running` and `is_started` is as up-to-date as possible.
@@ -397,6 +455,8 @@ debugger_run_command(
 
     // Call the command.
     cmd->func(app, len, args);
+
+    debugger_free_args(args, len);
 }
 
 void
@@ -548,6 +608,9 @@ cleanup:
 
     app->run = false;
 
+    // Wake up the main thread if it's sleeping while waiting for notifications.
+    channel_interrupt(&app->emulation.gba->channels.notifications);
+
     cs_close(&app->debugger.handle_arm);
     cs_close(&app->debugger.handle_thumb);
 }
@@ -0,0 +1,156 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** Compile an expression into the bytecode of a breakpoint's or a watchpoint's condition
+** (see `struct condition`), so it can be evaluated by the emulation thread.
+**
+** The registers are compiled to a lookup of the register and the constant variables to
+** their value. Assignments aren't allowed.
+*/
+
+#define _GNU_SOURCE
+
+#include <string.h>
+#include "hades.h"
+#include "app/app.h"
+#include "app/dbg.h"
+#include "app/lang.h"
+
+static
+void
+debugger_lang_compile_emit(
+    struct eval *eval,
+    struct condition *cond,
+    uint8_t op,
+    uint32_t arg
+) {
+    if (cond->len >= CONDITION_MAX_LEN) {
+        if (!eval->error) {
+            eval->error = strdup("The condition is too long");
+        }
+        return ;
+    }
+
+    cond->code[cond->len].op = op;
+    cond->code[cond->len].arg = arg;
+    ++cond->len;
+}
+
+/*
+** Compile the given node and return the depth of the stack it needs.
+*/
+static
+size_t
+debugger_lang_compile_node(
+    struct eval *eval,
+    struct app *app,
+    struct node const *node,
+    struct condition *cond
+) {
+    switch (node->kind) {
+        case NODE_LITTERAL: {
+            debugger_lang_compile_emit(eval, cond, CONDITION_OP_PUSH, node->value.litteral);
+            return (1);
+        };
+        case NODE_VARIABLE: {
+            struct variable *variable;
+            uint32_t const *registers;
+
+            variable = debugger_lang_variables_lookup(app, node->value.identifier);
+            if (!variable) {
+                free(eval->error);
+                eval->error = hs_format("Undefined variable \"%s\"", node->value.identifier);
+                return (0);
+            }
+
+            if (!variable->mutable) {
+                debugger_lang_compile_emit(eval, cond, CONDITION_OP_PUSH, variable->val);
+                return (1);
+            }
+
+            // The only mutable variables are the registers.
+            registers = app->emulation.gba->core.registers;
+            hs_assert(variable->ptr >= registers && variable->ptr <= registers + REGISTER_R15);
+
+            debugger_lang_compile_emit(eval, cond, CONDITION_OP_REG, variable->ptr - registers);
+            return (1);
+        };
+        case NODE_DEREF: {
+            size_t depth;
+
+            depth = debugger_lang_compile_node(eval, app, node->rhs, cond);
+            debugger_lang_compile_emit(eval, cond, CONDITION_OP_LOAD32, 0);
+            return (depth);
+        };
+        case NODE_OP_UNARY: {
+            size_t depth;
+
+            depth = debugger_lang_compile_node(eval, app, node->rhs, cond);
+            if (node->value.operator == OP_UNARY_MINUS) {
+                debugger_lang_compile_emit(eval, cond, CONDITION_OP_NEG, 0);
+            }
+            return (depth);
+        };
+        case NODE_OP_BINARY: {
+            size_t lhs_depth;
+            size_t rhs_depth;
+            uint8_t op;
+
+            switch (node->value.operator) {
+                case OP_BINARY_ADD: op = CONDITION_OP_ADD; break;
+                case OP_BINARY_SUB: op = CONDITION_OP_SUB; break;
+                case OP_BINARY_MUL: op = CONDITION_OP_MUL; break;
+                case OP_BINARY_DIV: op = CONDITION_OP_DIV; break;
+                case OP_BINARY_EQ:  op = CONDITION_OP_EQ; break;
+                case OP_BINARY_NE:  op = CONDITION_OP_NE; break;
+                case OP_BINARY_LT:  op = CONDITION_OP_LT; break;
+                case OP_BINARY_LE:  op = CONDITION_OP_LE; break;
+                case OP_BINARY_GT:  op = CONDITION_OP_GT; break;
+                case OP_BINARY_GE:  op = CONDITION_OP_GE; break;
+                case OP_BINARY_AND: op = CONDITION_OP_AND; break;
+                case OP_BINARY_OR:  op = CONDITION_OP_OR; break;
+                default: {
+                    free(eval->error);
+                    eval->error = hs_format("Operator \"%s\" isn't allowed in a condition", operator_name[node->value.operator]);
+                    return (0);
+                };
+            }
+
+            lhs_depth = debugger_lang_compile_node(eval, app, node->lhs, cond);
+            rhs_depth = debugger_lang_compile_node(eval, app, node->rhs, cond);
+            debugger_lang_compile_emit(eval, cond, op, 0);
+
+            // The result of the LHS stays on the stack while the RHS is evaluated.
+            return (max(lhs_depth, rhs_depth + 1));
+        };
+        default: panic(HS_DEBUG, "Unknown kind of node %i.", node->kind);
+    }
+}
+
+void
+debugger_lang_compile(
+    struct eval *eval,
+    struct app *app,
+    struct ast const *ast,
+    struct condition *cond
+) {
+    size_t depth;
+
+    memset(cond, 0, sizeof(*cond));
+    depth = debugger_lang_compile_node(eval, app, ast->root, cond);
+
+    if (!eval->error && depth > CONDITION_STACK_LEN) {
+        eval->error = strdup("The condition is too complex");
+    }
+
+    if (eval->error) {
+        cond->len = 0;
+    }
+}
@@ -41,6 +41,9 @@ debugger_lang_eval_node(
                 return (variable->val);
             }
         };
+        case NODE_DEREF: {
+            return (mem_read32_raw(app->emulation.gba, debugger_lang_eval_node(eval, app, node->rhs)));
+        };
         case NODE_OP_UNARY: {
             switch (node->value.operator) {
                 case OP_UNARY_MINUS: return (-(debugger_lang_eval_node(eval, app, node->rhs)));
@@ -86,6 +89,14 @@ debugger_lang_eval_node(
                 case OP_BINARY_SUB: return (debugger_lang_eval_node(eval, app, node->lhs) - debugger_lang_eval_node(eval, app, node->rhs));
                 case OP_BINARY_MUL: return (debugger_lang_eval_node(eval, app, node->lhs) * debugger_lang_eval_node(eval, app, node->rhs));
                 case OP_BINARY_DIV: return (debugger_lang_eval_node(eval, app, node->lhs) / debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_EQ: return (debugger_lang_eval_node(eval, app, node->lhs) == debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_NE: return (debugger_lang_eval_node(eval, app, node->lhs) != debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_LT: return (debugger_lang_eval_node(eval, app, node->lhs) < debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_LE: return (debugger_lang_eval_node(eval, app, node->lhs) <= debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_GT: return (debugger_lang_eval_node(eval, app, node->lhs) > debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_GE: return (debugger_lang_eval_node(eval, app, node->lhs) >= debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_AND: return (debugger_lang_eval_node(eval, app, node->lhs) && debugger_lang_eval_node(eval, app, node->rhs));
+                case OP_BINARY_OR: return (debugger_lang_eval_node(eval, app, node->lhs) || debugger_lang_eval_node(eval, app, node->rhs));
                 default: panic(HS_DEBUG, "Unknown binary operator %i.", node->value.operator);
             }
         };
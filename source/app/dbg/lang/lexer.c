@@ -151,10 +151,54 @@ debugger_lang_lexe(
                 break;
             };
             case '=': {
-                token_new_op(lexer, OP_BINARY_ASSIGN);
+                if (input[i + 1] == '=') {
+                    token_new_op(lexer, OP_BINARY_EQ);
+                    ++i;
+                } else {
+                    token_new_op(lexer, OP_BINARY_ASSIGN);
+                }
+                ++i;
+                break;
+            };
+            case '!': {
+                if (input[i + 1] != '=') {
+                    lexer->error = hs_format("Invalid character \'%c\'", input[i]);
+                    return ;
+                }
+                token_new_op(lexer, OP_BINARY_NE);
+                i += 2;
+                break;
+            };
+            case '<': {
+                if (input[i + 1] == '=') {
+                    token_new_op(lexer, OP_BINARY_LE);
+                    ++i;
+                } else {
+                    token_new_op(lexer, OP_BINARY_LT);
+                }
+                ++i;
+                break;
+            };
+            case '>': {
+                if (input[i + 1] == '=') {
+                    token_new_op(lexer, OP_BINARY_GE);
+                    ++i;
+                } else {
+                    token_new_op(lexer, OP_BINARY_GT);
+                }
                 ++i;
                 break;
             };
+            case '&':
+            case '|': {
+                if (input[i + 1] != input[i]) {
+                    lexer->error = hs_format("Invalid character \'%c\'", input[i]);
+                    return ;
+                }
+                token_new_op(lexer, input[i] == '&' ? OP_BINARY_AND : OP_BINARY_OR);
+                i += 2;
+                break;
+            };
             case '(': {
                 token_new(lexer, TOKEN_OPEN_PARENTHESIS);
                 ++i;
@@ -165,6 +209,16 @@ debugger_lang_lexe(
                 ++i;
                 break;
             };
+            case '[': {
+                token_new(lexer, TOKEN_OPEN_BRACKET);
+                ++i;
+                break;
+            };
+            case ']': {
+                token_new(lexer, TOKEN_CLOSE_BRACKET);
+                ++i;
+                break;
+            };
             case ' ':
             case '\r':
             case '\n':
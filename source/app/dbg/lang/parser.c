@@ -79,6 +79,29 @@ debugger_lang_parse_value(
 
         ast->token = token->next; // Eat ')'
         return (content);
+    } else if (token->kind == TOKEN_OPEN_BRACKET) {
+        struct node *node;
+
+        ast->token = token->next; // Eat '['
+        node = node_new(NODE_DEREF);
+        node->rhs = debugger_lang_parse_expr(ast);
+        token = ast->token;
+
+        if (!node->rhs) {
+            free(ast->error);
+            ast->error = strdup("Brackets have no content");
+            free(node);
+            return (NULL);
+        }
+
+        if (!token || token->kind != TOKEN_CLOSE_BRACKET) {
+            free(ast->error);
+            ast->error = strdup("Missing closing bracket");
+            return (node);
+        }
+
+        ast->token = token->next; // Eat ']'
+        return (node);
     } else if (token->kind == TOKEN_IDENTIFIER) {
         struct node *node;
 
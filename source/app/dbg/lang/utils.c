@@ -18,6 +18,18 @@ int operator_binary_prio[] = {
     [OP_BINARY_MULASSIGN]   = 10,
     [OP_BINARY_DIVASSIGN]   = 10,
 
+    [OP_BINARY_OR]          = 12,
+
+    [OP_BINARY_AND]         = 14,
+
+    [OP_BINARY_EQ]          = 16,
+    [OP_BINARY_NE]          = 16,
+
+    [OP_BINARY_LT]          = 18,
+    [OP_BINARY_LE]          = 18,
+    [OP_BINARY_GT]          = 18,
+    [OP_BINARY_GE]          = 18,
+
     [OP_BINARY_ADD]         = 20,
     [OP_BINARY_SUB]         = 20,
 
@@ -38,6 +50,14 @@ char *operator_name[] = {
     [OP_BINARY_SUB]         = "-",
     [OP_BINARY_MUL]         = "*",
     [OP_BINARY_DIV]         = "/",
+    [OP_BINARY_EQ]          = "==",
+    [OP_BINARY_NE]          = "!=",
+    [OP_BINARY_LT]          = "<",
+    [OP_BINARY_LE]          = "<=",
+    [OP_BINARY_GT]          = ">",
+    [OP_BINARY_GE]          = ">=",
+    [OP_BINARY_AND]         = "&&",
+    [OP_BINARY_OR]          = "||",
 };
 
 void
@@ -70,6 +90,14 @@ debugger_lang_dump_lexer(
                 printf("Close Parenthesis");
                 break;
             };
+            case TOKEN_OPEN_BRACKET: {
+                printf("Open Bracket");
+                break;
+            };
+            case TOKEN_CLOSE_BRACKET: {
+                printf("Close Bracket");
+                break;
+            };
         }
         printf(" }\n");
         token = token->next;
@@ -102,6 +130,17 @@ debugger_lang_dump_ast_raw(
             printf("Node { Variable (%s) }\n", node->value.identifier);
             break;
         };
+        case NODE_DEREF: {
+            printf("Node {\n");
+
+            debugger_lang_dump_ast_indentation(indent + 1);
+            printf("Dereference: ");
+            debugger_lang_dump_ast_raw(node->rhs, indent + 1);
+
+            debugger_lang_dump_ast_indentation(indent);
+            printf("}\n");
+            break;
+        };
         case NODE_OP_UNARY: {
             printf("Node {\n");
 
@@ -145,7 +184,6 @@ debugger_lang_dump_ast(
     debugger_lang_dump_ast_raw(ast->root, 0);
 }
 
-static
 void
 debugger_lang_cleanup_node(
     struct node *node
@@ -159,6 +197,7 @@ debugger_lang_cleanup_node(
             free(node->value.identifier);
             break;
         };
+        case NODE_DEREF:
         case NODE_OP_UNARY: {
             debugger_lang_cleanup_node(node->rhs);
             break;
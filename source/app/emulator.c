@@ -8,13 +8,10 @@
 \******************************************************************************/
 
 #define _GNU_SOURCE
-#define STB_IMAGE_WRITE_IMPLEMENTATION
 
-#include <archive.h>
-#include <archive_entry.h>
-#include <stb_image_write.h>
 #include <errno.h>
 #include "app/app.h"
+#include "app/loader.h"
 #include "gba/gba.h"
 #include "gba/event.h"
 #include "compat.h"
@@ -55,48 +52,23 @@ app_emulator_process_notif(
         };
         case NOTIFICATION_QUICKSAVE: {
             struct notification_quicksave *qsave;
-            char const *path;
-            FILE *file;
 
             qsave = (struct notification_quicksave *)notif;
 
             hs_assert(app->emulation.quicksave_request.enabled);
-            path = app->file.qsaves[app->emulation.quicksave_request.idx].path;
 
-            file = hs_fopen(path, "wb+");
-            if (!file) {
-                goto qsave_err;
-            }
-
-            if (fwrite(qsave->data, qsave->size, 1, file) != 1) {
-                goto qsave_err;
-            }
-
-            app_new_notification(
-                app,
-                UI_NOTIFICATION_SUCCESS,
-                "Game state saved."
-            );
-
-            goto qsave_finally;
-
-qsave_err:
-            app_new_notification(
+            // The save state is written in the background, which takes ownership of its data.
+            app_io_push(
                 app,
-                UI_NOTIFICATION_ERROR,
-                "Failed to save game state: %s.",
-                strerror(errno)
+                IO_JOB_QUICKSAVE,
+                app->file.qsaves[app->emulation.quicksave_request.idx].path,
+                qsave->data,
+                qsave->size
             );
+            qsave->data = NULL;
 
-qsave_finally:
             app->emulation.quicksave_request.enabled = false;
             app->emulation.quicksave_request.idx = 0;
-            app->file.flush_qsaves_cache = true;
-
-            if (file) {
-                fclose(file);
-            }
-
             break;
         };
         case NOTIFICATION_QUICKLOAD: {
@@ -129,12 +101,12 @@ app_emulator_process_all_notifs(
 
     channel_lock(channel);
     {
-        event = channel_next(channel, NULL);
+        event = channel_peek(channel);
         while (event) {
             app_emulator_process_notif(app, event);
-            event = channel_next(channel, event);
+            channel_pop(channel);
+            event = channel_peek(channel);
         }
-        channel_clear(channel);
     }
     channel_release(channel);
 }
@@ -155,15 +127,14 @@ app_emulator_wait_for_notif(
     while (!ok) {
         struct event_header const *event;
 
-        event = channel_next(channel, NULL);
+        event = channel_peek(channel);
         while (event) {
             app_emulator_process_notif(app, event);
             ok = (event->kind == kind);
-            event = channel_next(channel, event);
+            channel_pop(channel);
+            event = channel_peek(channel);
         }
 
-        channel_clear(channel);
-
         if (!ok) {
             channel_wait(channel);
         }
@@ -172,11 +143,175 @@ app_emulator_wait_for_notif(
     channel_release(channel);
 }
 
+/*
+** Write the blocks of the backup storage that were modified since the last call on the disk.
+**
+** Consecutive blocks are written at once, and the file is synced only if something was written.
+*/
+static
+void
+app_emulator_flush_backup(
+    struct app *app
+) {
+    struct shared_data *shared_data;
+    bool written;
+    size_t i;
+
+    shared_data = &app->emulation.gba->shared_data;
+
+    if (!app->emulation.backup_file || !shared_data->backup_storage.data) {
+        return ;
+    }
+
+    written = false;
+    for (i = 0; i < BACKUP_STORAGE_DIRTY_LEN; ++i) {
+        uint64_t bits;
+
+        bits = atomic_exchange(&shared_data->backup_storage.dirty[i], 0);
+        while (bits) {
+            size_t first;
+            size_t count;
+            size_t offset;
+            size_t len;
+
+            // Find the first run of consecutive dirty blocks
+            first = __builtin_ctzll(bits);
+            count = ~(bits >> first) ? __builtin_ctzll(~(bits >> first)) : 64;
+            offset = (i * 64 + first) * BACKUP_STORAGE_BLOCK_SIZE;
+
+            if (count == 64) {
+                bits = 0;
+            } else {
+                bits &= ~(((UINT64_C(1) << count) - 1) << first);
+            }
+
+            if (offset >= shared_data->backup_storage.size) {
+                break;
+            }
+
+            len = min(count * BACKUP_STORAGE_BLOCK_SIZE, shared_data->backup_storage.size - offset);
+
+            if (hs_pwrite(app->emulation.backup_file, shared_data->backup_storage.data + offset, len, offset)) {
+                logln(HS_WARNING, "Failed to write the save file: %s.", strerror(errno));
+
+                // Try again next time
+                mem_backup_storage_mark_dirty(app->emulation.gba, offset, len);
+            }
+            written = true;
+        }
+    }
+
+    if (written) {
+        hs_fsync(app->emulation.backup_file);
+    }
+}
+
+/*
+** The backup writer thread, writing the backup storage on the disk every time
+** `app_emulator_update_backup()` is called, so the UI thread never waits for the disk.
+*/
+static
+void *
+app_emulator_backup_writer(
+    void *raw_app
+) {
+    struct app *app;
+    struct backup_writer *writer;
+
+    app = raw_app;
+    writer = &app->emulation.backup_writer;
+
+    pthread_mutex_lock(&writer->lock);
+    while (!writer->exit) {
+        if (writer->flush) {
+            writer->flush = false;
+            pthread_mutex_unlock(&writer->lock);
+            app_emulator_flush_backup(app);
+            pthread_mutex_lock(&writer->lock);
+        } else {
+            pthread_cond_wait(&writer->ready, &writer->lock);
+        }
+    }
+    pthread_mutex_unlock(&writer->lock);
+    return (NULL);
+}
+
+/*
+** Start the backup writer.
+**
+** Must be called once the emulator is reset, when the size of the backup storage is known.
+*/
+static
+void
+app_emulator_start_backup_writer(
+    struct app *app
+) {
+    struct backup_writer *writer;
+    size_t size;
+
+    writer = &app->emulation.backup_writer;
+    size = app->emulation.gba->shared_data.backup_storage.size;
+
+    if (!app->emulation.backup_file || !size) {
+        return ;
+    }
+
+    // Only the modified blocks are written, so a new or truncated file must be written entirely first.
+    fseek(app->emulation.backup_file, 0, SEEK_END);
+    if ((size_t)ftell(app->emulation.backup_file) < size) {
+        mem_backup_storage_mark_dirty(app->emulation.gba, 0, size);
+    }
+
+    writer->exit = false;
+    writer->flush = false;
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->ready, NULL);
+    pthread_create(&writer->thread, NULL, app_emulator_backup_writer, app);
+    writer->running = true;
+}
+
+/*
+** Stop the backup writer, write what remains of the backup storage and close the save file.
+**
+** Must be called before the emulator is reset or stopped, since that frees the backup storage.
+*/
+void
+app_emulator_close_backup(
+    struct app *app
+) {
+    struct backup_writer *writer;
+
+    writer = &app->emulation.backup_writer;
+
+    if (writer->running) {
+        pthread_mutex_lock(&writer->lock);
+        writer->exit = true;
+        pthread_cond_signal(&writer->ready);
+        pthread_mutex_unlock(&writer->lock);
+
+        pthread_join(writer->thread, NULL);
+        pthread_cond_destroy(&writer->ready);
+        pthread_mutex_destroy(&writer->lock);
+        writer->running = false;
+
+        app_emulator_flush_backup(app);
+    }
+
+    if (app->emulation.backup_file) {
+        fclose(app->emulation.backup_file);
+        app->emulation.backup_file = NULL;
+    }
+}
+
 static
 void
 app_emulator_unconfigure(
     struct app *app
 ) {
+    // Finish writing the pending save states and screenshots of the current game.
+    app_io_wait(app);
+    app_io_process_done(app);
+
     if (app->emulation.launch_config) {
         free(app->emulation.launch_config->bios.data);
         free(app->emulation.launch_config->rom.data);
@@ -184,10 +319,7 @@ app_emulator_unconfigure(
         app->emulation.launch_config = NULL;
     }
 
-    if (app->emulation.backup_file) {
-        fclose(app->emulation.backup_file);
-        app->emulation.backup_file = NULL;
-    }
+    app_emulator_close_backup(app);
 
     if (app->emulation.game_entry) {
         free(app->emulation.game_entry);
@@ -206,205 +338,50 @@ app_emulator_configure_bios(
     struct app *app
 ) {
     char const *bios_path;
-    FILE *file;
-    void *data;
+    char *err;
 
     bios_path = app->args.bios_path ?: app->file.bios_path;
-    if (!bios_path) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "No BIOS found.\nPlease download and select a valid Nintendo GBA Bios using \"File\" -> \"Open BIOS\"."
-        );
-        return (true);
-    }
 
-    file = hs_fopen(bios_path, "rb");
-    if (!file) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "Failed to open %s: %s.",
-            bios_path,
-            strerror(errno)
-        );
-        return (true);
+    // The HLE can run without a BIOS, using its stub instead.
+    if (!bios_path && app->emulation.hle_bios) {
+        logln(HS_WARNING, "No BIOS found, running with the high-level emulation of the BIOS only.");
+        return (false);
     }
 
-    fseek(file, 0, SEEK_END);
-    if (ftell(file) != 0x4000) {
+    if (!bios_path) {
         app_new_notification(
             app,
             UI_NOTIFICATION_ERROR,
-            "The BIOS is invalid."
+            "No BIOS found.\nPlease download and select a valid Nintendo GBA Bios using \"File\" -> \"Open BIOS\"."
         );
         return (true);
     }
 
-    rewind(file);
-
-    data = calloc(1, BIOS_SIZE);
-    hs_assert(data);
-
-    if (fread(data, 1, BIOS_SIZE, file) != BIOS_SIZE) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "Failed to read %s: %s.",
-            bios_path,
-            strerror(errno)
-        );
-        free(data);
+    err = app_load_bios(bios_path, &app->emulation.launch_config->bios.data, &app->emulation.launch_config->bios.size);
+    if (err) {
+        app_new_notification(app, UI_NOTIFICATION_ERROR, "%s", err);
+        free(err);
         return (true);
     }
 
-    app->emulation.launch_config->bios.data = data;
-    app->emulation.launch_config->bios.size = BIOS_SIZE;
-
     return (false);
 }
 
-static
-bool
-app_emulator_configure_rom_archive(
-    struct app *app,
-    char const *archive_path
-) {
-    struct archive *archive;
-    struct archive_entry *entry;
-    int err;
-    bool game_found;
-
-    logln(HS_INFO, "Path given identified as an archived.");
-
-    game_found = false;
-    archive = archive_read_new();
-    hs_assert(archive);
-
-    archive_read_support_filter_all(archive);
-    archive_read_support_format_all(archive);
-
-    err = archive_read_open_filename(archive, archive_path, 1024 * 1024); // 1MiB
-    if (err != ARCHIVE_OK) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "Failed to open the path as an archive: %s.",
-            archive_path,
-            archive_error_string(archive)
-        );
-        return (true);
-    }
-
-    while (archive_read_next_header(archive, &entry) == ARCHIVE_OK) {
-        char const *entry_name;
-        char const *ext;
-
-        entry_name = archive_entry_pathname(entry);
-        ext = strrchr(entry_name, '.');
-        if (ext && !strcmp(ext, ".gba")) {
-            size_t file_len;
-            ssize_t read_len;
-            void *data;
-
-            file_len = 0;
-            data = NULL;
-            do {
-                data = realloc(data, file_len + 1024 * 1024); // 1MiB
-                hs_assert(data);
-
-                read_len = archive_read_data(archive, data + file_len, 1024 * 1024); // 1MiB
-                if (read_len < 0) {
-                    app_new_notification(
-                        app,
-                        UI_NOTIFICATION_ERROR,
-                        "Failed to archive's entry %s: %s.",
-                        entry_name,
-                        archive_error_string(archive)
-                    );
-                    free(data);
-                    goto cleanup;
-                }
-                file_len += read_len;
-            } while (read_len > 0);
-
-            game_found = true;
-
-            app->emulation.launch_config->rom.data = data;
-            app->emulation.launch_config->rom.size = file_len;
-
-            goto cleanup;
-        }
-
-        archive_read_data_skip(archive);
-    }
-
-    app_new_notification(
-        app,
-        UI_NOTIFICATION_ERROR,
-        "No valid GBA game found in the archive.",
-        archive_path,
-        archive_error_string(archive)
-    );
-
-cleanup:
-    archive_read_free(archive);
-    return (!game_found);
-}
-
 static
 bool
 app_emulator_configure_rom(
     struct app *app,
     char const *rom_path
 ) {
-    FILE *file;
-    size_t file_len;
-    void *data;
+    char *err;
 
-    file = hs_fopen(rom_path, "rb");
-    if (!file) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "Failed to open %s: %s.",
-            rom_path,
-            strerror(errno)
-        );
-        return (true);
-    }
-
-    fseek(file, 0, SEEK_END);
-    file_len = ftell(file);
-    if (file_len > CART_SIZE || file_len < 192) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "The ROM is invalid."
-        );
+    err = app_load_rom(rom_path, app_path_rom_cache(app), &app->emulation.launch_config->rom.data, &app->emulation.launch_config->rom.size);
+    if (err) {
+        app_new_notification(app, UI_NOTIFICATION_ERROR, "%s", err);
+        free(err);
         return (true);
     }
 
-    rewind(file);
-
-    data = calloc(1, file_len);
-    hs_assert(data);
-
-    if (fread(data, 1, file_len, file) != file_len) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "Failed to read %s: %s.",
-            rom_path,
-            strerror(errno)
-        );
-        free(data);
-        return (true);
-    }
-
-    app->emulation.launch_config->rom.data = data;
-    app->emulation.launch_config->rom.size = file_len;
-
     return (false);
 }
 
@@ -477,10 +454,10 @@ app_emulator_configure(
     struct message_reset event;
     char *backup_path;
     char *extension;
-    bool is_archive;
     size_t basename_len;
     size_t i;
     uint8_t *code;
+    uint32_t crc32;
 
     app_emulator_unconfigure(app);
 
@@ -491,14 +468,10 @@ app_emulator_configure(
 
     extension = strrchr(rom_path, '.');
 
-    // We consider anything that isn't ending with `.gba` or `.bin` as an archive.
-    // XXX: Should we build a hard-coded list instead?
     if (extension) {
         basename_len = extension - rom_path;
-        is_archive = (bool)(strcmp(extension, ".gba") && strcmp(extension, ".bin"));
     } else {
         basename_len = strlen(rom_path);
-        is_archive = false;
     }
 
     for (i = 0; i < MAX_QUICKSAVES; ++i) {
@@ -523,7 +496,7 @@ app_emulator_configure(
     );
 
     if (app_emulator_configure_bios(app)
-        || (is_archive ? app_emulator_configure_rom_archive(app, rom_path) : app_emulator_configure_rom(app, rom_path))
+        || app_emulator_configure_rom(app, rom_path)
         || app_emulator_configure_backup(app, backup_path)
     ) {
         app_emulator_unconfigure(app);
@@ -531,16 +504,20 @@ app_emulator_configure(
     }
 
     code = app->emulation.launch_config->rom.data + 0xAC;
-    app->emulation.game_entry = db_lookup_game(code);
+    crc32 = db_rom_crc32(app->emulation.launch_config->rom.data, app->emulation.launch_config->rom.size);
+    app->emulation.game_entry = db_lookup_game(code, crc32);
 
     if (app->emulation.game_entry) {
         logln(
             HS_INFO,
-            "Game code %s%.3s%s identified as %s%s%s.",
+            "Game code %s%.3s%s (CRC32 %s%08X%s) identified as %s%s%s.",
             g_light_magenta,
             code,
             g_reset,
             g_light_magenta,
+            crc32,
+            g_reset,
+            g_light_magenta,
             app->emulation.game_entry->title,
             g_reset
         );
@@ -558,7 +535,9 @@ app_emulator_configure(
 
     app->emulation.game_path = strdup(rom_path);
     app->emulation.launch_config->skip_bios = app->emulation.skip_bios;
+    app->emulation.launch_config->hle = app->emulation.hle_bios ? HLE_ON : HLE_OFF;
     app->emulation.launch_config->speed = app->emulation.speed;
+    app->emulation.launch_config->audio_sync = app->audio.sync;
     app->emulation.launch_config->audio_frequency = GBA_CYCLES_PER_SECOND / app->audio.resample_frequency;
 
     if (app->emulation.rtc.autodetect) {
@@ -575,9 +554,11 @@ app_emulator_configure(
 
     logln(HS_INFO, "Emulator's configuration:");
     logln(HS_INFO, "    Skip BIOS: %s", app->emulation.launch_config->skip_bios ? "true" : "false");
+    logln(HS_INFO, "    HLE BIOS: %s", app->emulation.launch_config->hle != HLE_OFF ? "true" : "false");
     logln(HS_INFO, "    Backup storage: %s", backup_storage_names[app->emulation.launch_config->backup_storage.type]);
     logln(HS_INFO, "    Rtc: %s", app->emulation.launch_config->rtc ? "true" : "false");
     logln(HS_INFO, "    Speed: %i", app->emulation.speed);
+    logln(HS_INFO, "    Audio Sync: %s", app->audio.sync ? "true" : "false");
     logln(HS_INFO, "    Audio Frequency: %iHz (%i cycles)", app->audio.resample_frequency, app->emulation.launch_config->audio_frequency);
 
     event.header.kind = MESSAGE_RESET;
@@ -591,12 +572,12 @@ app_emulator_configure(
     */
 
     app_emulator_process_all_notifs(app);
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 
     app_emulator_wait_for_notif(app, NOTIFICATION_RESET);
 
+    app_emulator_start_backup_writer(app);
+
     app_config_push_recent_rom(app, rom_path);
 
     logln(HS_INFO, "Game successfully loaded.");
@@ -632,9 +613,7 @@ app_emulator_stop(
     event.header.kind = MESSAGE_STOP;
     event.header.size = sizeof(event);
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -649,9 +628,7 @@ app_emulator_run(
     event.header.kind = MESSAGE_RUN;
     event.header.size = sizeof(event);
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -666,9 +643,7 @@ app_emulator_pause(
     event.header.kind = MESSAGE_PAUSE;
     event.header.size = sizeof(event);
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -683,9 +658,7 @@ app_emulator_exit(
     event.header.kind = MESSAGE_EXIT;
     event.header.size = sizeof(event);
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -704,9 +677,7 @@ app_emulator_key(
     event.key = key;
     event.pressed = pressed;
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -722,73 +693,50 @@ app_emulator_speed(
     event.header.kind = MESSAGE_SPEED;
     event.header.size = sizeof(event);
     event.speed = speed;
+    event.audio_sync = app->audio.sync;
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
-** Write the content of the backup storage on the disk, only if it's dirty.
+** Ask the backup writer to write the modified parts of the backup storage on the disk.
 */
 void
 app_emulator_update_backup(
     struct app *app
 ) {
-    bool dirty;
-
-    dirty = atomic_exchange(&app->emulation.gba->shared_data.backup_storage.dirty, 0);
-    if (dirty
-        && app->emulation.backup_file
-        && app->emulation.gba->shared_data.backup_storage.data
-    ) {
-        fseek(app->emulation.backup_file, 0, SEEK_SET);
-        fwrite(
-            app->emulation.gba->shared_data.backup_storage.data,
-            app->emulation.gba->shared_data.backup_storage.size,
-            1,
-            app->emulation.backup_file
-        );
+    struct backup_writer *writer;
+
+    writer = &app->emulation.backup_writer;
+    if (writer->running) {
+        pthread_mutex_lock(&writer->lock);
+        writer->flush = true;
+        pthread_cond_signal(&writer->ready);
+        pthread_mutex_unlock(&writer->lock);
     }
-    app->emulation.gba->shared_data.backup_storage.dirty = false;
 }
 
 /*
 ** Take a screenshot of the game and writes it to the disk.
+**
+** The framebuffer is copied and the PNG is encoded in the background, so the emulator
+** is only blocked for the duration of the copy.
 */
 void
 app_emulator_screenshot_path(
     struct app *app,
     char const *path
 ) {
-    int out;
+    uint32_t *data;
+
+    data = malloc(sizeof(app->emulation.gba->shared_data.framebuffer.data));
+    hs_assert(data);
 
     pthread_mutex_lock(&app->emulation.gba->shared_data.framebuffer.lock);
-    out = stbi_write_png(
-        path,
-        GBA_SCREEN_WIDTH,
-        GBA_SCREEN_HEIGHT,
-        4,
-        app->emulation.gba->shared_data.framebuffer.data,
-        GBA_SCREEN_WIDTH * sizeof(uint32_t)
-    );
+    memcpy(data, app->emulation.gba->shared_data.framebuffer.data, sizeof(app->emulation.gba->shared_data.framebuffer.data));
     pthread_mutex_unlock(&app->emulation.gba->shared_data.framebuffer.lock);
 
-    if (out) {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_SUCCESS,
-            "Screenshot saved as \"%s\".",
-            path
-        );
-    } else {
-        app_new_notification(
-            app,
-            UI_NOTIFICATION_ERROR,
-            "Failed to save screenshot as \"%s\".",
-            path
-        );
-    }
+    app_io_push(app, IO_JOB_SCREENSHOT, path, data, sizeof(app->emulation.gba->shared_data.framebuffer.data));
 }
 
 /*
@@ -834,76 +782,28 @@ app_emulator_quicksave(
     event.header.kind = MESSAGE_QUICKSAVE;
     event.header.size = sizeof(event);
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
+/*
+** Load the given save state.
+**
+** The file is read in the background and sent to the emulator once it's done.
+*/
 void
 app_emulator_quickload(
     struct app *app,
     size_t idx
 ) {
-    struct message_quickload event;
-
-    char const *path;
-    FILE *file;
-    uint8_t *data;
-    size_t size;
-
     if (app->emulation.quickload_request.enabled) {
         logln(HS_WARNING, "A saved state is already being loaded by the emulator, ignoring the new request.");
         return ;
     }
 
-    data = NULL;
-    path = app->file.qsaves[idx].path;
-
-    file = hs_fopen(path, "rb");
-    if (!file) {
-        goto err;
-    }
-
-    fseek(file, 0, SEEK_END);
-    size = ftell(file);
-    rewind(file);
-
-    data = calloc(1, size);
-    hs_assert(data);
-
-    if (fread(data, size, 1, file) != 1) {
-        goto err;
-    }
-
     app->emulation.quickload_request.enabled = true;
-    app->emulation.quickload_request.data = data;
-
-    event.header.kind = MESSAGE_QUICKLOAD;
-    event.header.size = sizeof(event);
-    event.data = data;
-    event.size = size;
-
-    channel_lock(&app->emulation.gba->channels.messages);
-    channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
-
-    goto finally;
+    app->emulation.quickload_request.data = NULL;
 
-err:
-    app_new_notification(
-        app,
-        UI_NOTIFICATION_ERROR,
-        "Failed to load state from %s: %s",
-        path,
-        strerror(errno)
-    );
-
-    free(data);
-
-finally:
-    if (file) {
-        fclose(file);
-    }
+    app_io_push(app, IO_JOB_QUICKLOAD, app->file.qsaves[idx].path, NULL, 0);
 }
 
 #ifdef WITH_DEBUGGER
@@ -924,9 +824,7 @@ app_emulator_frame(
     event.header.size = sizeof(event);
     event.count = count;
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -945,10 +843,35 @@ app_emulator_trace(
     event.count = count;
     event.tracer_cb = (void (*)(void *))tracer_cb;
     event.arg = app;
+    event.ring = NULL;
+    event.mem = false;
+
+    channel_push(&app->emulation.gba->channels.messages, &event.header);
+}
+
+/*
+** Trace the emulation, pushing a binary record of each instruction to the given ring.
+**
+** The ring must stay valid until the trace is over.
+*/
+void
+app_emulator_trace_binary(
+    struct app *app,
+    size_t count,
+    struct trace_ring *ring,
+    bool mem
+) {
+    struct message_trace event;
+
+    event.header.kind = MESSAGE_TRACE;
+    event.header.size = sizeof(event);
+    event.count = count;
+    event.tracer_cb = NULL;
+    event.arg = NULL;
+    event.ring = ring;
+    event.mem = mem;
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -965,9 +888,7 @@ app_emulator_step_in(
     event.header.size = sizeof(event);
     event.count = count;
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -984,9 +905,7 @@ app_emulator_step_over(
     event.header.size = sizeof(event);
     event.count = count;
 
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
 }
 
 /*
@@ -1011,9 +930,7 @@ app_emulator_set_breakpoints_list(
     */
 
     debugger_process_all_notifs(app);
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
     debugger_wait_for_notif(app, NOTIFICATION_BREAKPOINTS_LIST_SET);
 }
 
@@ -1039,9 +956,7 @@ app_emulator_set_watchpoints_list(
     */
 
     debugger_process_all_notifs(app);
-    channel_lock(&app->emulation.gba->channels.messages);
     channel_push(&app->emulation.gba->channels.messages, &event.header);
-    channel_release(&app->emulation.gba->channels.messages);
     debugger_wait_for_notif(app, NOTIFICATION_WATCHPOINTS_LIST_SET);
 }
 
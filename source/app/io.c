@@ -0,0 +1,410 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** A small pool of threads encoding the screenshots and reading/writing the save states,
+** so the UI thread never waits for the disk.
+**
+** The UI thread queues the jobs with `app_io_push()` and reports their outcome once they
+** are done with `app_io_process_done()`, which is the only place where the UI is updated.
+*/
+
+#define _GNU_SOURCE
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+
+#include <stb_image_write.h>
+#include <errno.h>
+#include "app/app.h"
+#include "gba/event.h"
+#include "compat.h"
+
+static
+void
+app_io_run_job(
+    struct io_job *job
+) {
+    FILE *file;
+
+    errno = 0;
+    switch (job->kind) {
+        case IO_JOB_SCREENSHOT: {
+            if (!stbi_write_png(
+                job->path,
+                GBA_SCREEN_WIDTH,
+                GBA_SCREEN_HEIGHT,
+                4,
+                job->data,
+                GBA_SCREEN_WIDTH * sizeof(uint32_t)
+            )) {
+                job->err = errno ? errno : EIO;
+            }
+            break;
+        };
+        case IO_JOB_QUICKSAVE: {
+            file = hs_fopen(job->path, "wb+");
+            if (!file) {
+                job->err = errno;
+                break;
+            }
+
+            if (fwrite(job->data, job->size, 1, file) != 1) {
+                job->err = errno ? errno : EIO;
+            }
+
+            if (fclose(file) && !job->err) {
+                job->err = errno;
+            }
+            break;
+        };
+        case IO_JOB_QUICKLOAD: {
+            file = hs_fopen(job->path, "rb");
+            if (!file) {
+                job->err = errno;
+                break;
+            }
+
+            fseek(file, 0, SEEK_END);
+            job->size = ftell(file);
+            rewind(file);
+
+            job->data = calloc(1, job->size);
+            hs_assert(job->data);
+
+            if (fread(job->data, job->size, 1, file) != 1) {
+                job->err = errno ? errno : EIO;
+                free(job->data);
+                job->data = NULL;
+            }
+
+            fclose(file);
+            break;
+        };
+    }
+}
+
+/*
+** Remove and return the first pending job that doesn't touch the same file than a running one,
+** so that a quickload never reads a save state that is still being written.
+*/
+static
+struct io_job *
+app_io_pop_pending(
+    struct io_pool *pool
+) {
+    struct io_job **prev;
+
+    for (prev = &pool->pending; *prev; prev = &(*prev)->next) {
+        struct io_job *running;
+        struct io_job *job;
+
+        job = *prev;
+        for (running = pool->running; running; running = running->next) {
+            if (!strcmp(running->path, job->path)) {
+                break;
+            }
+        }
+
+        if (!running) {
+            *prev = job->next;
+            job->next = NULL;
+            return (job);
+        }
+    }
+    return (NULL);
+}
+
+static
+void *
+app_io_worker(
+    void *raw_pool
+) {
+    struct io_pool *pool;
+
+    pool = raw_pool;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        struct io_job *job;
+
+        job = app_io_pop_pending(pool);
+        if (job) {
+            struct io_job **tail;
+
+            job->next = pool->running;
+            pool->running = job;
+
+            pthread_mutex_unlock(&pool->lock);
+            app_io_run_job(job);
+            pthread_mutex_lock(&pool->lock);
+
+            tail = &pool->running;
+            while (*tail != job) {
+                tail = &(*tail)->next;
+            }
+            *tail = job->next;
+
+            tail = &pool->done;
+            while (*tail) {
+                tail = &(*tail)->next;
+            }
+            *tail = job;
+            job->next = NULL;
+
+            // Another worker may have been waiting for this file to be released.
+            pthread_cond_broadcast(&pool->ready);
+            pthread_cond_broadcast(&pool->idle);
+        } else if (pool->exit && !pool->pending) {
+            break;
+        } else {
+            pthread_cond_wait(&pool->ready, &pool->lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return (NULL);
+}
+
+void
+app_io_start(
+    struct app *app
+) {
+    struct io_pool *pool;
+    size_t i;
+
+    pool = &app->emulation.io;
+    pool->pending = NULL;
+    pool->running = NULL;
+    pool->done = NULL;
+    pool->exit = false;
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->ready, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (i = 0; i < MAX_IO_WORKERS; ++i) {
+        pthread_create(&pool->threads[i], NULL, app_io_worker, pool);
+    }
+
+    pool->started = true;
+}
+
+/*
+** Queue a new job. The job takes ownership of `data`, which must be allocated with `malloc()`.
+*/
+void
+app_io_push(
+    struct app *app,
+    enum io_job_kind kind,
+    char const *path,
+    void *data,
+    size_t size
+) {
+    struct io_pool *pool;
+    struct io_job **tail;
+    struct io_job *job;
+
+    pool = &app->emulation.io;
+
+    job = calloc(1, sizeof(*job));
+    hs_assert(job);
+
+    job->kind = kind;
+    job->path = strdup(path);
+    job->data = data;
+    job->size = size;
+
+    pthread_mutex_lock(&pool->lock);
+    tail = &pool->pending;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = job;
+    pthread_cond_signal(&pool->ready);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/*
+** Wait for all the queued jobs to be done.
+*/
+void
+app_io_wait(
+    struct app *app
+) {
+    struct io_pool *pool;
+
+    pool = &app->emulation.io;
+
+    if (!pool->started) {
+        return ;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending || pool->running) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static
+void
+app_io_delete_job(
+    struct io_job *job
+) {
+    free(job->path);
+    free(job->data);
+    free(job);
+}
+
+/*
+** Report the outcome of the jobs that are done and delete them.
+**
+** Must be called by the UI thread.
+*/
+void
+app_io_process_done(
+    struct app *app
+) {
+    struct io_pool *pool;
+    struct io_job *job;
+
+    pool = &app->emulation.io;
+
+    if (!pool->started) {
+        return ;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    job = pool->done;
+    pool->done = NULL;
+    pthread_mutex_unlock(&pool->lock);
+
+    while (job) {
+        struct io_job *next;
+
+        next = job->next;
+
+        switch (job->kind) {
+            case IO_JOB_SCREENSHOT: {
+                if (!job->err) {
+                    app_new_notification(
+                        app,
+                        UI_NOTIFICATION_SUCCESS,
+                        "Screenshot saved as \"%s\".",
+                        job->path
+                    );
+                } else {
+                    app_new_notification(
+                        app,
+                        UI_NOTIFICATION_ERROR,
+                        "Failed to save screenshot as \"%s\".",
+                        job->path
+                    );
+                }
+                break;
+            };
+            case IO_JOB_QUICKSAVE: {
+                if (!job->err) {
+                    app_new_notification(
+                        app,
+                        UI_NOTIFICATION_SUCCESS,
+                        "Game state saved."
+                    );
+                } else {
+                    app_new_notification(
+                        app,
+                        UI_NOTIFICATION_ERROR,
+                        "Failed to save game state: %s.",
+                        strerror(job->err)
+                    );
+                }
+
+                app->file.flush_qsaves_cache = true;
+                break;
+            };
+            case IO_JOB_QUICKLOAD: {
+                struct message_quickload event;
+
+                hs_assert(app->emulation.quickload_request.enabled);
+
+                if (job->err) {
+                    app_new_notification(
+                        app,
+                        UI_NOTIFICATION_ERROR,
+                        "Failed to load state from %s: %s",
+                        job->path,
+                        strerror(job->err)
+                    );
+
+                    app->emulation.quickload_request.enabled = false;
+                    break;
+                }
+
+                // The data is freed once the emulator notifies us the state was loaded.
+                app->emulation.quickload_request.data = job->data;
+
+                event.header.kind = MESSAGE_QUICKLOAD;
+                event.header.size = sizeof(event);
+                event.data = job->data;
+                event.size = job->size;
+
+                channel_push(&app->emulation.gba->channels.messages, &event.header);
+
+                job->data = NULL;
+                break;
+            };
+        }
+
+        app_io_delete_job(job);
+        job = next;
+    }
+}
+
+/*
+** Finish all the queued jobs and stop the workers.
+**
+** The outcome of the jobs that weren't reported yet is discarded.
+*/
+void
+app_io_close(
+    struct app *app
+) {
+    struct io_pool *pool;
+    struct io_job *job;
+    size_t i;
+
+    pool = &app->emulation.io;
+
+    if (!pool->started) {
+        return ;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->exit = true;
+    pthread_cond_broadcast(&pool->ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (i = 0; i < MAX_IO_WORKERS; ++i) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    job = pool->done;
+    while (job) {
+        struct io_job *next;
+
+        next = job->next;
+        app_io_delete_job(job);
+        job = next;
+    }
+
+    pool->done = NULL;
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->ready);
+    pthread_mutex_destroy(&pool->lock);
+    pool->started = false;
+}
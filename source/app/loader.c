@@ -0,0 +1,382 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#define _GNU_SOURCE
+
+#include <archive.h>
+#include <archive_entry.h>
+#include <inttypes.h>
+#include <errno.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "app/loader.h"
+#include "compat.h"
+
+/*
+** Read the BIOS at the given path.
+*/
+char *
+app_load_bios(
+    char const *path,
+    uint8_t **data,
+    size_t *size
+) {
+    FILE *file;
+    uint8_t *buffer;
+    char *err;
+
+    file = hs_fopen(path, "rb");
+    if (!file) {
+        return (hs_format("Failed to open %s: %s.", path, strerror(errno)));
+    }
+
+    err = NULL;
+    buffer = NULL;
+
+    fseek(file, 0, SEEK_END);
+    if (ftell(file) != BIOS_SIZE) {
+        err = hs_format("The BIOS is invalid.");
+        goto end;
+    }
+
+    rewind(file);
+
+    buffer = calloc(1, BIOS_SIZE);
+    hs_assert(buffer);
+
+    if (fread(buffer, 1, BIOS_SIZE, file) != BIOS_SIZE) {
+        err = hs_format("Failed to read %s: %s.", path, strerror(errno));
+        free(buffer);
+        goto end;
+    }
+
+    *data = buffer;
+    *size = BIOS_SIZE;
+
+end:
+    fclose(file);
+    return (err);
+}
+
+/*
+** Read the first `.gba` file found within the archive at the given path.
+**
+** When the archive tells the size of the entry, which is almost always the case, the
+** ROM is decompressed straight into a buffer of the right size.
+*/
+static
+char *
+app_load_rom_archive(
+    char const *archive_path,
+    uint8_t **data,
+    size_t *size
+) {
+    struct archive *archive;
+    struct archive_entry *entry;
+    char *err;
+
+    logln(HS_INFO, "Path given identified as an archived.");
+
+    archive = archive_read_new();
+    hs_assert(archive);
+
+    archive_read_support_filter_all(archive);
+    archive_read_support_format_all(archive);
+
+    if (archive_read_open_filename(archive, archive_path, 1024 * 1024) != ARCHIVE_OK) { // 1MiB
+        err = hs_format("Failed to open %s as an archive: %s.", archive_path, archive_error_string(archive));
+        goto cleanup;
+    }
+
+    while (archive_read_next_header(archive, &entry) == ARCHIVE_OK) {
+        char const *entry_name;
+        char const *ext;
+
+        entry_name = archive_entry_pathname(entry);
+        ext = strrchr(entry_name, '.');
+        if (ext && !strcmp(ext, ".gba")) {
+            size_t file_len;
+            size_t buffer_len;
+            ssize_t read_len;
+            uint8_t *buffer;
+            bool sized;
+
+            sized = archive_entry_size_is_set(entry);
+            if (sized) {
+                if (archive_entry_size(entry) > CART_SIZE || archive_entry_size(entry) < 192) {
+                    err = hs_format("The ROM is invalid.");
+                    goto cleanup;
+                }
+                buffer_len = archive_entry_size(entry);
+            } else {
+                buffer_len = 1024 * 1024; // 1MiB
+            }
+
+            file_len = 0;
+            buffer = malloc(buffer_len);
+            hs_assert(buffer);
+
+            while (true) {
+                if (file_len == buffer_len) {
+                    if (sized || buffer_len >= CART_SIZE) {
+                        break;
+                    }
+
+                    // The size of the entry is unknown, grow the buffer
+                    buffer_len = min(buffer_len * 2, CART_SIZE);
+                    buffer = realloc(buffer, buffer_len);
+                    hs_assert(buffer);
+                }
+
+                read_len = archive_read_data(archive, buffer + file_len, buffer_len - file_len);
+                if (read_len < 0) {
+                    err = hs_format("Failed to read the archive's entry %s: %s.", entry_name, archive_error_string(archive));
+                    free(buffer);
+                    goto cleanup;
+                } else if (read_len == 0) {
+                    break;
+                }
+                file_len += read_len;
+            }
+
+            if (file_len > CART_SIZE || file_len < 192) {
+                err = hs_format("The ROM is invalid.");
+                free(buffer);
+                goto cleanup;
+            }
+
+            *data = buffer;
+            *size = file_len;
+            err = NULL;
+            goto cleanup;
+        }
+
+        archive_read_data_skip(archive);
+    }
+
+    err = hs_format("No valid GBA game found in the archive.");
+
+cleanup:
+    archive_read_free(archive);
+    return (err);
+}
+
+/*
+** Read the ROM at the given path, without any kind of decompression.
+*/
+static
+char *
+app_load_rom_file(
+    char const *path,
+    uint8_t **data,
+    size_t *size
+) {
+    uint8_t *buffer;
+    size_t file_len;
+    FILE *file;
+    char *err;
+
+    file = hs_fopen(path, "rb");
+    if (!file) {
+        return (hs_format("Failed to open %s: %s.", path, strerror(errno)));
+    }
+
+    err = NULL;
+
+    fseek(file, 0, SEEK_END);
+    file_len = ftell(file);
+    if (file_len > CART_SIZE || file_len < 192) {
+        err = hs_format("The ROM is invalid.");
+        goto end;
+    }
+
+    rewind(file);
+
+    buffer = calloc(1, file_len);
+    hs_assert(buffer);
+
+    if (fread(buffer, 1, file_len, file) != file_len) {
+        err = hs_format("Failed to read %s: %s.", path, strerror(errno));
+        free(buffer);
+        goto end;
+    }
+
+    *data = buffer;
+    *size = file_len;
+
+end:
+    fclose(file);
+    return (err);
+}
+
+/*
+** Return the path of the cached copy of the ROM extracted from the given archive.
+**
+** The name of the cached ROM is a hash of the archive's path, so each archive has at most one
+** entry in the cache and a new one replaces the stale one.
+**
+** The returned value must be freed.
+*/
+static
+char *
+app_loader_cache_path(
+    char const *cache_dir,
+    char const *archive_path
+) {
+    return (hs_format("%s/%016" PRIx64 ".rom", cache_dir, hs_fnv1a(HS_FNV1A_BASIS, archive_path, strlen(archive_path))));
+}
+
+/*
+** Load a ROM from the cache.
+**
+** A cached ROM starts with the modification time and size the archive had when it was extracted,
+** so any change to the archive invalidates it.
+**
+** Return true if the ROM isn't in the cache or is stale.
+*/
+static
+bool
+app_loader_cache_load(
+    char const *cache_path,
+    uint64_t const key[2],
+    uint8_t **data,
+    size_t *size
+) {
+    uint64_t cached_key[2];
+    uint8_t *buffer;
+    size_t file_len;
+    FILE *file;
+    bool err;
+
+    file = hs_fopen(cache_path, "rb");
+    if (!file) {
+        return (true);
+    }
+
+    err = true;
+
+    fseek(file, 0, SEEK_END);
+    file_len = ftell(file);
+    if (file_len > sizeof(cached_key) + CART_SIZE || file_len < sizeof(cached_key) + 192) {
+        goto end;
+    }
+
+    rewind(file);
+
+    if (fread(cached_key, sizeof(cached_key), 1, file) != 1 || memcmp(cached_key, key, sizeof(cached_key))) {
+        goto end;
+    }
+
+    file_len -= sizeof(cached_key);
+    buffer = calloc(1, file_len);
+    hs_assert(buffer);
+
+    if (fread(buffer, 1, file_len, file) != file_len) {
+        free(buffer);
+        goto end;
+    }
+
+    *data = buffer;
+    *size = file_len;
+    err = false;
+
+end:
+    fclose(file);
+    return (err);
+}
+
+/*
+** Store a ROM extracted from an archive in the cache, replacing the previous one extracted
+** from the same archive.
+**
+** The ROM is written to a temporary file first and then renamed, so an other instance
+** loading the same archive at the same time can never see a partially written ROM.
+*/
+static
+void
+app_loader_cache_store(
+    char const *cache_path,
+    uint64_t const key[2],
+    uint8_t const *data,
+    size_t size
+) {
+    char *tmp_path;
+    FILE *file;
+    bool err;
+
+    tmp_path = hs_format("%s.%016" PRIx64 ".tmp", cache_path, hs_time_ns());
+
+    file = hs_fopen(tmp_path, "wb");
+    if (!file) {
+        logln(HS_WARNING, "Failed to create %s: %s.", tmp_path, strerror(errno));
+        goto end;
+    }
+
+    err = fwrite(key, sizeof(uint64_t) * 2, 1, file) != 1;
+    err = fwrite(data, size, 1, file) != 1 || err;
+    err = fclose(file) || err;
+
+#if defined (_WIN32) && !defined (__CYGWIN__)
+    // `rename()` doesn't replace an existing file on Windows.
+    remove(cache_path);
+#endif
+
+    if (err || rename(tmp_path, cache_path)) {
+        logln(HS_WARNING, "Failed to write %s: %s.", cache_path, strerror(errno));
+        remove(tmp_path);
+    }
+
+end:
+    free(tmp_path);
+}
+
+/*
+** Read the ROM at the given path.
+**
+** We consider anything that isn't ending with `.gba` or `.bin` as an archive.
+** XXX: Should we build a hard-coded list instead?
+**
+** If `cache_dir` isn't `NULL`, ROMs extracted from archives are cached there and the
+** next loads of the same archive are as fast as loading a plain ROM.
+*/
+char *
+app_load_rom(
+    char const *path,
+    char const *cache_dir,
+    uint8_t **data,
+    size_t *size
+) {
+    char const *extension;
+    uint64_t key[2];
+    char *cache_path;
+    char *err;
+
+    extension = strrchr(path, '.');
+    if (!extension || !strcmp(extension, ".gba") || !strcmp(extension, ".bin")) {
+        return (app_load_rom_file(path, data, size));
+    }
+
+    cache_path = (cache_dir && !hs_stat(path, &key[0], &key[1])) ? app_loader_cache_path(cache_dir, path) : NULL;
+
+    if (cache_path && !app_loader_cache_load(cache_path, key, data, size)) {
+        logln(HS_INFO, "ROM loaded from the cache at \"%s\".", cache_path);
+        err = NULL;
+        goto end;
+    }
+
+    err = app_load_rom_archive(path, data, size);
+
+    if (!err && cache_path) {
+        app_loader_cache_store(cache_path, key, *data, *size);
+    }
+
+end:
+    free(cache_path);
+    return (err);
+}
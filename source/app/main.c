@@ -26,18 +26,30 @@
 #ifdef WITH_DEBUGGER
 # include "app/dbg.h"
 
-static atomic_bool g_force_interrupt = false;
-
 /*
-** The signal handler, used to set `g_force_interrupt` to true and go back to
-** the debugger.
+** A thread waiting for SIGINT and pausing the emulator to go back to the
+** debugger.
+**
+** SIGINT is blocked in all the other threads, so it is never delivered
+** asynchronously and this thread can safely send messages to the emulator.
 */
 static
-void
-sighandler(
-    int signal
+void *
+sigint_handler(
+    struct app *app
 ) {
-    g_force_interrupt = true;
+    sigset_t set;
+    int sig;
+
+    sigemptyset(&set);
+    sigaddset(&set, SIGINT);
+
+    while (true) {
+        if (!sigwait(&set, &sig)) {
+            app_emulator_pause(app);
+        }
+    }
+    return (NULL);
 }
 
 #endif
@@ -51,6 +63,16 @@ main(
     pthread_t gba_thread;
 #ifdef WITH_DEBUGGER
     pthread_t dbg_thread;
+    pthread_t sig_thread;
+    sigset_t sigint_set;
+
+    /*
+    ** Block SIGINT before any other thread is created so they all inherit the mask.
+    ** It is handled synchronously by `sigint_handler()` instead.
+    */
+    sigemptyset(&sigint_set);
+    sigaddset(&sigint_set, SIGINT);
+    pthread_sigmask(SIG_BLOCK, &sigint_set, NULL);
 #endif
 
     memset(&app, 0, sizeof(app));
@@ -73,6 +95,7 @@ main(
     app.video.display_size = 3;
     app.video.aspect_ratio = ASPECT_RATIO_RESIZE;
     app.audio.mute = false;
+    app.audio.sync = false;
     app.audio.level = 1.0f;
     app.audio.resample_frequency = 48000;
     app.gfx.texture_filter = TEXTURE_FILTER_NEAREST;
@@ -115,6 +138,8 @@ main(
         app.emulation.gba
     );
 
+    app_io_start(&app);
+
     if (app.args.rom_path) {
         app_emulator_configure(&app, app.args.rom_path);
         if (app.emulation.launch_config) {
@@ -127,7 +152,14 @@ main(
     }
 
 #ifdef WITH_DEBUGGER
-    signal(SIGINT, &sighandler);
+    /* Start the SIGINT handler thread */
+    pthread_create(
+        &sig_thread,
+        NULL,
+        (void *(*)(void *))sigint_handler,
+        &app
+    );
+    pthread_detach(sig_thread);
 
     /* Start the debugger thread */
     pthread_create(
@@ -145,19 +177,25 @@ main(
         sdl_counters[0] = SDL_GetPerformanceCounter();
 
         app_emulator_process_all_notifs(&app);
-
-#if WITH_DEBUGGER
-        if (g_force_interrupt) {
-            g_force_interrupt = false;
-            app_emulator_pause(&app);
-        }
-#endif
+        app_io_process_done(&app);
 
         /*
         ** When used with a debugger, Hades can run without a GUI.
         ** This is mostly useful for the CI and automated testing.
+        **
+        ** In that case, there's nothing else to do but to sleep until the emulator
+        ** sends a new notification or the debugger exits.
         */
         if (!app.args.with_gui) {
+            struct channel *notifications;
+
+            notifications = &app.emulation.gba->channels.notifications;
+
+            channel_lock(notifications);
+            if (app.run && !channel_peek(notifications)) {
+                channel_wait(notifications);
+            }
+            channel_release(notifications);
             continue;
         }
 
@@ -264,6 +302,12 @@ main(
     app_emulator_exit(&app);
     pthread_join(gba_thread, NULL);
 
+    // Write what remains of the backup storage before the emulator is deleted.
+    app_emulator_close_backup(&app);
+
+    // Finish writing the pending save states and screenshots.
+    app_io_close(&app);
+
 #ifdef WITH_DEBUGGER
     debugger_reset_terminal();
 #endif
@@ -89,6 +89,44 @@ system_pictures_dir(void)
 #endif
 }
 
+/*
+** Return the platform-dependent cache directory or NULL
+** if the system doesn't have one.
+**
+** The returned value must be freed.
+*/
+static inline
+char *
+system_cache_dir(void)
+{
+#if __APPLE__
+    char *home_dir;
+
+    home_dir = getenv("HOME");
+    if (home_dir && hs_fexists(home_dir)) {
+        return (hs_format("%s/Library/Caches", home_dir));
+    }
+
+    return (NULL);
+#elif __unix__
+    char *xdg_cache_dir;
+    char *home_dir;
+
+    xdg_cache_dir = getenv("XDG_CACHE_HOME");
+    if (xdg_cache_dir && hs_fexists(xdg_cache_dir)) {
+        return (strdup(xdg_cache_dir));
+    }
+
+    home_dir = getenv("HOME");
+    if (home_dir && hs_fexists(home_dir)) {
+        return (hs_format("%s/.cache", home_dir));
+    }
+
+    return (NULL);
+#else
+    return (NULL);
+#endif
+}
 
 void
 app_paths_update(
@@ -96,9 +134,11 @@ app_paths_update(
 ) {
     char *sys_config_dir;
     char *sys_pictures_dir;
+    char *sys_cache_dir;
 
     sys_config_dir = system_config_dir();
     sys_pictures_dir = system_pictures_dir();
+    sys_cache_dir = system_cache_dir();
 
     if (sys_config_dir && hs_fexists(sys_config_dir)) {
         char *hades_config_dir;
@@ -119,6 +159,25 @@ app_paths_update(
         app->file.sys_pictures_dir_path = hs_format("%s/Hades", sys_pictures_dir);
         free(sys_pictures_dir);
     }
+
+    if (sys_cache_dir && hs_fexists(sys_cache_dir)) {
+        char *hades_cache_dir;
+
+        hades_cache_dir = hs_format("%s/Hades", sys_cache_dir);
+
+        if (!hs_fexists(hades_cache_dir)) {
+            hs_mkdir(hades_cache_dir);
+        }
+
+        app->file.sys_cache_dir_path = hs_format("%s/roms", hades_cache_dir);
+
+        if (!hs_fexists(app->file.sys_cache_dir_path)) {
+            hs_mkdir(app->file.sys_cache_dir_path);
+        }
+
+        free(hades_cache_dir);
+        free(sys_cache_dir);
+    }
 }
 
 char const *
@@ -146,3 +205,14 @@ app_path_screenshots(
 ) {
     return (app->file.sys_pictures_dir_path ?: "screeenshots");
 }
+
+/*
+** Return the directory where the ROMs extracted from archives are cached, or NULL
+** if the system doesn't have a cache directory.
+*/
+char const *
+app_path_rom_cache(
+    struct app *app
+) {
+    return (app->file.sys_cache_dir_path);
+}
@@ -9,6 +9,7 @@
 
 #define _GNU_SOURCE
 
+#include <inttypes.h>
 #include <string.h>
 #include <cimgui.h>
 #include <nfd.h>
@@ -102,6 +103,10 @@ app_win_menubar_emulation(
             app->emulation.skip_bios ^= 1;
         }
 
+        if (igMenuItem_Bool("HLE BIOS calls", NULL, app->emulation.hle_bios, true)) {
+            app->emulation.hle_bios ^= 1;
+        }
+
         if (igBeginMenu("Speed", app->emulation.is_started)) {
             uint32_t x;
             char const *speed[] = {
@@ -377,6 +382,14 @@ app_win_menubar_audio(
             app->audio.mute ^= 1;
         }
 
+        /* Sync the emulation to the audio device */
+        if (igMenuItem_Bool("Sync Video to Audio", NULL, app->audio.sync, true)) {
+            app->audio.sync ^= 1;
+            if (app->emulation.is_started) {
+                app_emulator_speed(app, app->emulation.speed * !app->emulation.unbounded);
+            }
+        }
+
         igSeparator();
 
         igText("Sound Level:");
@@ -476,6 +489,30 @@ app_win_menubar_fps_counter(
 
         igSameLine(igGetWindowWidth() - (app->ui.menubar_fps_width + spacing * 2), 1);
         igText("FPS: %u (%u%%)", app->emulation.fps, (unsigned)(app->emulation.fps / 60.0 * 100.0));
+
+        if (igIsItemHovered(ImGuiHoveredFlags_None)) {
+            struct shared_data *shared_data;
+
+            shared_data = &app->emulation.gba->shared_data;
+            igSetTooltip(
+                "Frame time: %.2fms (p50: %.2fms, p99: %.2fms, max: %.2fms)\n"
+                "Emulating: %.2fms per frame\n"
+                "Speed: %u%%\n"
+                "Audio buffer: %u%% (%" PRIu64 " underruns, %" PRIu64 " overruns)\n"
+                "Dropped frames: %" PRIu64,
+                atomic_load_explicit(&shared_data->stats.frame_time_mean, memory_order_relaxed) / 1000.f,
+                atomic_load_explicit(&shared_data->stats.frame_time_p50, memory_order_relaxed) / 1000.f,
+                atomic_load_explicit(&shared_data->stats.frame_time_p99, memory_order_relaxed) / 1000.f,
+                atomic_load_explicit(&shared_data->stats.frame_time_max, memory_order_relaxed) / 1000.f,
+                atomic_load_explicit(&shared_data->stats.busy_time_mean, memory_order_relaxed) / 1000.f,
+                atomic_load_explicit(&shared_data->stats.speed, memory_order_relaxed),
+                atomic_load_explicit(&shared_data->stats.audio_fill, memory_order_relaxed),
+                (uint64_t)atomic_load_explicit(&shared_data->stats.audio_underruns, memory_order_relaxed),
+                (uint64_t)atomic_load_explicit(&shared_data->stats.audio_overruns, memory_order_relaxed),
+                (uint64_t)atomic_load_explicit(&shared_data->stats.dropped_frames, memory_order_relaxed)
+            );
+        }
+
         igGetItemRectSize(&out);
         app->ui.menubar_fps_width = out.x;
     }
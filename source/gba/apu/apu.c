@@ -35,6 +35,10 @@ apu_rbuffer_push(
         rbuffer->data[rbuffer->write_idx] = data;
         rbuffer->write_idx = (rbuffer->write_idx + 1) % APU_RBUFFER_CAPACITY;
         ++rbuffer->size;
+        rbuffer->starved = false;
+    } else if (!rbuffer->overflowing) {
+        ++rbuffer->overruns;
+        rbuffer->overflowing = true;
     }
 }
 
@@ -48,6 +52,10 @@ apu_rbuffer_pop(
     if (rbuffer->size > 0) {
         rbuffer->read_idx = (rbuffer->read_idx + 1) % APU_RBUFFER_CAPACITY;
         --rbuffer->size;
+        rbuffer->overflowing = false;
+    } else if (!rbuffer->starved) {
+        ++rbuffer->underruns;
+        rbuffer->starved = true;
     }
 
     return (val);
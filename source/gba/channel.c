@@ -8,10 +8,21 @@
 \******************************************************************************/
 
 #include <string.h>
+#include <stddef.h>
+#include <sched.h>
 #include "hades.h"
 #include "gba/channel.h"
 #include "gba/event.h"
 
+static_assert((CHANNEL_SLOTS & (CHANNEL_SLOTS - 1)) == 0);
+static_assert(sizeof(struct message_reset) <= CHANNEL_EVENT_MAX_SIZE);
+static_assert(sizeof(struct message_quickload) <= CHANNEL_EVENT_MAX_SIZE);
+static_assert(sizeof(struct notification_quicksave) <= CHANNEL_EVENT_MAX_SIZE);
+#ifdef WITH_DEBUGGER
+static_assert(sizeof(struct message_trace) <= CHANNEL_EVENT_MAX_SIZE);
+static_assert(sizeof(struct notification_watchpoint) <= CHANNEL_EVENT_MAX_SIZE);
+#endif
+
 /*
 ** Initialize the channel.
 */
@@ -19,14 +30,22 @@ void
 channel_init(
     struct channel *channel
 ) {
+    size_t i;
+
     memset(channel, 0, sizeof(*channel));
 
+    for (i = 0; i < CHANNEL_SLOTS; ++i) {
+        atomic_init(&channel->slots[i].sequence, i);
+    }
+
     pthread_mutex_init(&channel->lock, NULL);
     pthread_cond_init(&channel->ready, NULL);
 }
 
 /*
-** Lock the channel.
+** Lock the consumer side of the channel.
+**
+** Producers don't need to lock the channel to push new events.
 */
 void
 channel_lock(
@@ -36,7 +55,7 @@ channel_lock(
 }
 
 /*
-** Release the channel.
+** Release the consumer side of the channel.
 */
 void
 channel_release(
@@ -48,41 +67,93 @@ channel_release(
 /*
 ** Push an event at the end of a channel.
 **
-** The channel must already be locked.
+** If the channel is full, either yield until the consumer frees a slot or, if `wait` is false,
+** drop the event and return true.
 */
-void
-channel_push(
+static
+bool
+channel_do_push(
     struct channel *channel,
-    struct event_header const *event
+    struct event_header const *event,
+    bool wait
 ) {
-    size_t new_size;
-
-    // Reallocate if `channel->events` is too small.
-    new_size = channel->size + event->size;
-    if (channel->allocated_size < new_size) {
-        if (!channel->allocated_size) {
-            channel->allocated_size += 1;
+    struct channel_slot *slot;
+    size_t pos;
+
+    hs_assert(event->size <= CHANNEL_EVENT_MAX_SIZE);
+
+    pos = atomic_load_explicit(&channel->tail, memory_order_relaxed);
+    while (true) {
+        size_t seq;
+
+        slot = &channel->slots[pos & (CHANNEL_SLOTS - 1)];
+        seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+        if (seq == pos) {
+            // The slot is free, try to claim it.
+            if (atomic_compare_exchange_weak_explicit(&channel->tail, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if ((ptrdiff_t)(seq - pos) < 0) {
+            if (!wait) {
+                return (true);
+            }
+
+            // The channel is full, wait for the consumer to catch up.
+            sched_yield();
+            pos = atomic_load_explicit(&channel->tail, memory_order_relaxed);
+        } else {
+            // Another producer claimed that slot first.
+            pos = atomic_load_explicit(&channel->tail, memory_order_relaxed);
         }
+    }
 
-        while (channel->allocated_size < new_size) {
-            channel->allocated_size *= 2;
-        }
-        channel->events = realloc(channel->events, channel->allocated_size);
-        hs_assert(channel->events);
+    memcpy(slot->event.raw, event, event->size);
+
+    // `pending` is raised before the slot is published so it can never underflow in `channel_pop()`.
+    atomic_fetch_add(&channel->pending, 1);
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+    // Wake up the consumer if it is sleeping.
+    if (atomic_load(&channel->waiting)) {
+        pthread_mutex_lock(&channel->lock);
+        pthread_cond_broadcast(&channel->ready);
+        pthread_mutex_unlock(&channel->lock);
     }
 
-    // Copy the new event at the end of the buffer
-    memcpy((uint8_t *)channel->events + channel->size, event, event->size);
+    return (false);
+}
 
-    // Update the channel's length and size
-    channel->length += 1;
-    channel->size += event->size;
+/*
+** Push an event at the end of a channel.
+**
+** This function is lock-free and can be called concurrently by multiple producers.
+** If the channel is full, it yields until the consumer frees a slot.
+*/
+void
+channel_push(
+    struct channel *channel,
+    struct event_header const *event
+) {
+    channel_do_push(channel, event, true);
+}
 
-    pthread_cond_broadcast(&channel->ready);
+/*
+** Push an event at the end of a channel, unless it is full.
+**
+** Return true if the channel is full, in which case the event is dropped.
+** Meant for channels that may have no consumer, so the producer never blocks on them.
+*/
+bool
+channel_try_push(
+    struct channel *channel,
+    struct event_header const *event
+) {
+    return (channel_do_push(channel, event, false));
 }
 
 /*
-** Wait for an event to be available.
+** Wait for an event to be available, or for `channel_interrupt()` to be called.
 **
 ** The channel must already be locked.
 */
@@ -90,50 +161,69 @@ void
 channel_wait(
     struct channel *channel
 ) {
-    pthread_cond_wait(&channel->ready, &channel->lock);
+    atomic_store(&channel->waiting, true);
+    while (!atomic_load(&channel->pending) && !atomic_load(&channel->interrupted)) {
+        pthread_cond_wait(&channel->ready, &channel->lock);
+    }
+    atomic_store(&channel->waiting, false);
+    atomic_store(&channel->interrupted, false);
 }
 
 /*
-** Return a read-only view of the next event in the channel.
-** One can iterate over the events contained in a channel by calling
-** this function multiple time, using the previous return value as the
-** new value for `prev_event`.
+** Wake up the consumer of the channel, even if no event is available.
 **
-** On the first call, `prev_event` must be NULL.
-** Return `NULL` if there is no more event in the channel.
+** If the consumer isn't sleeping in `channel_wait()`, its next call will return immediately.
+*/
+void
+channel_interrupt(
+    struct channel *channel
+) {
+    atomic_store(&channel->interrupted, true);
+    if (atomic_load(&channel->waiting)) {
+        pthread_mutex_lock(&channel->lock);
+        pthread_cond_broadcast(&channel->ready);
+        pthread_mutex_unlock(&channel->lock);
+    }
+}
+
+/*
+** Return a read-only view of the oldest event in the channel, or `NULL` if
+** there is none available.
 **
-** The returned pointer is valid until `channel_release` or `channel_clear_events` is called.
+** The returned pointer is valid until `channel_pop` is called.
 **
 ** The channel must already be locked.
 */
 struct event_header const *
-channel_next(
-    struct channel const *channel,
-    struct event_header const *prev_event
+channel_peek(
+    struct channel *channel
 ) {
-    struct event_header *new_event;
+    struct channel_slot *slot;
+    size_t seq;
 
-    if (prev_event) {
-        new_event = (struct event_header *)((uint8_t *)prev_event + prev_event->size);
-    } else {
-        new_event = channel->events;
-    }
+    slot = &channel->slots[channel->head & (CHANNEL_SLOTS - 1)];
+    seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
 
-    if (channel->events && (uint8_t *)new_event < (uint8_t *)channel->events + channel->size) {
-        return (new_event);
+    if (seq == channel->head + 1) {
+        return (&slot->event.header);
     }
     return (NULL);
 }
 
 /*
-** Clear the channel of all of its events.
+** Remove the oldest event of the channel, as returned by `channel_peek`, and
+** give its slot back to the producers.
 **
 ** The channel must already be locked.
 */
 void
-channel_clear(
+channel_pop(
     struct channel *channel
 ) {
-    channel->length = 0;
-    channel->size = 0;
+    struct channel_slot *slot;
+
+    slot = &channel->slots[channel->head & (CHANNEL_SLOTS - 1)];
+    atomic_store_explicit(&slot->sequence, channel->head + CHANNEL_SLOTS, memory_order_release);
+    ++channel->head;
+    atomic_fetch_sub_explicit(&channel->pending, 1, memory_order_relaxed);
 }
@@ -40,6 +40,13 @@ core_arm_branch(
     ** and our resulting value is the correct one.
     */
     core->pc += offset;
+
+#ifdef WITH_PROFILER
+    if (bitfield_get(op, 24)) {
+        profiler_call(gba, core->pc & 0xFFFFFFFC, core->lr);
+    }
+#endif
+
     core_reload_pipeline(gba);
 }
 
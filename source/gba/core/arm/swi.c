@@ -15,5 +15,7 @@ core_arm_swi(
     struct gba *gba,
     uint32_t op
 ) {
-    core_interrupt(gba, VEC_SVC, MODE_SVC);
+    if (gba->hle.mode == HLE_OFF || hle_swi(gba, (op >> 16) & 0xFF)) {
+        core_interrupt(gba, VEC_SVC, MODE_SVC);
+    }
 }
@@ -50,7 +50,7 @@ core_next(
                        !gba->core.cpsr.irq_disable
                     && (gba->io.ime.raw & 0b1)
                 ) {
-                    logln(HS_IRQ, "Received new IRQ: 0x%04x.", gba->io.int_enabled.raw & gba->io.int_flag.raw);
+                    logev(HS_IRQ, "Received new IRQ: 0x%04x.", gba->io.int_enabled.raw & gba->io.int_flag.raw);
                     core_interrupt(gba, VEC_IRQ, MODE_IRQ);
                 }
                 break;
@@ -69,25 +69,44 @@ core_next(
     }
 
     if (likely(core->state == CORE_RUN)) {
+#ifdef WITH_COUNTERS
+        uint64_t start;
+
+        start = gba->scheduler.cycles;
+#endif
+
+#ifdef WITH_PROFILER
+        // The PC may be half reloaded when a sample is taken, so the address of the instruction is kept aside.
+        gba->profiler.pc = core->pc - (core->cpsr.thumb ? 4 : 8);
+#endif
+
+#ifdef WITH_COVERAGE
+        coverage_mark(&gba->coverage, core->pc - (core->cpsr.thumb ? 4 : 8), core->cpsr.thumb ? 0b1 : 0b11);
+#endif
+
         if (core->cpsr.thumb) {
             uint16_t op;
 
             op = core->prefetch[0];
             core->prefetch[0] = core->prefetch[1];
-            core->prefetch[1] = mem_read16(gba, core->pc, core->prefetch_access_type);
+            core->prefetch[1] = mem_fetch16(gba, core->pc, core->prefetch_access_type);
 
             if (unlikely(thumb_lut[op >> 8] == NULL)) {
                 panic(HS_CORE, "Unknown Thumb op-code 0x%04x (pc=0x%08x).", op, core->pc);
             }
 
             thumb_lut[op >> 8](gba, op);
+
+#ifdef WITH_COUNTERS
+            counter_add(&gba->counters.thumb[op >> 8], gba->scheduler.cycles - start);
+#endif
         } else {
             size_t idx;
             uint32_t op;
 
             op = core->prefetch[0];
             core->prefetch[0] = core->prefetch[1];
-            core->prefetch[1] = mem_read32(gba, core->pc, core->prefetch_access_type);
+            core->prefetch[1] = mem_fetch32(gba, core->pc, core->prefetch_access_type);
 
             /*
             ** Test if the conditions required to execute the instruction are met
@@ -98,6 +117,11 @@ core_next(
             if (unlikely(!cond_lut[idx])) {
                 core->pc += 4;
                 core->prefetch_access_type = SEQUENTIAL;
+
+#ifdef WITH_COUNTERS
+                counter_add(&gba->counters.arm_cond_failed, gba->scheduler.cycles - start);
+#endif
+
                 goto end;
             }
 
@@ -108,6 +132,10 @@ core_next(
             }
 
             arm_lut[idx](gba, op);
+
+#ifdef WITH_COUNTERS
+            counter_add(&gba->counters.arm[idx], gba->scheduler.cycles - start);
+#endif
         }
     } else if (core->state == CORE_HALT) {
         if (gba->scheduler.next_event > gba->scheduler.cycles) {
@@ -119,7 +147,9 @@ core_next(
 
 end:
 #ifdef WITH_DEBUGGER
-    debugger_eval_breakpoints(gba);
+    if (unlikely(gba->debugger.breakpoints.len)) {
+        debugger_eval_breakpoints(gba);
+    }
 #else
     (void)0;
 #endif
@@ -175,17 +205,24 @@ core_reload_pipeline(
     struct core *core;
 
     core = &gba->core;
+
+#ifdef WITH_PROFILER
+    if (unlikely(gba->profiler.stack.len)) {
+        profiler_return(gba, core->pc & (core->cpsr.thumb ? 0xFFFFFFFE : 0xFFFFFFFC));
+    }
+#endif
+
     if (core->cpsr.thumb) {
         core->pc &= 0xFFFFFFFE;
-        core->prefetch[0] = mem_read16(gba, core->pc, NON_SEQUENTIAL);
+        core->prefetch[0] = mem_fetch16(gba, core->pc, NON_SEQUENTIAL);
         core->pc += 2;
-        core->prefetch[1] = mem_read16(gba, core->pc, SEQUENTIAL);
+        core->prefetch[1] = mem_fetch16(gba, core->pc, SEQUENTIAL);
         core->pc += 2;
     } else {
         core->pc &= 0xFFFFFFFC;
-        core->prefetch[0] = mem_read32(gba, core->pc, NON_SEQUENTIAL);
+        core->prefetch[0] = mem_fetch32(gba, core->pc, NON_SEQUENTIAL);
         core->pc += 4;
-        core->prefetch[1] = mem_read32(gba, core->pc, SEQUENTIAL);
+        core->prefetch[1] = mem_fetch32(gba, core->pc, SEQUENTIAL);
         core->pc += 4;
     }
     core->prefetch_access_type = SEQUENTIAL;
@@ -271,7 +308,7 @@ core_switch_mode(
 ) {
     if (mode != core->cpsr.mode) {
 
-        logln(
+        logev(
             HS_CORE,
             "Switching from %s to %s mode.",
             arm_modes_name[core->cpsr.mode],
@@ -430,6 +467,15 @@ core_interrupt(
         core->lr = core->pc - (core->cpsr.thumb ? 0 : 4);
     }
 
+#ifdef WITH_PROFILER
+    // The SWI and UND handlers return to LR, the IRQ and FIQ ones to LR - 4.
+    if (vector == VEC_SVC || vector == VEC_UND) {
+        profiler_call(gba, vector, core->lr);
+    } else if (vector != VEC_RESET) {
+        profiler_call(gba, vector, core->lr - 4);
+    }
+#endif
+
     core->pc = vector;
     core->cpsr.irq_disable = true;
     core->cpsr.thumb = false;
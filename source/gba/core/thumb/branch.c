@@ -55,6 +55,11 @@ core_thumb_branch_link(
 
         core->lr = (core->pc - 2) | 1;
         core->pc = lr;
+
+#ifdef WITH_PROFILER
+        profiler_call(gba, core->pc & 0xFFFFFFFE, core->lr & 0xFFFFFFFE);
+#endif
+
         core_reload_pipeline(gba);
     }
 }
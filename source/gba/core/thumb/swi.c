@@ -15,5 +15,7 @@ core_thumb_swi(
     struct gba *gba,
     uint16_t op
 ) {
-    core_interrupt(gba, VEC_SVC, MODE_SVC);
+    if (gba->hle.mode == HLE_OFF || hle_swi(gba, op & 0xFF)) {
+        core_interrupt(gba, VEC_SVC, MODE_SVC);
+    }
 }
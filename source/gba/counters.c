@@ -0,0 +1,130 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#ifdef WITH_COUNTERS
+
+#include <inttypes.h>
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "gba/counters.h"
+
+char const * const sched_event_names[SCHED_EVENT_MAX] = {
+    [SCHED_EVENT_FRAME_LIMITER] = "frame_limiter",
+    [SCHED_EVENT_PPU_HDRAW] = "ppu_hdraw",
+    [SCHED_EVENT_PPU_HBLANK] = "ppu_hblank",
+    [SCHED_EVENT_TIMER_OVERFLOW] = "timer_overflow",
+    [SCHED_EVENT_TIMER_STOP] = "timer_stop",
+    [SCHED_EVENT_APU_RESAMPLE] = "apu_resample",
+    [SCHED_EVENT_APU_MODULES_STEP] = "apu_modules_step",
+    [SCHED_EVENT_APU_TONE_AND_SWEEP_STEP] = "apu_tone_and_sweep_step",
+    [SCHED_EVENT_APU_TONE_STEP] = "apu_tone_step",
+    [SCHED_EVENT_APU_WAVE_STEP] = "apu_wave_step",
+    [SCHED_EVENT_APU_NOISE_STEP] = "apu_noise_step",
+    [SCHED_EVENT_DMA_ADD_PENDING] = "dma_add_pending",
+    [SCHED_EVENT_PROFILER_SAMPLE] = "profiler_sample",
+    [SCHED_EVENT_LINK_SYNC] = "link_sync",
+    [SCHED_EVENT_LINK_TRANSFER_END] = "link_transfer_end",
+};
+
+/*
+** Clear the counters. The frame callback is kept.
+*/
+void
+counters_reset(
+    struct gba *gba
+) {
+    void (*frame_cb)(struct gba const *, void *);
+    void *frame_arg;
+
+    frame_cb = gba->counters.frame_cb;
+    frame_arg = gba->counters.frame_arg;
+    memset(&gba->counters, 0, sizeof(gba->counters));
+    gba->counters.frame_cb = frame_cb;
+    gba->counters.frame_arg = frame_arg;
+}
+
+static
+void
+counters_write_row(
+    FILE *file,
+    char const *category,
+    uint32_t key,
+    uint64_t count,
+    uint64_t cycles
+) {
+    if (count) {
+        fprintf(file, "%s,0x%03x,%" PRIu64 ",%" PRIu64 "\n", category, key, count, cycles);
+    }
+}
+
+/*
+** Write the counters as CSV, one row per non-zero counter.
+**
+** The key is the index in `arm_lut` or `thumb_lut` for the instructions, and the region
+** of the bus for the memory accesses.
+**
+** Return true if the write failed.
+*/
+bool
+counters_write_csv(
+    struct gba const *gba,
+    FILE *file
+) {
+    struct counters const *counters;
+    size_t i;
+
+    counters = &gba->counters;
+
+    fprintf(file, "category,key,count,cycles\n");
+
+    for (i = 0; i < array_length(counters->arm); ++i) {
+        counters_write_row(file, "arm", i, counters->arm[i].count, counters->arm[i].cycles);
+    }
+
+    counters_write_row(file, "arm_cond_failed", 0, counters->arm_cond_failed.count, counters->arm_cond_failed.cycles);
+
+    for (i = 0; i < array_length(counters->thumb); ++i) {
+        counters_write_row(file, "thumb", i, counters->thumb[i].count, counters->thumb[i].cycles);
+    }
+
+    for (i = 0; i < array_length(counters->mem); ++i) {
+        counters_write_row(file, "mem_nonseq", i, counters->mem[i][NON_SEQUENTIAL].count, counters->mem[i][NON_SEQUENTIAL].cycles);
+        counters_write_row(file, "mem_seq", i, counters->mem[i][SEQUENTIAL].count, counters->mem[i][SEQUENTIAL].cycles);
+    }
+
+    counters_write_row(file, "prefetch_hits", 0, counters->prefetch_hits, 0);
+    counters_write_row(file, "prefetch_misses", 0, counters->prefetch_misses, 0);
+
+    fprintf(file, "\nevent,added,cancelled,fired,lateness_mean,lateness_max,time_ns\n");
+    for (i = 0; i < array_length(counters->events); ++i) {
+        struct sched_counter const *event;
+
+        event = counters->events + i;
+        if (!event->added && !event->fired) {
+            continue;
+        }
+
+        fprintf(
+            file,
+            "%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%.2f,%" PRIu64 ",%" PRIu64 "\n",
+            sched_event_names[i],
+            event->added,
+            event->cancelled,
+            event->fired,
+            event->fired ? (double)event->lateness / event->fired : 0.0,
+            event->lateness_max,
+            event->time_ns
+        );
+    }
+
+    return (ferror(file) != 0);
+}
+
+#endif /* WITH_COUNTERS */
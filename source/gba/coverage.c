@@ -0,0 +1,166 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#ifdef WITH_COVERAGE
+
+#include <stddef.h>
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "gba/coverage.h"
+
+struct coverage_section {
+    size_t offset;      // Of the bitmap, in `struct coverage`
+    size_t size;
+};
+
+static inline
+size_t
+coverage_rom_size(
+    struct gba const *gba
+) {
+    return (min(gba->memory.rom_size, CART_SIZE));
+}
+
+/*
+** List the bitmaps in the order they are written to a coverage file.
+** The one of the ROM is truncated to the size of the ROM.
+**
+** The bitmaps are given by their offset so the same list can be used to read a `struct gba const`
+** and to write a `struct gba`.
+*/
+static
+void
+coverage_sections(
+    struct gba const *gba,
+    struct coverage_section sections[4]
+) {
+    sections[0] = (struct coverage_section){ offsetof(struct coverage, bios), sizeof(gba->coverage.bios) };
+    sections[1] = (struct coverage_section){ offsetof(struct coverage, ewram), sizeof(gba->coverage.ewram) };
+    sections[2] = (struct coverage_section){ offsetof(struct coverage, iwram), sizeof(gba->coverage.iwram) };
+    sections[3] = (struct coverage_section){ offsetof(struct coverage, rom), (coverage_rom_size(gba) + 15) / 16 };
+}
+
+/*
+** Clear the coverage.
+*/
+void
+coverage_reset(
+    struct gba *gba
+) {
+    struct coverage *coverage;
+    size_t i;
+
+    coverage = &gba->coverage;
+    memset(coverage, 0, sizeof(*coverage));
+
+    for (i = 0; i < COVERAGE_REGIONS; ++i) {
+        coverage->regions[i] = &coverage->sink;
+        coverage->masks[i] = 0;
+    }
+
+    coverage->regions[BIOS_REGION] = coverage->bios;
+    coverage->masks[BIOS_REGION] = BIOS_MASK;
+    coverage->regions[EWRAM_REGION] = coverage->ewram;
+    coverage->masks[EWRAM_REGION] = EWRAM_MASK;
+    coverage->regions[IWRAM_REGION] = coverage->iwram;
+    coverage->masks[IWRAM_REGION] = IWRAM_MASK;
+
+    for (i = CART_REGION_START; i <= CART_REGION_END; ++i) {
+        coverage->regions[i] = coverage->rom;
+        coverage->masks[i] = CART_MASK;
+    }
+}
+
+/*
+** Merge the content of a coverage file into the current coverage.
+**
+** Return true if the file is malformed or was written for another ROM.
+*/
+bool
+coverage_merge(
+    struct gba *gba,
+    uint8_t const *data,
+    size_t size
+) {
+    struct coverage_section sections[4];
+    uint32_t header[2];
+    size_t offset;
+    size_t i;
+    size_t j;
+
+    coverage_sections(gba, sections);
+
+    offset = strlen(COVERAGE_FILE_MAGIC) + sizeof(header);
+    for (i = 0; i < array_length(sections); ++i) {
+        offset += sections[i].size;
+    }
+
+    if (size != offset || memcmp(data, COVERAGE_FILE_MAGIC, strlen(COVERAGE_FILE_MAGIC))) {
+        return (true);
+    }
+
+    memcpy(header, data + strlen(COVERAGE_FILE_MAGIC), sizeof(header));
+    if (header[0] != db_rom_crc32(gba->memory.rom, coverage_rom_size(gba)) || header[1] != coverage_rom_size(gba)) {
+        return (true);
+    }
+
+    offset = strlen(COVERAGE_FILE_MAGIC) + sizeof(header);
+    for (i = 0; i < array_length(sections); ++i) {
+        uint8_t *bitmap;
+
+        bitmap = (uint8_t *)&gba->coverage + sections[i].offset;
+        for (j = 0; j < sections[i].size; ++j) {
+            bitmap[j] |= data[offset + j];
+        }
+        offset += sections[i].size;
+    }
+
+    return (false);
+}
+
+/*
+** Write the coverage to the given file.
+**
+** Return true if the write failed.
+*/
+bool
+coverage_write(
+    struct gba const *gba,
+    FILE *file
+) {
+    struct coverage_section sections[4];
+    uint32_t header[2];
+    size_t i;
+
+    coverage_sections(gba, sections);
+
+    header[0] = db_rom_crc32(gba->memory.rom, coverage_rom_size(gba));
+    header[1] = coverage_rom_size(gba);
+
+    if (
+           fwrite(COVERAGE_FILE_MAGIC, strlen(COVERAGE_FILE_MAGIC), 1, file) != 1
+        || fwrite(header, sizeof(header), 1, file) != 1
+    ) {
+        return (true);
+    }
+
+    for (i = 0; i < array_length(sections); ++i) {
+        uint8_t const *bitmap;
+
+        bitmap = (uint8_t const *)&gba->coverage + sections[i].offset;
+        if (sections[i].size && fwrite(bitmap, sections[i].size, 1, file) != 1) {
+            return (true);
+        }
+    }
+
+    return (false);
+}
+
+#endif /* WITH_COVERAGE */
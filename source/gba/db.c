@@ -7,1778 +7,220 @@
 **
 \******************************************************************************/
 
+#include <pthread.h>
 #include <string.h>
 #include "gba/gba.h"
+#include "gba/db.h"
+#include "db_index.h"
+
+static uint32_t crc32_table[8][256];
+static pthread_once_t crc32_table_once = PTHREAD_ONCE_INIT;
+
+static
+void
+db_crc32_init_table(void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < 256; ++i) {
+        uint32_t crc;
+
+        crc = i;
+        for (j = 0; j < 8; ++j) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+        crc32_table[0][i] = crc;
+    }
+
+    for (i = 0; i < 256; ++i) {
+        for (j = 1; j < 8; ++j) {
+            crc32_table[j][i] = (crc32_table[j - 1][i] >> 8) ^ crc32_table[0][crc32_table[j - 1][i] & 0xFF];
+        }
+    }
+}
 
 /*
-** Source:
-**   - https://github.com/profi200/open_agb_firm/issues/9
+** Compute the CRC32 of the given ROM, the one used by the usual ROM sets to identify each revision of a game.
 **
-** Thanks Zayd for sharing this list with me :)
+** The bytes are processed eight at a time ("slicing-by-8"), which breaks the dependency between
+** consecutive table lookups and lets the CPU run them in parallel.
 */
-static struct game_entry game_database[] = {
-    (struct game_entry){.code = "BJB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "007 - Everything or Nothing"},
-    (struct game_entry){.code = "BFB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Disney Games - Disney Sports Skateboarding + Football"},
-    (struct game_entry){.code = "BLQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Disney Games - Lilo & Stitch 2 + Peter Pan"},
-    (struct game_entry){.code = "BQJ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Game Pack - Hot Wheels Stunt Track + World Race"},
-    (struct game_entry){.code = "BB4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Game Pack! - Matchbox Missions"},
-    (struct game_entry){.code = "BUQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Game Pack! Uno + Skip-Bo"},
-    (struct game_entry){.code = "BX6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Battle for Bikini Bottom + Breakin' Da Rules"},
-    (struct game_entry){.code = "BU2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Battle for Bikini Bottom + Nicktoons Freeze Frame Frenzy"},
-    (struct game_entry){.code = "BL5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Bionicle + Knights' Kingdom"},
-    (struct game_entry){.code = "BWB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Brother Bear + Disney Princess"},
-    (struct game_entry){.code = "BLB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Brother Bear + The Lion King"},
-    (struct game_entry){.code = "BW2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Cartoon Network - Block Party + Speedway"},
-    (struct game_entry){.code = "BW9", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Columns Crown + ChuChu Rocket!"},
-    (struct game_entry){.code = "BLP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Disney Princess + The Lion King"},
-    (struct game_entry){.code = "B2E", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Dora the Explorer - Pirate Pig's Treasure + Super Star Adventures"},
-    (struct game_entry){.code = "BZP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Dr. Mario + Puzzle League"},
-    (struct game_entry){.code = "BUF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Dragon Ball Z - Buu's Fury + Dragon Ball GT - Transformation"},
-    (struct game_entry){.code = "BFW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Finding Nemo + Finding Nemo - The Continuing Adventures"},
-    (struct game_entry){.code = "BDZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Finding Nemo + Monsters, Inc."},
-    (struct game_entry){.code = "BIN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Finding Nemo + The Incredibles"},
-    (struct game_entry){.code = "BWC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Golden Nugget Casino - Texas Hold'em Poker"},
-    (struct game_entry){.code = "BHZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Hot Wheels - World Race + Velocity X"},
-    (struct game_entry){.code = "BLD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Lizzie McGuire - Disney Princess"},
-    (struct game_entry){.code = "BAR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Moto GP - GT 3 Advance"},
-    (struct game_entry){.code = "BRZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Power Rangers Time Force + Ninja Storm"},
-    (struct game_entry){.code = "BWQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Quad Desert Fury + Monster Trucks"},
-    (struct game_entry){.code = "BPU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Scooby-Doo + Scooby-Doo 2"},
-    (struct game_entry){.code = "BCV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Scooby-Doo and the Cyber Chase + Mystery Mayhem"},
-    (struct game_entry){.code = "BW3", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Sonic Advance + Chu Chu Rocket"},
-    (struct game_entry){.code = "BW7", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Sonic Battle + ChuChu Rocket!"},
-    (struct game_entry){.code = "BW4", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Sonic Battle + Sonic Advance"},
-    (struct game_entry){.code = "BW8", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Sonic Pinball + Columns Crown"},
-    (struct game_entry){.code = "BW6", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - Sonic Pinball Party + Sonic Battle"},
-    (struct game_entry){.code = "BSZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - SpongeBob SquarePants - Supersponge + Battle for Bikini Bottom"},
-    (struct game_entry){.code = "BDF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - SpongeBob SquarePants - Supersponge + Revenge of the Flying Dutchman"},
-    (struct game_entry){.code = "BRS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - SpongeBob SquarePants - Supersponge + Rugrats - Go Wild"},
-    (struct game_entry){.code = "BBJ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - SpongeBob SquarePants + Jimmy Neutron"},
-    (struct game_entry){.code = "BNE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - The Incredibles + Finding Nemo - The Continuing Adventure"},
-    (struct game_entry){.code = "B2B", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Games in 1 - The SpongeBob SquarePants Movie + Freeze Frame Frenzy"},
-    (struct game_entry){.code = "B2A", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 - Asterix & Obelix - PAF! Them All! + XXL"},
-    (struct game_entry){.code = "BLF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 - Dragon Ball Z 1 and 2"},
-    (struct game_entry){.code = "B94", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 - Pferd & Pony - Mein Pferdehof + Lass Uns Reiten 2"},
-    (struct game_entry){.code = "BX2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 - Spider-Man Mysterio's Menace & X2 Wolverine's Revenge"},
-    (struct game_entry){.code = "BX4", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 - Tony Hawk's Underground + Kelly Slater's Pro Surfer"},
-    (struct game_entry){.code = "BCS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 - V-Rally 3 - Stuntman"},
-    (struct game_entry){.code = "BXH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 Fun Pack - Madagascar - Operation Penguin + Shrek 2"},
-    (struct game_entry){.code = "BXG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 Fun Pack -Madagascar + Shrek 2"},
-    (struct game_entry){.code = "BS7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 Game Pack - Shark Tale + Shrek 2"},
-    (struct game_entry){.code = "BX3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 in 1 GamePack - Spider-Man + Spider-Man 2"},
-    (struct game_entry){.code = "BT5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "2 Jeux en 1 - Titeuf - Ze Gag Machine + Mega Compet"},
-    (struct game_entry){.code = "BC4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Game Pack - Candy Land + Chutes and Ladders + Memory"},
-    (struct game_entry){.code = "B3O", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Game Pack - Mouse Trap + Simon + Operation"},
-    (struct game_entry){.code = "B3U", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Game Pack - The Game of Life + Yahtzee + Payday"},
-    (struct game_entry){.code = "BXC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Game Pack! - Ker Plunk! + Toss Across + Tip It"},
-    (struct game_entry){.code = "B44", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Games in 1 - Rugrats, SpongeBob, Tak"},
-    (struct game_entry){.code = "BRQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Games in One - Majesco's Rec Room Challenge"},
-    (struct game_entry){.code = "B3N", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "3 Games in One - Majesco's Sports Pack"},
-    (struct game_entry){.code = "BI4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "4 Games on One Game Pak - GT Advance - GT Advance 2 - GT Advance 3 - Moto GP"},
-    (struct game_entry){.code = "BI7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "4 Games on One Game Pak - Nickelodeon"},
-    (struct game_entry){.code = "BI6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "4 Games on One Game Pak (Nickelodeon Movies)"},
-    (struct game_entry){.code = "A3Q", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "A Sound of Thunder"},
-    (struct game_entry){.code = "BAE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ace Combat Advance"},
-    (struct game_entry){.code = "ALX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ace Lightning"},
-    (struct game_entry){.code = "BAC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Action Man - Robot Atak"},
-    (struct game_entry){.code = "BAV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Activision Anthology"},
-    (struct game_entry){.code = "AG7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Advance GTA"},
-    (struct game_entry){.code = "BGC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Advance Guardian Heroes"},
-    (struct game_entry){.code = "BAG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Advance Guardian Heroes"},
-    (struct game_entry){.code = "AR7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Advance Rally"},
-    (struct game_entry){.code = "AWR", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Advance Wars"},
-    (struct game_entry){.code = "AW2", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Advance Wars 2 - Black Hole Rising"},
-    (struct game_entry){.code = "ADE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Adventure of Tokyo Disney Sea"},
-    (struct game_entry){.code = "AAO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Aero the Acro-Bat - Rascal Rival Revenge"},
-    (struct game_entry){.code = "ACE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Agassi Tennis Generation"},
-    (struct game_entry){.code = "TCH", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "AGB Aging Cartridge"},
-    (struct game_entry){.code = "BHQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Agent Hugo - Roborumble"},
-    (struct game_entry){.code = "AIL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Aggressive Inline"},
-    (struct game_entry){.code = "AAK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Air Force Delta Storm"},
-    (struct game_entry){.code = "BAZ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Akachan Doubutsu Sono"},
-    (struct game_entry){.code = "BZW", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Akagi"},
-    (struct game_entry){.code = "BAD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Aladdin"},
-    (struct game_entry){.code = "AJ6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Aladdin"},
-    (struct game_entry){.code = "BAB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Aleck Bordon Adventure - Tower & Shaft Advance"},
-    (struct game_entry){.code = "ATF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Alex Ferguson's Player Manager 2002"},
-    (struct game_entry){.code = "BAW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Alex Rider - Stormbreaker"},
-    (struct game_entry){.code = "BAH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Alien Hominid"},
-    (struct game_entry){.code = "AEV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Alienators - Evolution Continues"},
-    (struct game_entry){.code = "BAL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "All Grown Up - Express Yourself"},
-    (struct game_entry){.code = "AA3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "All-Star Baseball 2003"},
-    (struct game_entry){.code = "AA7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "All-Star Baseball 2004"},
-    (struct game_entry){.code = "AAR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Altered Beast - Guardian of the Realms"},
-    (struct game_entry){.code = "AAB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "American Bass Challenge"},
-    (struct game_entry){.code = "BAP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "American Dragon - Jake Long"},
-    (struct game_entry){.code = "BID", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "American Idol"},
-    (struct game_entry){.code = "AFG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "An American Tail - Fievel's Gold Rush"},
-    (struct game_entry){.code = "AFN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Angel Collection - Mezase! Gakuen no Fashion Leader"},
-    (struct game_entry){.code = "BEC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Angel Collection 2 - Pichimo ni Narou"},
-    (struct game_entry){.code = "AAG", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Angelique"},
-    (struct game_entry){.code = "AAN", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Animal Mania - DokiDoki Aishou Check"},
-    (struct game_entry){.code = "AAQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Animal Snap - Rescue Them 2 By 2"},
-    (struct game_entry){.code = "BAY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Animal Yokochou - Doki Doki Kyushutsu Daisakusen No Maki"},
-    (struct game_entry){.code = "BAX", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Animal Yokochou - Doki Doki Shinkyuu Shiken! no Kan"},
-    (struct game_entry){.code = "ANI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Animaniacs - Lights, Camera, Action!"},
-    (struct game_entry){.code = "ANU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Antz - Extreme Racing"},
-    (struct game_entry){.code = "ANZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Antz - Extreme Racing"},
-    (struct game_entry){.code = "AAZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ao-Zoura to Nakamatachi - Yume no Bouken"},
-    (struct game_entry){.code = "BPL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Archer Maclean's 3D Pool"},
-    (struct game_entry){.code = "AZN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Archer Maclean's Super Dropzone"},
-    (struct game_entry){.code = "BB5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Arctic Tale"},
-    (struct game_entry){.code = "AME", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Army Men - Operation Green"},
-    (struct game_entry){.code = "AY3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Army Men - Turf Wars"},
-    (struct game_entry){.code = "ASA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Army Men Advance"},
-    (struct game_entry){.code = "B8D", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Around the World in 80 Days"},
-    (struct game_entry){.code = "B2N", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Arthur and the Invisibles"},
-    (struct game_entry){.code = "BAM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ashita no Joe - Makka ni Moeagare!"},
-    (struct game_entry){.code = "AOB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Asterix & Obelix - Bash Them All!"},
-    (struct game_entry){.code = "BLX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Asterix & Obelix - XXL"},
-    (struct game_entry){.code = "BTA", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Astro Boy - Omega Factor"},
-    (struct game_entry){.code = "AAV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Atari Anniversary Advance"},
-    (struct game_entry){.code = "ATL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Atlantis - The Lost Empire"},
-    (struct game_entry){.code = "BET", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Atomic Betty"},
-    (struct game_entry){.code = "AQR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "ATV Quad Power Racing"},
-    (struct game_entry){.code = "B3B", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "ATV Thunder - Ridge Riders"},
-    (struct game_entry){.code = "BQZ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Avatar - The Last Airbender"},
-    (struct game_entry){.code = "BBW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Avatar - The Last Airbender - The Burning Earth"},
-    (struct game_entry){.code = "AZA", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Azumanga Daiou Advance"},
-    (struct game_entry){.code = "BBV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Babar - To the Rescue"},
-    (struct game_entry){.code = "BBC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Back to Stone"},
-    (struct game_entry){.code = "ABK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "BackTrack"},
-    (struct game_entry){.code = "ACK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Baseball"},
-    (struct game_entry){.code = "BCY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Baseball 2006"},
-    (struct game_entry){.code = "AYB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Basketball"},
-    (struct game_entry){.code = "AYF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Football"},
-    (struct game_entry){.code = "BYH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Hockey"},
-    (struct game_entry){.code = "BYF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard NFL Football 2006"},
-    (struct game_entry){.code = "BS6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Skateboarding"},
-    (struct game_entry){.code = "BC7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Sports - Baseball 2007"},
-    (struct game_entry){.code = "BB7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Sports - Basketball 2007"},
-    (struct game_entry){.code = "BF7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Backyard Sports - Football 2007"},
-    (struct game_entry){.code = "AHE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bakuten Shoot Beyblade - Gekitou! Saikyou Blader"},
-    (struct game_entry){.code = "AB8", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bakuten Shoot Beyblade 2002 - Ikuze! Bakutou! Chou Jiryoku Battle!!"},
-    (struct game_entry){.code = "A3E", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bakuten Shoot Beyblade 2002 - Team Battle!! Daichi Hen"},
-    (struct game_entry){.code = "A3W", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bakuten Shoot Beyblade 2002 - Team Battle!! Takao Hen"},
-    (struct game_entry){.code = "BGD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Baldurs Gate - Dark Alliance"},
-    (struct game_entry){.code = "AEE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ballistic - Ecks vs Sever"},
-    (struct game_entry){.code = "BAJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Banjo Pilot"},
-    (struct game_entry){.code = "BKZ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Banjo-Kazooie - Grunty's Revenge"},
-    (struct game_entry){.code = "BAU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie - The Princess and the Pauper"},
-    (struct game_entry){.code = "BE5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie and the Magic of Pegasus"},
-    (struct game_entry){.code = "BBN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie as the Island Princess"},
-    (struct game_entry){.code = "AVB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie Groovy Games"},
-    (struct game_entry){.code = "AI8", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie Horse Adventures - Blue Ribbon Race"},
-    (struct game_entry){.code = "BB3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie in the 12 Dancing Princesses"},
-    (struct game_entry){.code = "BBE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Barbie Superpack - Secret Agent + Groovy Games"},
-    (struct game_entry){.code = "BBY", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Barnyard"},
-    (struct game_entry){.code = "ABP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Baseball Advance"},
-    (struct game_entry){.code = "AZB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Bass Tsuri Shiyouze!"},
-    (struct game_entry){.code = "BBG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Batman Begins"},
-    (struct game_entry){.code = "BAT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Batman Rise of Sin Tzu"},
-    (struct game_entry){.code = "ABT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Batman Vengeance"},
-    (struct game_entry){.code = "BDX", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Battle B-Daman"},
-    (struct game_entry){.code = "BBM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Battle B-Daman - Fire Spirits"},
-    (struct game_entry){.code = "BBF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Battle x Battle - Kyoudai Ou Densetsu"},
-    (struct game_entry){.code = "ABE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "BattleBots - Beyond the BattleBox"},
-    (struct game_entry){.code = "BBD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "BattleBots - Design & Destroy"},
-    (struct game_entry){.code = "A8L", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "BB Ball"},
-    (struct game_entry){.code = "AH5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Beast Shooter - Mezase Beast King!"},
-    (struct game_entry){.code = "BHB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Best Friends - Dogs & Cats"},
-    (struct game_entry){.code = "A8Y", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Best Play Pro Yakyuu"},
-    (struct game_entry){.code = "BB2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Beyblade G-Revolution"},
-    (struct game_entry){.code = "BEY", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Beyblade VForce - Ultimate Blader Jam"},
-    (struct game_entry){.code = "BBX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bibi Blocksberg - Der Magische Hexenkreis"},
-    (struct game_entry){.code = "BUX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bibi und Tina - Ferien auf dem Martinshof"},
-    (struct game_entry){.code = "BIB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bible Game, The"},
-    (struct game_entry){.code = "B63", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Big Mutha Truckers"},
-    (struct game_entry){.code = "BIO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bionicle"},
-    (struct game_entry){.code = "A5A", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bionicle - Matoran Adventures"},
-    (struct game_entry){.code = "BIL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bionicle - Maze of Shadows"},
-    (struct game_entry){.code = "BIH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bionicle Heroes"},
-    (struct game_entry){.code = "BVD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Boundish"},
-    (struct game_entry){.code = "BVA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Coloris"},
-    (struct game_entry){.code = "BVB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Dial Hex"},
-    (struct game_entry){.code = "BVH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Digidrive"},
-    (struct game_entry){.code = "BVC", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Dotstream"},
-    (struct game_entry){.code = "BVE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Orbital"},
-    (struct game_entry){.code = "BVG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "bit Generations - Soundvoyager"},
-    (struct game_entry){.code = "AB6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Black Belt Challenge"},
-    (struct game_entry){.code = "AWE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Black Black - Bura Bura"},
-    (struct game_entry){.code = "AXB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Black Matrix Zero"},
-    (struct game_entry){.code = "AQX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Blackthorne"},
-    (struct game_entry){.code = "BBH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Blades of Thunder"},
-    (struct game_entry){.code = "BLE", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bleach Advance"},
-    (struct game_entry){.code = "ABR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Blender Bros."},
-    (struct game_entry){.code = "AT9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "BMX Trick Racer"},
-    (struct game_entry){.code = "B6E", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Board Games Classics"},
-    (struct game_entry){.code = "BB9", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boboboubo Boubobo - 9 Kiwame Senshi Gyagu Yuugou"},
-    (struct game_entry){.code = "BOB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boboboubo Boubobo - Maji De!! Shinken Battle"},
-    (struct game_entry){.code = "A8V", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boboboubo Boubobo - Ougi 87.5 Bakuretsu Hanage Shinken"},
-    (struct game_entry){.code = "BOS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boboboubo Boubobo Bakutou Hajike Taisen"},
-    (struct game_entry){.code = "U3I", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Boktai - The Sun is in Your Hand"},
-    (struct game_entry){.code = "U32", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Boktai 2 - Solar Boy Django"},
-    (struct game_entry){.code = "ABC", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boku ha Koukuu Kanseikan"},
-    (struct game_entry){.code = "AJZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bomberman Jetters"},
-    (struct game_entry){.code = "BOM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bomberman Jetters - Game Collection"},
-    (struct game_entry){.code = "AMH", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Bomberman Max 2 - Blue Advance"},
-    (struct game_entry){.code = "AMY", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Bomberman Max 2 - Red Advance"},
-    (struct game_entry){.code = "ABS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bomberman Tournament"},
-    (struct game_entry){.code = "BKW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bookworm"},
-    (struct game_entry){.code = "BPD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bouken Yuuki PlaStar World - Densetsu no PlaStar Gate EX"},
-    (struct game_entry){.code = "APJ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bouken Yuuki Pluster World - Densetsu no PlustoGate"},
-    (struct game_entry){.code = "A2P", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bouken Yuuki Pluster World - Pluston GP"},
-    (struct game_entry){.code = "BOV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Bouken-Ou Beet - Busters Road"},
-    (struct game_entry){.code = "BBS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Boukyaku no Senritsu"},
-    (struct game_entry){.code = "ABD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boulder Dash EX"},
-    (struct game_entry){.code = "ABO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Boxing Fever"},
-    (struct game_entry){.code = "A2R", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bratz"},
-    (struct game_entry){.code = "BBZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bratz - Babyz"},
-    (struct game_entry){.code = "BXF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Bratz - Forever Diamondz"},
-    (struct game_entry){.code = "BRR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bratz - Rock Angelz"},
-    (struct game_entry){.code = "BBU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bratz - The Movie"},
-    (struct game_entry){.code = "B6Z", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Breakout + Centipede + Warlords"},
-    (struct game_entry){.code = "ABF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Breath of Fire"},
-    (struct game_entry){.code = "AB2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Breath of Fire II"},
-    (struct game_entry){.code = "ABY", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Britney's Dance Beat"},
-    (struct game_entry){.code = "ABJ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Broken Sword - The Shadow of the Templars"},
-    (struct game_entry){.code = "BBR", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Brother Bear"},
-    (struct game_entry){.code = "ALE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bruce Lee - Return of the Legend"},
-    (struct game_entry){.code = "AON", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bubble Bobble - Old & New"},
-    (struct game_entry){.code = "A2B", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Bubble Bobble - Old & New"},
-    (struct game_entry){.code = "AVY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Buffy - Im Bann der Daemonen"},
-    (struct game_entry){.code = "ABW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Butt-Ugly Martians - B.K.M. Battles"},
-    (struct game_entry){.code = "AUQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Butt-Ugly Martians - B.K.M. Battles"},
-    (struct game_entry){.code = "BCG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cabbage Patch Kids - The Patch Puppy Rescue"},
-    (struct game_entry){.code = "A8H", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cabela's Big Game Hunter"},
-    (struct game_entry){.code = "BG5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cabela's Big Game Hunter - 2005 Adventures"},
-    (struct game_entry){.code = "ACP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Caesars Palace Advance"},
-    (struct game_entry){.code = "BIX", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_NONE, .title = "Calciobit"},
-    (struct game_entry){.code = "BLC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Camp Lazlo - Leaky Lake Games"},
-    (struct game_entry){.code = "BC6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Capcom Classics - Mini Mix"},
-    (struct game_entry){.code = "AKY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Captain Tsubasa - Eikou no Kiseki"},
-    (struct game_entry){.code = "ACB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Car Battler Joe"},
-    (struct game_entry){.code = "BK3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Card Captor Sakura - Sakura Card de Mini Game"},
-    (struct game_entry){.code = "BKS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Card Captor Sakura - Sakura to Card to Otomodachi"},
-    (struct game_entry){.code = "PEA", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Card E-Reader"},
-    (struct game_entry){.code = "A8C", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Card Party"},
-    (struct game_entry){.code = "BEA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Care Bears - The Care Quest"},
-    (struct game_entry){.code = "AED", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Carrera Power Slide"},
-    (struct game_entry){.code = "BCA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cars"},
-    (struct game_entry){.code = "BCP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cars Mater-National Championship"},
-    (struct game_entry){.code = "AC9", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cartoon Network Block Party"},
-    (struct game_entry){.code = "ANR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cartoon Network Speedway"},
-    (struct game_entry){.code = "ACS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Casper"},
-    (struct game_entry){.code = "A2C", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Castlevania - Aria of Sorrow"},
-    (struct game_entry){.code = "AAM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Castlevania - Circle of the Moon"},
-    (struct game_entry){.code = "ACH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Castlevania - Harmony of Dissonance"},
-    (struct game_entry){.code = "BXK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Castlevania Double Pack"},
-    (struct game_entry){.code = "BCW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Catwoman"},
-    (struct game_entry){.code = "AN3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Catz"},
-    (struct game_entry){.code = "BCF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Charlie and the Chocolate Factory"},
-    (struct game_entry){.code = "BCJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Charlotte's Web"},
-    (struct game_entry){.code = "ACY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chessmaster"},
-    (struct game_entry){.code = "BCH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chicken Little"},
-    (struct game_entry){.code = "B6F", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chicken Shoot"},
-    (struct game_entry){.code = "B6G", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chicken Shoot 2"},
-    (struct game_entry){.code = "AOC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chobits for GameBoy Advance"},
-    (struct game_entry){.code = "A5B", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chocobo Land - A Game of Dice"},
-    (struct game_entry){.code = "ACJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chou Makai-Mura R"},
-    (struct game_entry){.code = "ACR", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Chu Chu Rocket!"},
-    (struct game_entry){.code = "BCM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "CIMA - The Enemy"},
-    (struct game_entry){.code = "BCD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cinderella - Magical Dreams"},
-    (struct game_entry){.code = "B2S", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cinnamon - Yume no Daibouken"},
-    (struct game_entry){.code = "B43", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cinnamon Fuwafuwa Daisakusen"},
-    (struct game_entry){.code = "BPS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cinnamoroll Kokoniiruyo"},
-    (struct game_entry){.code = "FBM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Bomberman"},
-    (struct game_entry){.code = "FAD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Castlevania"},
-    (struct game_entry){.code = "FDK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Donkey Kong"},
-    (struct game_entry){.code = "FDM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Dr. Mario"},
-    (struct game_entry){.code = "FEB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - ExciteBike"},
-    (struct game_entry){.code = "FIC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Ice Climber"},
-    (struct game_entry){.code = "FMR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Metroid"},
-    (struct game_entry){.code = "FP7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Pac-Man"},
-    (struct game_entry){.code = "FSM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Super Mario Bros."},
-    (struct game_entry){.code = "FZL", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - The Legend of Zelda"},
-    (struct game_entry){.code = "FXV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Xevious"},
-    (struct game_entry){.code = "FLB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Classic NES Series - Zelda II - The Adventure of Link"},
-    (struct game_entry){.code = "BC5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cocoto - Kart Racer"},
-    (struct game_entry){.code = "BC8", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cocoto Platform Jumper"},
-    (struct game_entry){.code = "BND", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Codename Kids Next Door - Operation S.O.D.A."},
-    (struct game_entry){.code = "ACM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Colin McRae Rally 2.0"},
-    (struct game_entry){.code = "ACG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Columns Crown"},
-    (struct game_entry){.code = "AQC", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Combat Choro Q - Advance Daisakusen"},
-    (struct game_entry){.code = "BW5", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Combo Pack - Sonic Advance + Sonic Pinball Party"},
-    (struct game_entry){.code = "ACZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Comix Zone"},
-    (struct game_entry){.code = "B65", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Connect Four - Perfection - Trouble"},
-    (struct game_entry){.code = "AAW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Contra Advance - The Alien Wars EX"},
-    (struct game_entry){.code = "AVC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Corvette"},
-    (struct game_entry){.code = "B5A", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash & Spyro - Super Pack Volume 1"},
-    (struct game_entry){.code = "B52", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash & Spyro - Super Pack Volume 2"},
-    (struct game_entry){.code = "B53", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash & Spyro Superpack - Ripto's Rampage + The Cortex Conspiracy"},
-    (struct game_entry){.code = "B54", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash & Spyro Superpack - The Huge Adventure + Season of Ice"},
-    (struct game_entry){.code = "ACQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Bandicoot - The Huge Adventure"},
-    (struct game_entry){.code = "AC8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Bandicoot 2 - N-Tranced"},
-    (struct game_entry){.code = "ACU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Bandicoot Advance"},
-    (struct game_entry){.code = "BKD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Bandicoot Advance - Wakuwaku Tomodachi Daisakusen"},
-    (struct game_entry){.code = "BD4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Bandicoot Purple - Ripto's Rampage"},
-    (struct game_entry){.code = "BCN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Nitro Kart"},
-    (struct game_entry){.code = "BQC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash of the Titans"},
-    (struct game_entry){.code = "B8A", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Crash Superpack - N-Tranced + Nitro Kart"},
-    (struct game_entry){.code = "BC2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Crayon Shin chan - Densetsu wo Yobu Omake no Miyako Shockgaan"},
-    (struct game_entry){.code = "BKC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crayon Shin-Chan - Arashi no Yobu Cinema-Land no Daibouken!"},
-    (struct game_entry){.code = "ACC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crazy Chase"},
-    (struct game_entry){.code = "BCR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crazy Frog Racer"},
-    (struct game_entry){.code = "A3C", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crazy Taxi - Catch a Ride"},
-    (struct game_entry){.code = "ACT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Creatures"},
-    (struct game_entry){.code = "A6C", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Croket! - Yume no Banker Survival!"},
-    (struct game_entry){.code = "BK2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Croket! 2 - Yami no Bank to Banqueen"},
-    (struct game_entry){.code = "B3K", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Croket! 3 - Guranyuu Oukoku no Nazo"},
-    (struct game_entry){.code = "BK4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Croket! 4 - Bank no Mori no Mamorigami"},
-    (struct game_entry){.code = "AQD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crouching Tiger Hidden Dragon"},
-    (struct game_entry){.code = "ACF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cruis'n Velocity"},
-    (struct game_entry){.code = "BCB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Crushed Baseball"},
-    (struct game_entry){.code = "AC7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "CT Special Forces"},
-    (struct game_entry){.code = "A9C", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "CT Special Forces 2 - Back in the Trenches"},
-    (struct game_entry){.code = "BC3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "CT Special Forces 3 - Bioterror"},
-    (struct game_entry){.code = "ACX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cubix - Robots for Everyone - Clash 'N Bash"},
-    (struct game_entry){.code = "B3J", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Curious George"},
-    (struct game_entry){.code = "ARJ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Custom Robo GX"},
-    (struct game_entry){.code = "AZ3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Cyberdrive Zoids - Kijuu no Senshi Hyuu"},
-    (struct game_entry){.code = "AHM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dai-Mahjong"},
-    (struct game_entry){.code = "ADS", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Daisenryaku for GameBoy Advance"},
-    (struct game_entry){.code = "ATD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Daisuki Teddy"},
-    (struct game_entry){.code = "BDN", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dan Doh!! - Tobase Shouri no Smile Shot!!"},
-    (struct game_entry){.code = "AXH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dan Doh!! Xi"},
-    (struct game_entry){.code = "A9S", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dancing Sword - Senkou"},
-    (struct game_entry){.code = "BUE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Danny Phantom - The Ultimate Enemy"},
-    (struct game_entry){.code = "BQY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Danny Phantom - Urban Jungle"},
-    (struct game_entry){.code = "AVL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Daredevil"},
-    (struct game_entry){.code = "A2D", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Darius R"},
-    (struct game_entry){.code = "ADA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dark Arena"},
-    (struct game_entry){.code = "AX2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dave Mirra Freestyle BMX 2"},
-    (struct game_entry){.code = "AB3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dave Mirra Freestyle BMX 3"},
-    (struct game_entry){.code = "ABQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "David Beckham Soccer"},
-    (struct game_entry){.code = "AD6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Davis Cup"},
-    (struct game_entry){.code = "BDE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dead to Rights"},
-    (struct game_entry){.code = "BZN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Deal or No Deal"},
-    (struct game_entry){.code = "A2F", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Defender"},
-    (struct game_entry){.code = "ADH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Defender of the Crown"},
-    (struct game_entry){.code = "AC5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "DemiKids - Dark Version"},
-    (struct game_entry){.code = "AL4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "DemiKids - Light Version"},
-    (struct game_entry){.code = "A9A", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Demon Driver - Time to Burn Rubber!"},
-    (struct game_entry){.code = "ADB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Denki Blocks!"},
-    (struct game_entry){.code = "AST", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Densetsu no Stafi"},
-    (struct game_entry){.code = "AVF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Densetsu no Stafi 2"},
-    (struct game_entry){.code = "B3D", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Densetsu no Stafi 3"},
-    (struct game_entry){.code = "A8P", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Derby Stallion Advance"},
-    (struct game_entry){.code = "ADI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Desert Strike Advance"},
-    (struct game_entry){.code = "ADX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dexter's Laboratory - Chess Challenge"},
-    (struct game_entry){.code = "ADL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dexter's Laboratory - Deesaster Strikes!"},
-    (struct game_entry){.code = "A3O", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Di Gi Charat - DigiCommunication"},
-    (struct game_entry){.code = "ADD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Diadroids World - Evil Teikoku no Yabou"},
-    (struct game_entry){.code = "BXW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Die Wilden Fussball Kerle - Gefahr im Wilde Kerle Land"},
-    (struct game_entry){.code = "BWU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Die wilden Fussballkerle - Entscheidung im Teufelstopf"},
-    (struct game_entry){.code = "BDK", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Digi Communication 2 in 1 Datou! Black Gemagema Dan"},
-    (struct game_entry){.code = "A8S", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Digimon - Battle Spirit"},
-    (struct game_entry){.code = "BDS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Digimon - Battle Spirit 2"},
-    (struct game_entry){.code = "BDG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Digimon Racing"},
-    (struct game_entry){.code = "BDJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Digimon Racing"},
-    (struct game_entry){.code = "AD3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dinotopia - The Timestone Pirates"},
-    (struct game_entry){.code = "AQP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Princess"},
-    (struct game_entry){.code = "BQN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Princess - Royal Adventure"},
-    (struct game_entry){.code = "A2A", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Sports - Basketball"},
-    (struct game_entry){.code = "A3D", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Sports - Football"},
-    (struct game_entry){.code = "AOM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Sports - Motocross"},
-    (struct game_entry){.code = "A4D", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Sports - Skateboarding"},
-    (struct game_entry){.code = "A5D", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Sports - Snowboarding"},
-    (struct game_entry){.code = "A6D", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney Sports - Soccer"},
-    (struct game_entry){.code = "BD8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Disney's Party"},
-    (struct game_entry){.code = "BBK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "DK - King of Swing"},
-    (struct game_entry){.code = "B82", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dogz"},
-    (struct game_entry){.code = "BFE", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dogz - Fashion"},
-    (struct game_entry){.code = "BIM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dogz 2"},
-    (struct game_entry){.code = "ADQ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dokapon"},
-    (struct game_entry){.code = "A56", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "DokiDoki Cooking Series 1 - Komugi-chan no Happy Cake"},
-    (struct game_entry){.code = "A8O", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "DokiDoki Cooking Series 2 - Gourmet Kitchen - Suteki na Obentou"},
-    (struct game_entry){.code = "AYA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dokodemo Taikyoku - Yakuman Advance"},
-    (struct game_entry){.code = "ADO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Domo-kun no Fushigi Terebi"},
-    (struct game_entry){.code = "ADK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Donald Duck Advance"},
-    (struct game_entry){.code = "AAD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Donald Duck Advance"},
-    (struct game_entry){.code = "BDA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Donchan Puzzle Hanabi de Dohn Advance"},
-    (struct game_entry){.code = "A5N", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Donkey Kong Country"},
-    (struct game_entry){.code = "B2D", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Donkey Kong Country 2"},
-    (struct game_entry){.code = "BDQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Donkey Kong Country 3"},
-    (struct game_entry){.code = "ADM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Doom"},
-    (struct game_entry){.code = "A9D", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Doom II"},
-    (struct game_entry){.code = "BXP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dora the Explorer - Dora's World Adventure"},
-    (struct game_entry){.code = "BER", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dora the Explorer - Super Spies"},
-    (struct game_entry){.code = "BDO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dora the Explorer - Super Star Adventures!"},
-    (struct game_entry){.code = "AER", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dora the Explorer - The Search for the Pirate Pig's Treasure"},
-    (struct game_entry){.code = "ADP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Doraemon - Dokodemo Walker"},
-    (struct game_entry){.code = "ADR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Doraemon - Midori no Wakusei DokiDoki Daikyuushutsu!"},
-    (struct game_entry){.code = "BDD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Double Dragon Advance"},
-    (struct game_entry){.code = "A8D", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Doubutsu Shima no Chobi Gurumi"},
-    (struct game_entry){.code = "BDC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Doubutsujima no Chobi Gurumi 2 - Tamachan Monogatari"},
-    (struct game_entry){.code = "ADW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Downforce"},
-    (struct game_entry){.code = "A6T", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dr. Muto"},
-    (struct game_entry){.code = "AQT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dr. Seuss' - The Cat in the Hat"},
-    (struct game_entry){.code = "BUO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dr. Sudoku"},
-    (struct game_entry){.code = "BDV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball - Advanced Adventure"},
-    (struct game_entry){.code = "BT4", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball GT - Transformation"},
-    (struct game_entry){.code = "BG3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball Z - Buu's Fury"},
-    (struct game_entry){.code = "ADZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball Z - Collectible Card Game"},
-    (struct game_entry){.code = "AZJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball Z - Supersonic Warriors"},
-    (struct game_entry){.code = "BDB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball Z - Taiketsu"},
-    (struct game_entry){.code = "ALG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball Z - The Legacy of Goku"},
-    (struct game_entry){.code = "ALF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Ball Z - The Legacy of Goku II"},
-    (struct game_entry){.code = "A5G", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Drive - World D Break"},
-    (struct game_entry){.code = "AT2", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Quest Characters - Torneko no Daibouken 2 Advance"},
-    (struct game_entry){.code = "BD3", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Quest Characters - Torneko no Daibouken 3 Advance"},
-    (struct game_entry){.code = "A9H", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Quest Monsters - Caravan Heart"},
-    (struct game_entry){.code = "BD9", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon Tales - Dragon Adventures"},
-    (struct game_entry){.code = "BJD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dragon's Rock"},
-    (struct game_entry){.code = "AJY", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Drake & Josh"},
-    (struct game_entry){.code = "V49", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Drill Dozer"},
-    (struct game_entry){.code = "B3R", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Driv3r"},
-    (struct game_entry){.code = "ADV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Driven"},
-    (struct game_entry){.code = "ADU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Driver 2 Advance"},
-    (struct game_entry){.code = "AOE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Drome Racers"},
-    (struct game_entry){.code = "AD7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Droopy's Tennis Open"},
-    (struct game_entry){.code = "AB9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dual Blades"},
-    (struct game_entry){.code = "BD6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Duel Masters - Kaijudo Showdown"},
-    (struct game_entry){.code = "AA9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Duel Masters - Sempai Legends"},
-    (struct game_entry){.code = "BDU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Duel Masters - Shadow of the Code"},
-    (struct game_entry){.code = "BD2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Duel Masters 2"},
-    (struct game_entry){.code = "BD5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Duel Masters 2 - Kirifuda Shoubu Version"},
-    (struct game_entry){.code = "AD9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Duke Nukem Advance"},
-    (struct game_entry){.code = "AD4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dungeons & Dragons - Eye of the Beholder"},
-    (struct game_entry){.code = "B36", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Dynasty Warriors Advance"},
-    (struct game_entry){.code = "AET", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "E.T. - The Extra-Terrestrial"},
-    (struct game_entry){.code = "AEJ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Earthworm Jim"},
-    (struct game_entry){.code = "AJ4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Earthworm Jim 2"},
-    (struct game_entry){.code = "AES", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ecks vs Sever"},
-    (struct game_entry){.code = "AE3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ed, Edd n Eddy - Jawbreakers!"},
-    (struct game_entry){.code = "BED", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ed, Edd n Eddy - The Mis-Edventures"},
-    (struct game_entry){.code = "AEM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Egg Mania"},
-    (struct game_entry){.code = "AEK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Elemix!"},
-    (struct game_entry){.code = "ANW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Elevator Action - Old & New"},
-    (struct game_entry){.code = "BEL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Elf - The Movie"},
-    (struct game_entry){.code = "BEB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Elf Bowling 1 & 2"},
-    (struct game_entry){.code = "BZR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Enchanted - Once Upon Andalasia"},
-    (struct game_entry){.code = "BEN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Eragon"},
-    (struct game_entry){.code = "PSA", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_RTC,  .title = "E-Reader"},
-    (struct game_entry){.code = "BEJ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Erementar Gerad"},
-    (struct game_entry){.code = "AGR", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "ESPN Final Round Golf 2002"},
-    (struct game_entry){.code = "AMG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "ESPN Great Outdoor Games - Bass 2002"},
-    (struct game_entry){.code = "AWI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "ESPN International Winter Sports 2002"},
-    (struct game_entry){.code = "AWX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "ESPN Winter X-Games Snowboarding 2002"},
-    (struct game_entry){.code = "AXS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "ESPN X-Games Skateboarding"},
-    (struct game_entry){.code = "AEL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "European Super League"},
-    (struct game_entry){.code = "BEV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ever Girl"},
-    (struct game_entry){.code = "AMO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EX Monopoly"},
-    (struct game_entry){.code = "AEG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Extreme Ghostbusters - Code Ecto-1"},
-    (struct game_entry){.code = "BES", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Extreme Skate Adventure"},
-    (struct game_entry){.code = "BE4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Eyeshield 21 - Devilbats Devildays"},
-    (struct game_entry){.code = "A22", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EZ-Talk - Shokyuu Hen 1"},
-    (struct game_entry){.code = "A23", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EZ-Talk - Shokyuu Hen 2"},
-    (struct game_entry){.code = "A24", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EZ-Talk - Shokyuu Hen 3"},
-    (struct game_entry){.code = "A25", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EZ-Talk - Shokyuu Hen 4"},
-    (struct game_entry){.code = "A26", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EZ-Talk - Shokyuu Hen 5"},
-    (struct game_entry){.code = "A27", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "EZ-Talk - Shokyuu Hen 6"},
-    (struct game_entry){.code = "AF8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "F1 2002"},
-    (struct game_entry){.code = "AFT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "F-14 Tomcat"},
-    (struct game_entry){.code = "BYA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "F24 - Stealth Fighter"},
-    (struct game_entry){.code = "FSR", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series - Dai 2 Ji Super Robot Taisen"},
-    (struct game_entry){.code = "FGZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series - Kido Senshi Z Gundam Hot Scramble"},
-    (struct game_entry){.code = "FSO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 10 - Star Soldier"},
-    (struct game_entry){.code = "FMB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 11 - Mario Bros."},
-    (struct game_entry){.code = "FCL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 12 - Clu Clu Land"},
-    (struct game_entry){.code = "FBF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 13 - Balloon Fight"},
-    (struct game_entry){.code = "FWC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 14 - Wrecking Crew"},
-    (struct game_entry){.code = "FDD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 16 - Dig Dug"},
-    (struct game_entry){.code = "FTB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 17 - Takahashi Meijin no Bouken Jima"},
-    (struct game_entry){.code = "FMK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 18 - Makaimura"},
-    (struct game_entry){.code = "FTW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 19 - TwinBee"},
-    (struct game_entry){.code = "FGG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 20 - Ganbare Goemon! Karakuri Douchuu"},
-    (struct game_entry){.code = "FM2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 21 - Super Mario Bros. 2"},
-    (struct game_entry){.code = "FNM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 22 - Nazo no Murasame Shiro"},
-    (struct game_entry){.code = "FPT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 24 - Hikari Shinwa - Palutena no Kagame"},
-    (struct game_entry){.code = "FFM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 26 - Mukashi Hanashi - Shin Onigashima"},
-    (struct game_entry){.code = "FTK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 27 - Famicom Tantei Club - Kieta Koukeisha"},
-    (struct game_entry){.code = "FTU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 28 - Famicom Tantei Club Part II - Ushiro ni Tatsu Shoujo"},
-    (struct game_entry){.code = "FSD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 30 - SD Gundam World - Gachapon Senshi Scramble Wars"},
-    (struct game_entry){.code = "FPM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 6 - Pac-Man"},
-    (struct game_entry){.code = "FMP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Famicom Mini Series 8 - Mappy"},
-    (struct game_entry){.code = "B2F", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Family Feud"},
-    (struct game_entry){.code = "AAT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Family Tennis Advance"},
-    (struct game_entry){.code = "AN7", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Famista Advance"},
-    (struct game_entry){.code = "AJE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fancy Pocket"},
-    (struct game_entry){.code = "BFC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Fantasic Children"},
-    (struct game_entry){.code = "BF4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fantastic 4"},
-    (struct game_entry){.code = "BH4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fantastic 4 - Flame On"},
-    (struct game_entry){.code = "AAX", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Fantastic Maerchen - Cake-yasan Monogatari"},
-    (struct game_entry){.code = "BFU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fear Factor Unleashed"},
-    (struct game_entry){.code = "AF9", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Field of Nine - Digital Edition 2001"},
-    (struct game_entry){.code = "BF6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FIFA 06"},
-    (struct game_entry){.code = "B7F", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FIFA 07"},
-    (struct game_entry){.code = "AFJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FIFA 2003"},
-    (struct game_entry){.code = "BFI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FIFA 2004"},
-    (struct game_entry){.code = "BF5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FIFA 2005"},
-    (struct game_entry){.code = "B6W", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FIFA World Cup 2006"},
-    (struct game_entry){.code = "BOX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FightBox"},
-    (struct game_entry){.code = "AFL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "FILA Decathlon"},
-    (struct game_entry){.code = "BFF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fantasy I & II - Dawn of Souls"},
-    (struct game_entry){.code = "BZ4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fantasy IV Advance"},
-    (struct game_entry){.code = "AFX", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fantasy Tactics Advance"},
-    (struct game_entry){.code = "BZ5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fantasy V Advance"},
-    (struct game_entry){.code = "BZ6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fantasy VI Advance"},
-    (struct game_entry){.code = "AFF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fight One"},
-    (struct game_entry){.code = "AFW", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Final Fire Pro Wrestling - Yume no Dantai Unei!"},
-    (struct game_entry){.code = "AZI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Finding Nemo"},
-    (struct game_entry){.code = "BFN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Finding Nemo"},
-    (struct game_entry){.code = "BZI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Finding Nemo - The Continuing Adventures"},
-    (struct game_entry){.code = "AE7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fire Emblem"},
-    (struct game_entry){.code = "AFE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fire Emblem - Fuuin no Tsurugi"},
-    (struct game_entry){.code = "BE8", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fire Emblem - The Sacred Stones"},
-    (struct game_entry){.code = "AFP", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fire Pro Wrestling"},
-    (struct game_entry){.code = "AFY", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fire Pro Wrestling 2"},
-    (struct game_entry){.code = "BLH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Flushed Away"},
-    (struct game_entry){.code = "BF3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ford Racing 3"},
-    (struct game_entry){.code = "AFM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Formation Soccer 2002"},
-    (struct game_entry){.code = "AFO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fortress"},
-    (struct game_entry){.code = "BFY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Foster's Home for Imaginary Friends"},
-    (struct game_entry){.code = "BFK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Franklin the Turtle"},
-    (struct game_entry){.code = "BFL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Franklin's Great Adventures"},
-    (struct game_entry){.code = "BFS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Freekstyle"},
-    (struct game_entry){.code = "AFQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Frogger Advance - The Great Quest"},
-    (struct game_entry){.code = "AFR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Frogger's Adventures - Temple of the Frog"},
-    (struct game_entry){.code = "AFB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Frogger's Adventures 2 - The Lost Wand"},
-    (struct game_entry){.code = "BFJ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Frogger's Journey - The Forgotten Relic"},
-    (struct game_entry){.code = "ADC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fruit Chase"},
-    (struct game_entry){.code = "BFD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Fruit Mura no Doubutsu Tachi"},
-    (struct game_entry){.code = "AF4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fushigi no Kuni no Alice"},
-    (struct game_entry){.code = "AFA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Fushigi no Kuni no Angelique"},
-    (struct game_entry){.code = "BFP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Futari ha Precure Arienaai Yume no Kuni ha Daimeikyuu"},
-    (struct game_entry){.code = "BFM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Futari wa Precure Max Heart Maji! Maji! Fight de IN Janai"},
-    (struct game_entry){.code = "BFT", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_NONE, .title = "F-Zero - Climax"},
-    (struct game_entry){.code = "BFZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "F-Zero - GP Legends"},
-    (struct game_entry){.code = "AFZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "F-Zero - Maximum Velocity"},
-    (struct game_entry){.code = "A4X", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gachaste! Dino Device 2 Dragon"},
-    (struct game_entry){.code = "A4W", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gachaste! Dino Device 2 Phoenix"},
-    (struct game_entry){.code = "ABI", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gachasute! Dino Device - Blue"},
-    (struct game_entry){.code = "AAI", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gachasute! Dino Device - Red"},
-    (struct game_entry){.code = "ANY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gachinko Pro Yakyuu"},
-    (struct game_entry){.code = "AQA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gadget Racers"},
-    (struct game_entry){.code = "AQ2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gadget Racers"},
-    (struct game_entry){.code = "BGH", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gakkou no Kaidan - Hyakuyobako no Fuuin"},
-    (struct game_entry){.code = "AYS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gakkou wo Tsukurou!! Advance"},
-    (struct game_entry){.code = "BAS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gakuen Alice - DokiDoki Fushigi Taiken"},
-    (struct game_entry){.code = "BGS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gakuen Senki Muryou"},
-    (struct game_entry){.code = "AGZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Galaxy Angel GameBoy Advance"},
-    (struct game_entry){.code = "AG8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Galidor - Defenders of the Outer Dimension"},
-    (struct game_entry){.code = "ATY", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gambler Densetsu Tetsuya - Yomigaeru Densetsu"},
-    (struct game_entry){.code = "AQW", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Game & Watch Gallery 4"},
-    (struct game_entry){.code = "BGW", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gameboy Wars Advance 1+2"},
-    (struct game_entry){.code = "BG7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Games Explosion!"},
-    (struct game_entry){.code = "BG8", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ganbare! Dodge Fighters"},
-    (struct game_entry){.code = "BGO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Garfield - The Search for Pooky"},
-    (struct game_entry){.code = "BG9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Garfield and His Nine Lives"},
-    (struct game_entry){.code = "AYG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gauntlet - Dark Legacy"},
-    (struct game_entry){.code = "B69", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gauntlet - Rampart"},
-    (struct game_entry){.code = "MGU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - All Grown Up - Volume 1"},
-    (struct game_entry){.code = "MCM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Cartoon Network Collection - Limited Edition"},
-    (struct game_entry){.code = "MCN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Cartoon Network Collection - Platinum Edition"},
-    (struct game_entry){.code = "MCP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Cartoon Network Collection - Premium Edition"},
-    (struct game_entry){.code = "MCS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Cartoon Network Collection - Special Edition"},
-    (struct game_entry){.code = "MCT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Cartoon Network Collection - Volume 1"},
-    (struct game_entry){.code = "MC2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Cartoon Network Collection - Volume 2"},
-    (struct game_entry){.code = "MKD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Codename Kids Next Door - Volume 1"},
-    (struct game_entry){.code = "MDC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Disney Channel Collection - Volume 1"},
-    (struct game_entry){.code = "MDS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Disney Channel Collection - Volume 2"},
-    (struct game_entry){.code = "MDR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Dora the Explorer - Volume 1"},
-    (struct game_entry){.code = "MDB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Dragon Ball GT - Volume 1"},
-    (struct game_entry){.code = "MNC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Nicktoon's Collection - Volume 1"},
-    (struct game_entry){.code = "MN2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Nicktoons Collection - Volume 2"},
-    (struct game_entry){.code = "MN3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Nicktoons Volume 3"},
-    (struct game_entry){.code = "MPA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Pokemon - Volume 1"},
-    (struct game_entry){.code = "MPB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Pokemon - Volume 2"},
-    (struct game_entry){.code = "MPC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Pokemon - Volume 3"},
-    (struct game_entry){.code = "MPD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Pokemon - Volume 4"},
-    (struct game_entry){.code = "MSA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Shark Tale"},
-    (struct game_entry){.code = "MSK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Shrek"},
-    (struct game_entry){.code = "MST", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Shrek + Shark Tale"},
-    (struct game_entry){.code = "M2S", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Shrek 2"},
-    (struct game_entry){.code = "MSH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Sonic X - Volume 1"},
-    (struct game_entry){.code = "MSS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - SpongeBob SquarePants - Volume 1"},
-    (struct game_entry){.code = "MS2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - SpongeBob SquarePants - Volume 2"},
-    (struct game_entry){.code = "MS3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - SpongeBob SquarePants - Volume 3"},
-    (struct game_entry){.code = "MSB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Strawberry Shortcake - Volume 1"},
-    (struct game_entry){.code = "MSR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Super Robot Monkey Team - Volume 1"},
-    (struct game_entry){.code = "MTM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Teenage Mutant Ninja Turtles - Volume 1"},
-    (struct game_entry){.code = "MJM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - The Adventures of Jimmy Neutron Boy Genius - Volume 1"},
-    (struct game_entry){.code = "MFO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - The Fairly Odd Parents - Volume 1"},
-    (struct game_entry){.code = "MF2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - The Fairly Odd Parents - Volume 2"},
-    (struct game_entry){.code = "MFP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - The Proud Family - Volume 1"},
-    (struct game_entry){.code = "MYG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA Video - Yu-Gi-Oh! - Yugi vs. Joey - Volume 1"},
-    (struct game_entry){.code = "AGB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GBA-SP AV Adaptor"},
-    (struct game_entry){.code = "BGK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gegege no Kitarou - Kikiippatsu! Youkai Rettou"},
-    (struct game_entry){.code = "AGE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gekido Advance - Kintaro's Revenge"},
-    (struct game_entry){.code = "ANN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gekitou Densetsu Noah - Dream Management"},
-    (struct game_entry){.code = "AZS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gem Smashers"},
-    (struct game_entry){.code = "BGJ", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Genseishin the Justirisers - Souchaku Chikyuu no"},
-    (struct game_entry){.code = "BGM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gensou Maden Saiyuuki - Hangyaku no Toushin-taishi"},
-    (struct game_entry){.code = "AGK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gensou Suikoden - Card Stories"},
-    (struct game_entry){.code = "BGI", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Get Ride AMDriver - Senkou no Hero Tanjou"},
-    (struct game_entry){.code = "BGP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Get Ride! AMDrive Shutsugeki Battle Party"},
-    (struct game_entry){.code = "BGB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Get! - Boku no Mushi Tsukamaete"},
-    (struct game_entry){.code = "BGF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GetBackers Dakkanya - Jagan Fuuin!"},
-    (struct game_entry){.code = "A8G", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "GetBackers Dakkanya - Metropolis Dakkan Sakusen!"},
-    (struct game_entry){.code = "BR8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ghost Rider"},
-    (struct game_entry){.code = "AGV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ghost Trap"},
-    (struct game_entry){.code = "B3Z", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Global Star - Suduoku Feber"},
-    (struct game_entry){.code = "AGQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Go! Go! Beckham! - Adventure on Soccer Island"},
-    (struct game_entry){.code = "AG4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Godzilla - Domination!"},
-    (struct game_entry){.code = "AGN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Goemon - New Age Shutsudou!"},
-    (struct game_entry){.code = "BGG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Golden Nugget Casino"},
-    (struct game_entry){.code = "AGS", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Golden Sun"},
-    (struct game_entry){.code = "AGF", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Golden Sun - The Lost Age"},
-    (struct game_entry){.code = "AGA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gradius Galaxies"},
-    (struct game_entry){.code = "BGT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Grand Theft Auto Advance"},
-    (struct game_entry){.code = "AG9", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Greatest Nine"},
-    (struct game_entry){.code = "BUS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Green Eggs and Ham by Dr. Seuss"},
-    (struct game_entry){.code = "BGQ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Greg Hastings' Tournament Paintball Max'd"},
-    (struct game_entry){.code = "AGG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gremlins - Stripe vs Gizmo"},
-    (struct game_entry){.code = "ARV", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Groove Adventure Rave - Hikari to Yami no Daikessen"},
-    (struct game_entry){.code = "ARI", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Groove Adventure Rave - Hikari to Yami no Daikessen 2"},
-    (struct game_entry){.code = "ACA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GT Advance - Championship Racing"},
-    (struct game_entry){.code = "AGW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "GT Advance 2 - Rally Racing"},
-    (struct game_entry){.code = "A2G", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "GT Advance 3 - Pro Concept Racing"},
-    (struct game_entry){.code = "BJA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "GT Racers"},
-    (struct game_entry){.code = "AGX", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Guilty Gear X - Advance Edition"},
-    (struct game_entry){.code = "BGV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gumby vs. The Astrobots"},
-    (struct game_entry){.code = "BHG", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gunstar Super Heroes"},
-    (struct game_entry){.code = "BGX", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Gunstar Super Heroes"},
-    (struct game_entry){.code = "AIB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Guranbo"},
-    (struct game_entry){.code = "AGC", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Guru Logic Champ"},
-    (struct game_entry){.code = "ASB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gyakuten Saiban"},
-    (struct game_entry){.code = "A3G", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gyakuten Saiban 2"},
-    (struct game_entry){.code = "A3J", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Gyakuten Saiban 3"},
-    (struct game_entry){.code = "A8E", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hachiemon"},
-    (struct game_entry){.code = "BHR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hagane no Renkinjutsushi - Meisou no Rondo"},
-    (struct game_entry){.code = "BH2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hagane no Renkinjutsushi - Omoide no Sonata"},
-    (struct game_entry){.code = "A2H", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hajime no Ippo - The Fighting!"},
-    (struct game_entry){.code = "AM7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamepane - Tokyo Mew Mew"},
-    (struct game_entry){.code = "A4K", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Club 4"},
-    (struct game_entry){.code = "AHB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Monogatari 2 GBA"},
-    (struct game_entry){.code = "A83", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Monogatari 3 GBA"},
-    (struct game_entry){.code = "BHS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Monogatari 3EX 4 Special"},
-    (struct game_entry){.code = "BHC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Monogatari Collection"},
-    (struct game_entry){.code = "A82", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Paradise - Pure Heart"},
-    (struct game_entry){.code = "AHA", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamster Paradise Advance"},
-    (struct game_entry){.code = "B85", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamtaro - Ham-Ham Games"},
-    (struct game_entry){.code = "AH3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamtaro - Ham-Ham Heartbreak"},
-    (struct game_entry){.code = "A84", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hamtaro - Rainbow Rescue"},
-    (struct game_entry){.code = "BHA", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hanabi Hyakkei Advance"},
-    (struct game_entry){.code = "ADY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hanafuda Trump Mahjong - Depachika Wayouchuu"},
-    (struct game_entry){.code = "BH3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Happy Feet"},
-    (struct game_entry){.code = "AH6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hardcore Pinball"},
-    (struct game_entry){.code = "BHO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hardcore Pool"},
-    (struct game_entry){.code = "BHN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harlem Globetrotters - World Tour"},
-    (struct game_entry){.code = "BH6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Haro no Puyo Puyo"},
-    (struct game_entry){.code = "AHQ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harobots - Robo Hero Battling!!"},
-    (struct game_entry){.code = "BHP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter - Quidditch World Cup"},
-    (struct game_entry){.code = "A7H", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter and the Chamber of Secrets"},
-    (struct game_entry){.code = "BH8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter and the Goblet of Fire"},
-    (struct game_entry){.code = "BJX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter and the Order of the Phoenix"},
-    (struct game_entry){.code = "BHT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter and the Prisoner of Azkaban"},
-    (struct game_entry){.code = "AHR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter and the Sorcerer's Stone"},
-    (struct game_entry){.code = "BJP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Harry Potter Collection"},
-    (struct game_entry){.code = "ARN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Harukanaru Toki no Naka de"},
-    (struct game_entry){.code = "A4N", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harvest Moon - Friends of Mineral Town"},
-    (struct game_entry){.code = "BFG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Harvest Moon - More Friends of Mineral Town"},
-    (struct game_entry){.code = "AHS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hatena Satena"},
-    (struct game_entry){.code = "BHJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Heidi"},
-    (struct game_entry){.code = "BHD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hello Idol Debut"},
-    (struct game_entry){.code = "B86", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hello Kitty - Happy Party Pals"},
-    (struct game_entry){.code = "AKT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hello Kitty Collection - Miracle Fashion Maker"},
-    (struct game_entry){.code = "B8F", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Herbie Fully Loaded"},
-    (struct game_entry){.code = "AAE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hey Arnold! - The Movie"},
-    (struct game_entry){.code = "BHH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hi Hi Puffy - AmiYumi Kaznapped"},
-    (struct game_entry){.code = "AHZ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Higanbana"},
-    (struct game_entry){.code = "ASS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "High Heat - Major League Baseball 2002"},
-    (struct game_entry){.code = "AHH", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "High Heat - Major League Baseball 2003"},
-    (struct game_entry){.code = "AHX", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "High Heat - Major League Baseball 2003"},
-    (struct game_entry){.code = "BJ2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "High School Musical - Livin' the Dream"},
-    (struct game_entry){.code = "AHK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hikaru no Go"},
-    (struct game_entry){.code = "AHT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hikaru no Go - Taikenban"},
-    (struct game_entry){.code = "AKE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hikaru no Go 2"},
-    (struct game_entry){.code = "A3H", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hime Kishi Monogatari - Princess Blue"},
-    (struct game_entry){.code = "AHI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Hitsuji no Kimochi"},
-    (struct game_entry){.code = "BHM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Home on the Range"},
-    (struct game_entry){.code = "BYP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Horse & Pony - Let's Ride 2"},
-    (struct game_entry){.code = "BHU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Horsez"},
-    (struct game_entry){.code = "AHP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hot Potato!"},
-    (struct game_entry){.code = "AHW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hot Wheels - Burnin' Rubber"},
-    (struct game_entry){.code = "BHE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hot Wheels - Stunt Track Challenge"},
-    (struct game_entry){.code = "AH8", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hot Wheels - Velocity X"},
-    (struct game_entry){.code = "BHW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hot Wheels - World Race"},
-    (struct game_entry){.code = "BHX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hot Wheels All Out"},
-    (struct game_entry){.code = "B7I", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hudson Best Collection 1"},
-    (struct game_entry){.code = "B74", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hudson Best Collection Vol. 4 - Nazotoki Collection"},
-    (struct game_entry){.code = "B75", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hudson Best Collection Vol. 5 - Shooting Collection"},
-    (struct game_entry){.code = "B76", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hudson Best Collection Vol. 6 - Bouken Jima Collection"},
-    (struct game_entry){.code = "B72", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hudson Collection Vol. 2 - Lode Runner Collection"},
-    (struct game_entry){.code = "B73", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hudson Collection Vol. 3 - Action Collection"},
-    (struct game_entry){.code = "AZH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hugo - Bukkazoom!"},
-    (struct game_entry){.code = "AHJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hugo - The Evil Mirror"},
-    (struct game_entry){.code = "B2H", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hugo 2 in 1 - Bukkazoom! + The Evil Mirror"},
-    (struct game_entry){.code = "A8N", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Hunter X Hunter - Minna Tomodachi Daisakusen!!"},
-    (struct game_entry){.code = "A4C", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "I Spy Challenger!"},
-    (struct game_entry){.code = "AIA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ice Age"},
-    (struct game_entry){.code = "BIA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ice Age 2 - The Meltdown"},
-    (struct game_entry){.code = "AR3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ice Nine"},
-    (struct game_entry){.code = "BIV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ignition Collection - Volume 1 (3 Games in 1)"},
-    (struct game_entry){.code = "AIN", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Initial D - Another Stage"},
-    (struct game_entry){.code = "AIG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Inspector Gadget - Advance Mission"},
-    (struct game_entry){.code = "AIR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Inspector Gadget Racing"},
-    (struct game_entry){.code = "AIK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "International Karate Advanced"},
-    (struct game_entry){.code = "A3K", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "International Karate Plus"},
-    (struct game_entry){.code = "AIS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "International Superstar Soccer"},
-    (struct game_entry){.code = "AY2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "International Superstar Soccer Advance"},
-    (struct game_entry){.code = "AI9", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Inukko Club"},
-    (struct game_entry){.code = "AIY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Inuyasha - Naraku no Wana! Mayoi no Mori no Shoutaijou"},
-    (struct game_entry){.code = "AIV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Invader"},
-    (struct game_entry){.code = "AI3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Iridion 3D"},
-    (struct game_entry){.code = "AI2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Iridion II"},
-    (struct game_entry){.code = "BIR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Iron Kid"},
-    (struct game_entry){.code = "AXT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Island Xtreme Stunts"},
-    (struct game_entry){.code = "AIE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Isseki Hattyou - Kore 1ppon de 8syurui!"},
-    (struct game_entry){.code = "BPI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "It's Mr Pants"},
-    (struct game_entry){.code = "A2J", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "J.League - Winning Eleven Advance 2002"},
-    (struct game_entry){.code = "AJP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "J.League Pocket"},
-    (struct game_entry){.code = "AJ2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "J.League Pocket 2"},
-    (struct game_entry){.code = "AC2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "J.League Pro Soccer Club wo Tsukurou! Advance"},
-    (struct game_entry){.code = "AJC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jackie Chan Adventures - Legend of the Darkhand"},
-    (struct game_entry){.code = "BNJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jajamaru Jr. Denshouki - Jaleco Memorial"},
-    (struct game_entry){.code = "A7O", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "James Bond 007 - NightFire"},
-    (struct game_entry){.code = "AJD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "James Pond - Codename Robocod"},
-    (struct game_entry){.code = "AJJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jazz Jackrabbit"},
-    (struct game_entry){.code = "AJR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jet Set Radio"},
-    (struct game_entry){.code = "AGM", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "JGTO Kounin Golf Master Mobile - Japan Golf Tour Game"},
-    (struct game_entry){.code = "AJW", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Jikkyou World Soccer Pocket"},
-    (struct game_entry){.code = "AJK", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Jikkyou World Soccer Pocket 2"},
-    (struct game_entry){.code = "AJN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jimmy Neutron - Boy Genius"},
-    (struct game_entry){.code = "BJY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jimmy Neutron Boy Genius - Attack of the Twonkies"},
-    (struct game_entry){.code = "AZG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jinsei Game Advance"},
-    (struct game_entry){.code = "AJU", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jissen Pachi-Slot Hisshouhou! - Juuou Advance"},
-    (struct game_entry){.code = "AJM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jonny Moseley Mad Trix"},
-    (struct game_entry){.code = "BJK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Juka and the Monophonic Menace"},
-    (struct game_entry){.code = "AJQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jurassic Park III - Island Attack"},
-    (struct game_entry){.code = "AJ3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jurassic Park III - Park Builder"},
-    (struct game_entry){.code = "ADN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jurassic Park III - The DNA Factor"},
-    (struct game_entry){.code = "AJ8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Jurassic Park Institute Tour - Dinosaur Rescue"},
-    (struct game_entry){.code = "AJL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Justice League - Injustice for All"},
-    (struct game_entry){.code = "BJL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Justice League Chronicles"},
-    (struct game_entry){.code = "BJH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Justice League Heroes - The Flash"},
-    (struct game_entry){.code = "AKV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "K-1 Pocket Grand Prix"},
-    (struct game_entry){.code = "A2O", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "K-1 Pocket Grand Prix 2"},
-    (struct game_entry){.code = "AKD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kaeru B Back"},
-    (struct game_entry){.code = "BKO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Kaiketsu Zorori to Mahou no Yuuenchi"},
-    (struct game_entry){.code = "AKZ", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kamaitachi no Yoru Advance"},
-    (struct game_entry){.code = "AG2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kami no Kijutsu - Illusion of the Evil Eyes"},
-    (struct game_entry){.code = "AKK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kao the Kangaroo"},
-    (struct game_entry){.code = "BK8", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kappa no Kai-Kata - Katan Daibouken"},
-    (struct game_entry){.code = "AYK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Karnaaj Rally"},
-    (struct game_entry){.code = "AN5", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Kawa no Nushi Tsuri 5 - Fushigi no Mori Kara"},
-    (struct game_entry){.code = "BN4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kawa no Nushitsuri 3 & 4"},
-    (struct game_entry){.code = "BKG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kawaii Pet Game Gallery"},
-    (struct game_entry){.code = "BKP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kawaii Pet Game Gallery 2"},
-    (struct game_entry){.code = "A63", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Kawaii Pet Shop Monogatari 3"},
-    (struct game_entry){.code = "ATP", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Keitai Denjuu Telefang 2 - Power"},
-    (struct game_entry){.code = "ATS", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Keitai Denjuu Telefang 2 - Speed"},
-    (struct game_entry){.code = "AS3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kelly Slater's Pro Surfer"},
-    (struct game_entry){.code = "BKJ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Keroro Gunsou Taiketsu Gekisou"},
-    (struct game_entry){.code = "BG2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kessakusen Ganbare Goemon 1 and 2"},
-    (struct game_entry){.code = "BYL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kid Paddle"},
-    (struct game_entry){.code = "B42", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kidou Senshi Gundam Seed Destiny"},
-    (struct game_entry){.code = "AAL", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Kidou Tenshi Angelic Layer - Misaki to Yume no Tenshi-tachi"},
-    (struct game_entry){.code = "BCX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kid's Cards"},
-    (struct game_entry){.code = "XXX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kien"},
-    (struct game_entry){.code = "AKI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kiki KaiKai Advance"},
-    (struct game_entry){.code = "BKH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kill Switch"},
-    (struct game_entry){.code = "B3L", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Killer 3D Pool"},
-    (struct game_entry){.code = "AEY", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kim Possible - Revenge of Monkey Fist"},
-    (struct game_entry){.code = "BKM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kim Possible 2 - Drakken's Demise"},
-    (struct game_entry){.code = "BQP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kim Possible 3 - Team Possible"},
-    (struct game_entry){.code = "B8C", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kingdom Hearts - Chain of Memories"},
-    (struct game_entry){.code = "AK5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kinniku Banzuke - Kimero! Kiseki no Kanzen Seiha"},
-    (struct game_entry){.code = "AK4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kinniku Banzuke - Kongou-kun no Daibouken!"},
-    (struct game_entry){.code = "A7K", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kirby - Nightmare in Dream Land"},
-    (struct game_entry){.code = "B8K", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kirby & the Amazing Mirror"},
-    (struct game_entry){.code = "BWA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kisekae Angel Series 1 - Wannyan Aidoru Gakuen"},
-    (struct game_entry){.code = "BE2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kisekae Angel Series 2 - Charisma Tenin Ikusei Game"},
-    (struct game_entry){.code = "A2V", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Kisekko Gurumi - Chesty to Nuigurumi-tachi no Mahou no Bouken"},
-    (struct game_entry){.code = "B2K", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Kiss x Kiss - Seirei Gakuen"},
-    (struct game_entry){.code = "AKM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kiwame Mahjong Deluxe - Mirai Senshi 21"},
-    (struct game_entry){.code = "AKL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Klonoa - Empire of Dreams"},
-    (struct game_entry){.code = "AN6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Klonoa 2 - Dream Champ Tournament"},
-    (struct game_entry){.code = "AK7", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Klonoa Heroes - Densetsu no Star Medal"},
-    (struct game_entry){.code = "BDI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Koinu to Issho - Aijou Monogatari"},
-    (struct game_entry){.code = "BI2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Koinu to Issho! 2"},
-    (struct game_entry){.code = "BIS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Koinu-Chan no Hajimete no Osanpo - Koinu no Kokoro Ikusei Game"},
-    (struct game_entry){.code = "AKC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Konami Collector's Series - Arcade Advanced"},
-    (struct game_entry){.code = "AKW", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Konami Krazy Racers"},
-    (struct game_entry){.code = "BQB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Konchu Monster Battle Master"},
-    (struct game_entry){.code = "BQS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Konchu Monster Battle Stadium"},
-    (struct game_entry){.code = "BQK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Konchuu no Mori no Daibouken"},
-    (struct game_entry){.code = "BK7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kong - King of Atlantis"},
-    (struct game_entry){.code = "BKQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kong - The 8th Wonder of the World"},
-    (struct game_entry){.code = "AKQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kong - The Animated Series"},
-    (struct game_entry){.code = "BKE", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Konjiki no Gashbell - The Card Battle for GBA"},
-    (struct game_entry){.code = "BKB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Konjiki no Gashbell!! Makai no Bookmark"},
-    (struct game_entry){.code = "BGY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Konjiki no Gashbell!! Unare Yuujou no Dengeki"},
-    (struct game_entry){.code = "BUD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Konjiki no Gashbell!! Yuujou no Dengeki Dream Tag Tournament"},
-    (struct game_entry){.code = "KHP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Koro Koro Puzzle - Happy Panechu!"},
-    (struct game_entry){.code = "BK5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Korokke Great Toki no Boukensha"},
-    (struct game_entry){.code = "A8M", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kotoba no Puzzle - Mojipittan Advance"},
-    (struct game_entry){.code = "BK6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kouchu Ouja - Mushi King"},
-    (struct game_entry){.code = "A54", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Koukou Juken Advance Series Eigo Koubun Hen - 26 Units Shuuroku"},
-    (struct game_entry){.code = "A53", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Koukou Juken Advance Series Eijukugo Hen - 650 Phrases Shuuroku"},
-    (struct game_entry){.code = "A52", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Koukou Juken Advance Series Eitango Hen - 2000 Words Shuuroku"},
-    (struct game_entry){.code = "B9A", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kunio kun Nekketsu Collection 1"},
-    (struct game_entry){.code = "B9B", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kunio Kun Nekketsu Collection 2"},
-    (struct game_entry){.code = "B9C", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kuniokun Nekketsu Collection 3"},
-    (struct game_entry){.code = "AGO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kurohige no Golf Shiyouyo"},
-    (struct game_entry){.code = "AKU", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kurohige no Kurutto Jintori"},
-    (struct game_entry){.code = "AKR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kurukuru Kururin"},
-    (struct game_entry){.code = "A9Q", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Kururin Paradise"},
-    (struct game_entry){.code = "ALD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lady Sia"},
-    (struct game_entry){.code = "AVD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Legend of Dynamic - Goushouden - Houkai no Rondo"},
-    (struct game_entry){.code = "A2L", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Legends of Wrestling II"},
-    (struct game_entry){.code = "BLV", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Legendz - Sign of Necrom"},
-    (struct game_entry){.code = "BLJ", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Legendz - Yomigaeru Shiren no Shima"},
-    (struct game_entry){.code = "ALB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "LEGO Bionicle"},
-    (struct game_entry){.code = "AL2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "LEGO Island 2 - The Brickster's Revenge"},
-    (struct game_entry){.code = "BKN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "LEGO Knights Kingdom"},
-    (struct game_entry){.code = "ALR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "LEGO Racers 2"},
-    (struct game_entry){.code = "BLW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "LEGO Star Wars - The Video Game"},
-    (struct game_entry){.code = "BL7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "LEGO Star Wars II - The Original Trilogy"},
-    (struct game_entry){.code = "BLY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lemony Snicket's A Series of Unfortunate Events"},
-    (struct game_entry){.code = "BEF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Let's Ride - Friends Forever"},
-    (struct game_entry){.code = "B34", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Let's Ride! - Sunshine Stables"},
-    (struct game_entry){.code = "BL9", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Let's Ride! Dreamer"},
-    (struct game_entry){.code = "BRN", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Licca-Chan no Oshare Nikki"},
-    (struct game_entry){.code = "BRP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Liliput Oukoku"},
-    (struct game_entry){.code = "ALT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lilo & Stitch"},
-    (struct game_entry){.code = "BLS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lilo & Stitch 2 - Hamsterveil Havoc"},
-    (struct game_entry){.code = "ALQ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Little Buster Q"},
-    (struct game_entry){.code = "BEI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Little Einsteins"},
-    (struct game_entry){.code = "ALC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Little League Baseball 2002"},
-    (struct game_entry){.code = "BLI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Little Patissier Cake no Oshiro"},
-    (struct game_entry){.code = "BLM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Lizzie McGuire"},
-    (struct game_entry){.code = "BL2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lizzie McGuire 2 - Lizzie Diaries"},
-    (struct game_entry){.code = "BL4", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lizzie McGuire 2 - Lizzie Diaries - Special Edition"},
-    (struct game_entry){.code = "BL3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lizzie McGuire 3 - Homecoming Havoc"},
-    (struct game_entry){.code = "A39", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lode Runner"},
-    (struct game_entry){.code = "BLT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Looney Tunes - Back in Action"},
-    (struct game_entry){.code = "BLN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Looney Tunes Double Pack - Dizzy Driving + Acme Antics"},
-    (struct game_entry){.code = "ALH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Love Hina Advance - Shukufuku no Kane ha Naru Kana"},
-    (struct game_entry){.code = "ALL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lucky Luke - Wanted!"},
-    (struct game_entry){.code = "AGD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Lufia - The Ruins of Lore"},
-    (struct game_entry){.code = "ALN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Lunar Legend"},
-    (struct game_entry){.code = "AML", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "M&M's Blast!"},
-    (struct game_entry){.code = "BEM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "M&M's Break' Em"},
-    (struct game_entry){.code = "BGZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Madagascar"},
-    (struct game_entry){.code = "BM7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Madagascar - Operation Penguin"},
-    (struct game_entry){.code = "B6M", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Madden NFL 06"},
-    (struct game_entry){.code = "B7M", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Madden NFL 07"},
-    (struct game_entry){.code = "A2M", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Madden NFL 2002"},
-    (struct game_entry){.code = "ANJ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Madden NFL 2003"},
-    (struct game_entry){.code = "BMD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Madden NFL 2004"},
-    (struct game_entry){.code = "BMF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Madden NFL 2005"},
-    (struct game_entry){.code = "A2I", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Magi Nation"},
-    (struct game_entry){.code = "AJO", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Magical Houshin"},
-    (struct game_entry){.code = "AQM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Magical Quest 2 Starring Mickey & Minnie"},
-    (struct game_entry){.code = "BMQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Magical Quest 3 Starring Mickey and Donald"},
-    (struct game_entry){.code = "A3M", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Magical Quest Starring Mickey & Minnie"},
-    (struct game_entry){.code = "AMV", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Magical Vacation"},
-    (struct game_entry){.code = "AMP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mahjong Police"},
-    (struct game_entry){.code = "BNG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mahou Sensei Negima"},
-    (struct game_entry){.code = "BNM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mahou Sensei Negima! Private Lesson 2"},
-    (struct game_entry){.code = "AMC", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mail de Cute"},
-    (struct game_entry){.code = "B2Y", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Major League Baseball 2k7"},
-    (struct game_entry){.code = "ACO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Manga-ka Debut Monogatari"},
-    (struct game_entry){.code = "A4M", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Manic Miner"},
-    (struct game_entry){.code = "B68", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Marble Madness - Klax"},
-    (struct game_entry){.code = "BQL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "March of the Penguins"},
-    (struct game_entry){.code = "BM9", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Marheaven - Knockin' on Heaven's Door"},
-    (struct game_entry){.code = "ANS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Marie, Elie & Anis no Atelier - Soyokaze Kara no Dengon"},
-    (struct game_entry){.code = "A88", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario & Luigi - Superstar Saga"},
-    (struct game_entry){.code = "BMG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario Golf - Advance Tour"},
-    (struct game_entry){.code = "AMK", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario Kart - Super Circuit"},
-    (struct game_entry){.code = "B8M", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario Party Advance"},
-    (struct game_entry){.code = "BMV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario Pinball Land"},
-    (struct game_entry){.code = "BTM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario Tennis - Power Tour"},
-    (struct game_entry){.code = "BM5", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mario vs. Donkey Kong"},
-    (struct game_entry){.code = "B4M", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Marvel - Ultimate Alliance"},
-    (struct game_entry){.code = "AKS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mary-Kate and Ashley - Girls Night Out"},
-    (struct game_entry){.code = "AAY", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mary-Kate and Ashley Sweet 16 - Licensed to Drive"},
-    (struct game_entry){.code = "AGU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Masters of the Universe - He-Man Power of Grayskull"},
-    (struct game_entry){.code = "AHO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mat Hoffman's Pro BMX"},
-    (struct game_entry){.code = "AH2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mat Hoffman's Pro BMX 2"},
-    (struct game_entry){.code = "BMR", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Matantei Loki Ragnarok - Gensou no Labyrinth"},
-    (struct game_entry){.code = "ARQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Matchbox Cross Town Heroes"},
-    (struct game_entry){.code = "BIY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Math Patrol - The Kleptoid Threat"},
-    (struct game_entry){.code = "BME", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Max Payne"},
-    (struct game_entry){.code = "BEE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Maya The Bee - Sweet Gold"},
-    (struct game_entry){.code = "ABV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Maya the Bee - The Great Adventure"},
-    (struct game_entry){.code = "BFQ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Mazes of Fate"},
-    (struct game_entry){.code = "AKG", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Mech Platoon"},
-    (struct game_entry){.code = "A8B", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medabots - Metabee Version"},
-    (struct game_entry){.code = "A9B", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medabots - Rokusho Version"},
-    (struct game_entry){.code = "AK8", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medabots AX - Metabee Version"},
-    (struct game_entry){.code = "AK9", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medabots AX - Rokusho Version"},
-    (struct game_entry){.code = "BMH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Medal of Honor - Infiltrator"},
-    (struct game_entry){.code = "AUG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Medal of Honor - Underground"},
-    (struct game_entry){.code = "A5K", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medarot 2 Core - Kabuto Version"},
-    (struct game_entry){.code = "A5Q", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medarot 2 Core - Kuwagata Version"},
-    (struct game_entry){.code = "AGH", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medarot G - Kabuto Version"},
-    (struct game_entry){.code = "AGI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Medarot G - Kuwagata Version"},
-    (struct game_entry){.code = "ANA", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Medarot Navi - Kabuto"},
-    (struct game_entry){.code = "AVI", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Medarot Navi - Kuwagata"},
-    (struct game_entry){.code = "BRH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Meet the Robinsons"},
-    (struct game_entry){.code = "A89", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan - Battle Chip Challenge"},
-    (struct game_entry){.code = "A6M", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan & Bass"},
-    (struct game_entry){.code = "ARE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network"},
-    (struct game_entry){.code = "AE2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 2"},
-    (struct game_entry){.code = "AM2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 2"},
-    (struct game_entry){.code = "A3X", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 3 Blue"},
-    (struct game_entry){.code = "A6B", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 3 White"},
-    (struct game_entry){.code = "B4B", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Megaman Battle Network 4 - Blue Moon"},
-    (struct game_entry){.code = "B4W", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 4 - Red Sun"},
-    (struct game_entry){.code = "BRK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Megaman Battle Network 5 - Team Colonel"},
-    (struct game_entry){.code = "BRB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Megaman Battle Network 5 - Team Protoman"},
-    (struct game_entry){.code = "BR6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 6 - Cybeast Falzar"},
-    (struct game_entry){.code = "BR5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Battle Network 6 - Cybeast Gregar"},
-    (struct game_entry){.code = "AZC", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Zero"},
-    (struct game_entry){.code = "A62", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MegaMan Zero 2"},
-    (struct game_entry){.code = "BZ3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Megaman Zero 3"},
-    (struct game_entry){.code = "B4Z", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Megaman Zero 4"},
-    (struct game_entry){.code = "BQV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Meine Tierarztpraxis"},
-    (struct game_entry){.code = "AC4", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Meitantei Conan - Nerawareta Tantei"},
-    (struct game_entry){.code = "BQA", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Meitantei Conan Akatsuki no Monument"},
-    (struct game_entry){.code = "AMI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Men in Black - The Series"},
-    (struct game_entry){.code = "B3M", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mermaid Melody - Pichi Pichi Picchi Pichi Pichitto Live Start"},
-    (struct game_entry){.code = "BMA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mermaid Melody - Pichi Pichi Pitch"},
-    (struct game_entry){.code = "BM8", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mermaid Melody - Pichi Pichi Pitch Pichi Pichi Party"},
-    (struct game_entry){.code = "A9T", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Metal Max 2 - Kai Version"},
-    (struct game_entry){.code = "BSM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Metal Slug Advance"},
-    (struct game_entry){.code = "AAP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Metalgun Slinger"},
-    (struct game_entry){.code = "BMX", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Metroid - Zero Mission"},
-    (struct game_entry){.code = "AMT", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Metroid Fusion"},
-    (struct game_entry){.code = "BMK", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mezase Koushien"},
-    (struct game_entry){.code = "BM3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mickey to Donald no Magical Quest 3"},
-    (struct game_entry){.code = "A29", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mickey to Minnie no Magical Quest 2"},
-    (struct game_entry){.code = "BM4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mickey to Pocket Resort"},
-    (struct game_entry){.code = "AXZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Micro Machines"},
-    (struct game_entry){.code = "AMQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Midnight Club - Street Racing"},
-    (struct game_entry){.code = "AM3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Midway's Greatest Arcade Hits"},
-    (struct game_entry){.code = "BMB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mighty Beanz - Pocket Puzzles"},
-    (struct game_entry){.code = "AM6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mike Tyson Boxing"},
-    (struct game_entry){.code = "AM9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mike Tyson Boxing"},
-    (struct game_entry){.code = "B62", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Millipede - Super Break Out - Lunar Lander"},
-    (struct game_entry){.code = "AOD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minami no Umi no Odyssey"},
-    (struct game_entry){.code = "AHC", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minimoni - Mika no Happy Morning Chatty"},
-    (struct game_entry){.code = "AOH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minimoni - Onegai Ohoshi-sama!"},
-    (struct game_entry){.code = "BMJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Mahjong"},
-    (struct game_entry){.code = "BMO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Ouji-sama"},
-    (struct game_entry){.code = "BKK", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Shiiku Series - Boku no Kabuto-Kuwagata"},
-    (struct game_entry){.code = "AB7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Shiiku Series 1 - Boku no Kabuto Mushi"},
-    (struct game_entry){.code = "AW7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Shiiku Series 2 - Boku no Kuwagata"},
-    (struct game_entry){.code = "BTL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Soft Series - Happy Trump 20"},
-    (struct game_entry){.code = "BHY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Soft Series - Hyokkori Hyoutan-jima - Don Gabacho Daikatsuyaku no Maki"},
-    (struct game_entry){.code = "BSG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minna no Soft Series - Minna no Shogi"},
-    (struct game_entry){.code = "ARM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Minority Report"},
-    (struct game_entry){.code = "B3I", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mirakuru! Panzou - 7 Tsuno Hosh no Kaizoku"},
-    (struct game_entry){.code = "AIH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mission Impossible - Operation Surma"},
-    (struct game_entry){.code = "A5M", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MLB SlugFest 20-04"},
-    (struct game_entry){.code = "AMB", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mobile Pro Yakyuu - Kantoku no Saihai"},
-    (struct game_entry){.code = "BGN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mobile Suit Gundam Seed - Battle Assault"},
-    (struct game_entry){.code = "BJC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Moero! Jaleco Collection"},
-    (struct game_entry){.code = "BM2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Momotarou Densetsu G Gold Deck wo Tsukure!"},
-    (struct game_entry){.code = "AMM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Momotarou Matsuri"},
-    (struct game_entry){.code = "BUM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monopoly"},
-    (struct game_entry){.code = "AM8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Force"},
-    (struct game_entry){.code = "ANF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Gate"},
-    (struct game_entry){.code = "A6G", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Gate - Ooinaru Dungeon - Fuuin no Orb"},
-    (struct game_entry){.code = "AMN", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Guardians"},
-    (struct game_entry){.code = "BQ7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster House"},
-    (struct game_entry){.code = "AJA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Jam - Maximum Destruction"},
-    (struct game_entry){.code = "AA4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Maker 4 - Flash Card"},
-    (struct game_entry){.code = "AA5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Maker 4 - Killer Dice"},
-    (struct game_entry){.code = "AMF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Rancher Advance"},
-    (struct game_entry){.code = "A2Q", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Rancher Advance 2"},
-    (struct game_entry){.code = "A3N", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Summoner"},
-    (struct game_entry){.code = "BMT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Truck Madness"},
-    (struct game_entry){.code = "BMC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Trucks"},
-    (struct game_entry){.code = "BYM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster Trucks Mayhem"},
-    (struct game_entry){.code = "A4B", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monster! Bass Fishing"},
-    (struct game_entry){.code = "AMX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Monsters, Inc."},
-    (struct game_entry){.code = "AU3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Moorhen 3 - The Chicken Chase!"},
-    (struct game_entry){.code = "AMS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Morita Shougi Advance"},
-    (struct game_entry){.code = "AXD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mortal Kombat - Deadly Alliance"},
-    (struct game_entry){.code = "AW4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mortal Kombat - Tournament Edition"},
-    (struct game_entry){.code = "AM5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mortal Kombat Advance"},
-    (struct game_entry){.code = "A2U", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mother 1+2"},
-    (struct game_entry){.code = "A3U", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mother 3"},
-    (struct game_entry){.code = "AM4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Moto GP"},
-    (struct game_entry){.code = "A9M", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Moto Racer Advance"},
-    (struct game_entry){.code = "AMR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Motocross Maniacs Advance"},
-    (struct game_entry){.code = "BR2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mr. Driller 2"},
-    (struct game_entry){.code = "AD2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mr. Driller 2"},
-    (struct game_entry){.code = "AD5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mr. Driller A - Fushigi na Pacteria"},
-    (struct game_entry){.code = "AZR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mr. Nutz"},
-    (struct game_entry){.code = "BPC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ms. Pac-Man - Maze Madness"},
-    (struct game_entry){.code = "B6P", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ms. Pac-Man - Maze Madness + Pac-Man World"},
-    (struct game_entry){.code = "BML", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mucha Lucha - Mascaritas of the Lost Code"},
-    (struct game_entry){.code = "AG6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mugenborg"},
-    (struct game_entry){.code = "AMW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Muppet Pinball Mayhem"},
-    (struct game_entry){.code = "AMU", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Mutsu - Water Looper Mutsu"},
-    (struct game_entry){.code = "A2X", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "MX 2002 - Featuring Ricky Carmichael"},
-    (struct game_entry){.code = "BFR", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "My Animal Centre in Africa"},
-    (struct game_entry){.code = "BL6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "My Little Pony - Crystal Princess - The Runaway Rainbow"},
-    (struct game_entry){.code = "BQT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "My Pet Hotel"},
-    (struct game_entry){.code = "AKP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nakayoshi Mahjong - Kaburiichi"},
-    (struct game_entry){.code = "AH7", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Nakayoshi Pet Advance Series 1 - Kawaii Hamster"},
-    (struct game_entry){.code = "AI7", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Nakayoshi Pet Advance Series 2 - Kawaii Koinu"},
-    (struct game_entry){.code = "BKI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Nakayoshi Pet Advance Series 4 - Kawaii Koinu Mini - Wankoto Asobou!! Kogata-ken"},
-    (struct game_entry){.code = "AHV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Nakayoshi Youchien - Sukoyaka Enji Ikusei Game"},
-    (struct game_entry){.code = "ANM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Namco Museum"},
-    (struct game_entry){.code = "B5N", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Namco Museum - 50th Anniversary"},
-    (struct game_entry){.code = "AND", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nancy Drew - Message in a Haunted Mansion"},
-    (struct game_entry){.code = "ANP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Napoleon"},
-    (struct game_entry){.code = "AYR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Narikiri Jockey Game - Yuushun Rhapsody"},
-    (struct game_entry){.code = "AUE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Naruto - Konoha Senki"},
-    (struct game_entry){.code = "A7A", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Naruto - Ninja Council"},
-    (struct game_entry){.code = "BN2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Naruto Ninja Council 2"},
-    (struct game_entry){.code = "BNR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Naruto RPG - Uketsugareshi Hi no Ishi"},
-    (struct game_entry){.code = "ANH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "NASCAR Heat 2002"},
-    (struct game_entry){.code = "AN2", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Natural 2 - Duo"},
-    (struct game_entry){.code = "ABN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "NBA Jam 2002"},
-    (struct game_entry){.code = "BNW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Need for Speed - Most Wanted"},
-    (struct game_entry){.code = "AZF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Need for Speed - Porsche Unleashed"},
-    (struct game_entry){.code = "BNS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Need for Speed - Underground"},
-    (struct game_entry){.code = "BNF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Need for Speed - Underground 2"},
-    (struct game_entry){.code = "BN7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Need for Speed Carbon - Own the City"},
-    (struct game_entry){.code = "ABZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "NFL Blitz 20-02"},
-    (struct game_entry){.code = "ANK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "NFL Blitz 20-03"},
-    (struct game_entry){.code = "ATX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "NGT - Next Generation Tennis"},
-    (struct game_entry){.code = "ANL", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "NHL 2002"},
-    (struct game_entry){.code = "AN4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "NHL Hitz 20-03"},
-    (struct game_entry){.code = "BUJ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nicktoons - Attack of the Toybots"},
-    (struct game_entry){.code = "BNV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nicktoons - Battle for Volcano Island"},
-    (struct game_entry){.code = "BCC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nicktoons - Freeze Frame Frenzy"},
-    (struct game_entry){.code = "ANQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nicktoons Racing"},
-    (struct game_entry){.code = "BNU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nicktoons Unite!"},
-    (struct game_entry){.code = "ANX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ninja Five-O"},
-    (struct game_entry){.code = "ANT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Nippon Pro Mahjong Renmei Kounin - Tetsuman Advance"},
-    (struct game_entry){.code = "AGP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "No Rules - Get Phat"},
-    (struct game_entry){.code = "ANO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nobunaga Ibun"},
-    (struct game_entry){.code = "ANB", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nobunaga no Yabou"},
-    (struct game_entry){.code = "BNK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Noddy - A day in Toyland"},
-    (struct game_entry){.code = "BKR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nonono Puzzle Chailien"},
-    (struct game_entry){.code = "BNY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Nyan Nyan Nyanko no Nyan Collection"},
-    (struct game_entry){.code = "BO2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ochainu no Bouken Jima"},
-    (struct game_entry){.code = "BIK", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ochainuken Kururin"},
-    (struct game_entry){.code = "BDR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ochaken no Heya"},
-    (struct game_entry){.code = "BCU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ochaken no Yumebouken"},
-    (struct game_entry){.code = "BOD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Oddworld - Munch's Oddysee"},
-    (struct game_entry){.code = "A87", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ohanaya-San Monogatari GBA"},
-    (struct game_entry){.code = "BOJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ojarumaru - Gekkouchou Sanpo de Ojaru"},
-    (struct game_entry){.code = "AOK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Okumanchouja Game - Nottori Daisakusen!"},
-    (struct game_entry){.code = "BON", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "One Piece"},
-    (struct game_entry){.code = "BIP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "One Piece - Dragon Dream"},
-    (struct game_entry){.code = "B08", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "One Piece - Going Baseball"},
-    (struct game_entry){.code = "BO8", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "One Piece - Going Baseball Haejeok Yaku"},
-    (struct game_entry){.code = "AUS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "One Piece - Mezase! King of Berries"},
-    (struct game_entry){.code = "AO7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "One Piece - Nanatsu Shima no Daihihou"},
-    (struct game_entry){.code = "A6O", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Onimusha Tactics"},
-    (struct game_entry){.code = "BIT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Onmyou Taisenki Zeroshik"},
-    (struct game_entry){.code = "BOA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Open Season"},
-    (struct game_entry){.code = "BAA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Operation Armored Liberty"},
-    (struct game_entry){.code = "AOR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Oriental Blue - Ao no Tengai"},
-    (struct game_entry){.code = "AIC", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Oshaberi Inko Club"},
-    (struct game_entry){.code = "AOP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Oshare Princess"},
-    (struct game_entry){.code = "AO2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Oshare Princess 2"},
-    (struct game_entry){.code = "BO3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Oshare Princess 3"},
-    (struct game_entry){.code = "BO5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Oshare Princess 5"},
-    (struct game_entry){.code = "A5S", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Oshare Wanko"},
-    (struct game_entry){.code = "BOF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ottifanten Pinball"},
-    (struct game_entry){.code = "BH5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Over the Hedge"},
-    (struct game_entry){.code = "BH7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Over the Hedge - Hammy Goes Nuts"},
-    (struct game_entry){.code = "BOZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ozzy & Drix"},
-    (struct game_entry){.code = "APC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pac-Man Collection"},
-    (struct game_entry){.code = "BP8", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pac-Man Pinball Advance"},
-    (struct game_entry){.code = "BPA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pac-Man World"},
-    (struct game_entry){.code = "B2C", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pac-Man World 2"},
-    (struct game_entry){.code = "B6B", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Paperboy - Rampage"},
-    (struct game_entry){.code = "BBQ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pawa Poke Dash"},
-    (struct game_entry){.code = "BUR", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Paws & Claws - Pet Resort"},
-    (struct game_entry){.code = "BPK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Payback"},
-    (struct game_entry){.code = "BPZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pazunin - Uminin No Puzzle de Nimu"},
-    (struct game_entry){.code = "APP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Peter Pan - Return to Neverland"},
-    (struct game_entry){.code = "BPT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Peter Pan - The Motion Picture Event"},
-    (struct game_entry){.code = "AJH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Petz - Hamsterz Life 2"},
-    (struct game_entry){.code = "BNB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Petz Vet"},
-    (struct game_entry){.code = "BPV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Pferd & Pony - Mein Pferdehof"},
-    (struct game_entry){.code = "APX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Phalanx - The Enforce Fighter A-144"},
-    (struct game_entry){.code = "AYC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Phantasy Star Collection"},
-    (struct game_entry){.code = "BFX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Phil of the Future"},
-    (struct game_entry){.code = "BP3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Pia Carrot he Youkoso!! 3.3"},
-    (struct game_entry){.code = "A9N", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Piglet's Big Game"},
-    (struct game_entry){.code = "BPN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Pika Pika Nurse Monogatari - Nurse Ikusei Game"},
-    (struct game_entry){.code = "APZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinball Advance"},
-    (struct game_entry){.code = "APL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinball Challenge Deluxe"},
-    (struct game_entry){.code = "A2T", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinball Tycoon"},
-    (struct game_entry){.code = "APE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pink Panther - Pinkadelic Pursuit"},
-    (struct game_entry){.code = "AP7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pink Panther - Pinkadelic Pursuit"},
-    (struct game_entry){.code = "API", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinky and the Brain - The Masterplan"},
-    (struct game_entry){.code = "APN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinky Monkey Town"},
-    (struct game_entry){.code = "APB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinobee - Wings of Adventure"},
-    (struct game_entry){.code = "AP6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pinobee & Phoebee"},
-    (struct game_entry){.code = "B8Q", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pirates of the Caribbean - Dead Man's Chest"},
-    (struct game_entry){.code = "A8Q", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pirates of the Caribbean - The Curse of the Black Pearl"},
-    (struct game_entry){.code = "BPH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pitfall - The Lost Expedition"},
-    (struct game_entry){.code = "APF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pitfall - The Mayan Adventure"},
-    (struct game_entry){.code = "BQ9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pixeline i Pixieland"},
-    (struct game_entry){.code = "APM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Planet Monsters"},
-    (struct game_entry){.code = "AYN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Planet of the Apes"},
-    (struct game_entry){.code = "ASH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Play Novel - Silent Hill"},
-    (struct game_entry){.code = "BTD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pocket Dogs"},
-    (struct game_entry){.code = "AP9", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pocket Music"},
-    (struct game_entry){.code = "BPJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pocket Professor - Kwik Notes Vol. 1"},
-    (struct game_entry){.code = "APK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pocky & Rocky with Becky"},
-    (struct game_entry){.code = "BPE", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_RTC,  .title = "Pokemon - Emerald Version"},
-    (struct game_entry){.code = "BPR", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_RTC,  .title = "Pokemon - Fire Red Version"},
-    (struct game_entry){.code = "BPG", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_RTC,  .title = "Pokemon - Leaf Green Version"},
-    (struct game_entry){.code = "AXV", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_RTC,  .title = "Pokemon - Ruby Version"},
-    (struct game_entry){.code = "AXP", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_RTC,  .title = "Pokemon - Sapphire Version"},
-    (struct game_entry){.code = "B24", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pokemon Mystery Dungeon - Red Rescue Team"},
-    (struct game_entry){.code = "BPP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pokemon Pinball - Ruby & Sapphire"},
-    (struct game_entry){.code = "BII", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Polarium Advance"},
-    (struct game_entry){.code = "B3F", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Polly Pocket!"},
-    (struct game_entry){.code = "AOT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Polly! Pocket - Super Splash Island"},
-    (struct game_entry){.code = "APO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Popeye - Rush for Spinach"},
-    (struct game_entry){.code = "BRO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Postman Pat and the Greendale Rocket"},
-    (struct game_entry){.code = "B8P", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Pro Kun Pocket 1&2"},
-    (struct game_entry){.code = "AP3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Pro Kun Pocket 3"},
-    (struct game_entry){.code = "AP4", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Pro Kun Pocket 4"},
-    (struct game_entry){.code = "A5P", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Pro Kun Pocket 5"},
-    (struct game_entry){.code = "BP6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Pro Kun Pocket 6"},
-    (struct game_entry){.code = "BP7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Pro Kun Pocket 7"},
-    (struct game_entry){.code = "BPO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Rangers - Dino Thunder"},
-    (struct game_entry){.code = "BPW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Rangers - Ninja Storm"},
-    (struct game_entry){.code = "BRD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Rangers - S.P.D."},
-    (struct game_entry){.code = "APR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Rangers - Time Force"},
-    (struct game_entry){.code = "APW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Power Rangers - Wild Force"},
-    (struct game_entry){.code = "APH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Prehistorik Man"},
-    (struct game_entry){.code = "BAQ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Premier Action Soccer"},
-    (struct game_entry){.code = "BPM", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Premier Manager 2003-04"},
-    (struct game_entry){.code = "BP4", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Premier Manager 2004 - 2005"},
-    (struct game_entry){.code = "BP5", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Premier Manager 2005 - 2006"},
-    (struct game_entry){.code = "BPY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Prince of Persia - The Sands of Time"},
-    (struct game_entry){.code = "B2Q", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Prince of Persia - The Sands of Time + Tomb Raider - The Prophecy"},
-    (struct game_entry){.code = "BNP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Princess Natasha - Student Secret Agent"},
-    (struct game_entry){.code = "B2O", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Pro Mahjong - Tsuwamono GBA"},
-    (struct game_entry){.code = "ALM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pro Yakyuu Team wo Tsukurou! Advance"},
-    (struct game_entry){.code = "APU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "PukuPuku Tennen Kairanban"},
-    (struct game_entry){.code = "BPQ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "PukuPuku Tennen Kairanban - Koi no Cupid Daisakusen"},
-    (struct game_entry){.code = "B3P", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Pukupuku Tennen Kairanban Youkoso Illusion Land"},
-    (struct game_entry){.code = "APG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Punch King - Arcade Boxing"},
-    (struct game_entry){.code = "BYX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Puppy Luv - Spa and Resort"},
-    (struct game_entry){.code = "APY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Puyo Pop"},
-    (struct game_entry){.code = "BPF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Puyo Pop Fever"},
-    (struct game_entry){.code = "AEH", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Puzzle & Tantei Collection"},
-    (struct game_entry){.code = "BPB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Pyuu to Fuku! Jaguar - Byo to Deru! Megane Kun"},
-    (struct game_entry){.code = "BQD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Quad Desert Fury"},
-    (struct game_entry){.code = "BRW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Racing Fever"},
-    (struct game_entry){.code = "BRA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Racing Gears Advance"},
-    (struct game_entry){.code = "ARX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rampage - Puzzle Attack"},
-    (struct game_entry){.code = "BRF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rapala Pro Fishing"},
-    (struct game_entry){.code = "BNL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ratatouille"},
-    (struct game_entry){.code = "BRM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rave Master - Special Attack Force"},
-    (struct game_entry){.code = "BX5", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Rayman - 10th Anniversary"},
-    (struct game_entry){.code = "BRY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rayman - Hoodlum's Revenge"},
-    (struct game_entry){.code = "BQ3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rayman - Raving Rabbids"},
-    (struct game_entry){.code = "AYZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rayman 3"},
-    (struct game_entry){.code = "ARY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rayman Advance"},
-    (struct game_entry){.code = "ARF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Razor Freestyle Scooter"},
-    (struct game_entry){.code = "AR2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ready 2 Rumble Boxing - Round 2"},
-    (struct game_entry){.code = "BRL", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Rebelstar - Tactical Command"},
-    (struct game_entry){.code = "ARH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Recca no Honoo - The Game"},
-    (struct game_entry){.code = "AR9", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Reign of Fire"},
-    (struct game_entry){.code = "BR9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Relaxuma na Mainichi"},
-    (struct game_entry){.code = "AQH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rescue Heroes - Billy Blazes!"},
-    (struct game_entry){.code = "BRI", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rhythm Tengoku"},
-    (struct game_entry){.code = "B66", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Risk - Battleship - Clue"},
-    (struct game_entry){.code = "BDT", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "River City Ransom EX"},
-    (struct game_entry){.code = "BRE", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Riviera - The Promised Land"},
-    (struct game_entry){.code = "A9R", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Road Rash - Jailbreak"},
-    (struct game_entry){.code = "ACV", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robopon 2 - Cross Version"},
-    (struct game_entry){.code = "ARP", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robopon 2 - Ring Version"},
-    (struct game_entry){.code = "ARU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robot Wars - Advanced Destruction"},
-    (struct game_entry){.code = "ARW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robot Wars - Advanced Destruction"},
-    (struct game_entry){.code = "ARS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robot Wars - Extreme Destruction"},
-    (struct game_entry){.code = "ARB", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robotech - The Macross Saga"},
-    (struct game_entry){.code = "BRT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Robots"},
-    (struct game_entry){.code = "BR7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rock 'Em Sock 'Em Robots"},
-    (struct game_entry){.code = "A4R", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rock N' Roll Racing"},
-    (struct game_entry){.code = "AR4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rocket Power - Beach Bandits"},
-    (struct game_entry){.code = "ARK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rocket Power - Dream Scheme"},
-    (struct game_entry){.code = "AZZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rocket Power - Zero Gravity Zone"},
-    (struct game_entry){.code = "AFC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "RockMan & Forte"},
-    (struct game_entry){.code = "BR4", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_RTC,  .title = "Rockman EXE 4.5 - Real Operation"},
-    (struct game_entry){.code = "ARZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "RockMan Zero"},
-    (struct game_entry){.code = "AR8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rocky"},
-    (struct game_entry){.code = "ARO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rocky"},
-    (struct game_entry){.code = "A8T", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "RPG Tsukuru Advance"},
-    (struct game_entry){.code = "BR3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "R-Type III"},
-    (struct game_entry){.code = "ARG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rugrats - Castle Capers"},
-    (struct game_entry){.code = "A5W", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rugrats - Go Wild"},
-    (struct game_entry){.code = "AR5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Rugrats - I Gotta Go Party"},
-    (struct game_entry){.code = "AWU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sabre Wulf"},
-    (struct game_entry){.code = "A3B", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sabrina - The Teenage Witch - Potion Commotion"},
-    (struct game_entry){.code = "ASM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Saibara Rieko no Dendou Mahjong"},
-    (struct game_entry){.code = "ACL", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sakura Momoko no UkiUki Carnival"},
-    (struct game_entry){.code = "AS5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Salt Lake 2002"},
-    (struct game_entry){.code = "AWG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Salt Lake 2002"},
-    (struct game_entry){.code = "AOS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Samurai Deeper Kyo"},
-    (struct game_entry){.code = "AEC", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Samurai Evolution - Oukoku Geist"},
-    (struct game_entry){.code = "AJT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Samurai Jack - The Amulet of Time"},
-    (struct game_entry){.code = "ASX", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "San Goku Shi"},
-    (struct game_entry){.code = "B3E", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "San Goku Shi Eiketsuden"},
-    (struct game_entry){.code = "B3Q", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "San Goku Shi Koumeiden"},
-    (struct game_entry){.code = "A85", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sanrio Puroland All Characters"},
-    (struct game_entry){.code = "ASN", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sansara Naga 1x2"},
-    (struct game_entry){.code = "AXX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Santa Claus Jr. Advance"},
-    (struct game_entry){.code = "AUZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Santa Claus Saves the Earth"},
-    (struct game_entry){.code = "A57", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scan Hunter - Sennen Kaigyo wo Oe!"},
-    (struct game_entry){.code = "AP8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scooby-Doo - The Motion Picture"},
-    (struct game_entry){.code = "BMU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scooby-Doo 2 - Monsters Unleashed"},
-    (struct game_entry){.code = "ASD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scooby-Doo and the Cyber Chase"},
-    (struct game_entry){.code = "BMM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scooby-Doo! - Mystery Mayhem"},
-    (struct game_entry){.code = "B25", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scooby-Doo! - Unmasked"},
-    (struct game_entry){.code = "AQB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scrabble"},
-    (struct game_entry){.code = "BLA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scrabble Blast!"},
-    (struct game_entry){.code = "BHV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Scurge - Hive"},
-    (struct game_entry){.code = "BGE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SD Gundam Force"},
-    (struct game_entry){.code = "BG4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SD Gundam Force"},
-    (struct game_entry){.code = "BGA", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "SD Gundam G Generation"},
-    (struct game_entry){.code = "ALJ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sea Trader - Rise of Taipan"},
-    (struct game_entry){.code = "AAH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Secret Agent Barbie - Royal Jewels Mission"},
-    (struct game_entry){.code = "AYP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sega Arcade Gallery"},
-    (struct game_entry){.code = "AYL", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sega Rally Championship"},
-    (struct game_entry){.code = "A3P", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sega Smash Pack"},
-    (struct game_entry){.code = "A7G", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sengoku Kakumei Gaiden"},
-    (struct game_entry){.code = "BKA", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sennen Kazoku"},
-    (struct game_entry){.code = "BSY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sentouin - Yamada Hajime"},
-    (struct game_entry){.code = "AEN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Serious Sam Advance"},
-    (struct game_entry){.code = "BHL", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shaman King - Legacy of the Spirits - Soaring Hawk"},
-    (struct game_entry){.code = "BWS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shaman King - Legacy of the Spirits - Sprinting Wolf"},
-    (struct game_entry){.code = "BSO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shaman King - Master of Spirits"},
-    (struct game_entry){.code = "AKA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shaman King Card Game - Chou Senjiryakketsu 2"},
-    (struct game_entry){.code = "AL3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shaman King Card Game - Chou Senjiryakketsu 3"},
-    (struct game_entry){.code = "BBA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shamu's Deep Sea Adventures"},
-    (struct game_entry){.code = "BSH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shanghai"},
-    (struct game_entry){.code = "ASV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shanghai Advance"},
-    (struct game_entry){.code = "BSU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shark Tale"},
-    (struct game_entry){.code = "B9T", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shark Tale"},
-    (struct game_entry){.code = "ASC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shaun Palmer's Pro Snowboarder"},
-    (struct game_entry){.code = "AEP", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sheep"},
-    (struct game_entry){.code = "A6R", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shifting Gears - Road Trip"},
-    (struct game_entry){.code = "B4K", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shikakui Atama wo Marukusuru Advance - Kanji Keisan"},
-    (struct game_entry){.code = "B4R", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shikakui Atama wo Marukusuru Advance - Kokugo Sansu Rika Shakai"},
-    (struct game_entry){.code = "A64", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shimura Ken no Baka Tonosama"},
-    (struct game_entry){.code = "U33", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Bokura no Taiyou - Gyakushuu no Sabata"},
-    (struct game_entry){.code = "AAU", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Megami Tensei"},
-    (struct game_entry){.code = "BDL", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Megami Tensei - Devil Children Messiah Riser"},
-    (struct game_entry){.code = "A5T", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Megami Tensei 2"},
-    (struct game_entry){.code = "BDH", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Megami Tensei Devil Children - Honoo no Sho"},
-    (struct game_entry){.code = "BDY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Megami Tensei Devil Children - Koori no Sho"},
-    (struct game_entry){.code = "A8Z", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Megami Tensei Devil Children - Puzzle de Call!"},
-    (struct game_entry){.code = "ARA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shin Nippon Pro Wrestling Toukon Retsuden Advance"},
-    (struct game_entry){.code = "BKV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shingata Medarot - Kabuto Version"},
-    (struct game_entry){.code = "BKU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Shingata Medarot - Kuwagata Version"},
-    (struct game_entry){.code = "AF5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shining Force - Resurrection of the Dark Dragon"},
-    (struct game_entry){.code = "AHU", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shining Soul"},
-    (struct game_entry){.code = "AU2", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shining Soul II"},
-    (struct game_entry){.code = "ANV", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shiren Monsters - Netsal"},
-    (struct game_entry){.code = "B2M", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shonen Jump's Shaman King - Master of Spirits 2"},
-    (struct game_entry){.code = "AH4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek - Hassle at the Castle"},
-    (struct game_entry){.code = "AOI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek - Reekin' Havoc"},
-    (struct game_entry){.code = "B4I", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek - Smash n' Crash Racing"},
-    (struct game_entry){.code = "B4U", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek - Super Slam"},
-    (struct game_entry){.code = "AS4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek - Swamp Kart Speedway"},
-    (struct game_entry){.code = "BSE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek 2"},
-    (struct game_entry){.code = "BSI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek 2 - Beg for Mercy"},
-    (struct game_entry){.code = "B3H", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Shrek the Third"},
-    (struct game_entry){.code = "B3G", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sigma Star Saga"},
-    (struct game_entry){.code = "AIP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Silent Scope"},
-    (struct game_entry){.code = "A7I", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Silk to Cotton"},
-    (struct game_entry){.code = "A5C", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sim City 2000"},
-    (struct game_entry){.code = "AZK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Simple 2960 Tomodachi Series Vol. 1 - The Table Game Collection"},
-    (struct game_entry){.code = "AZ9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Simple 2960 Tomodachi Series Vol. 2 - The Block Kuzushi"},
-    (struct game_entry){.code = "BS3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Simple 2960 Tomodachi Series Vol. 3 - The Itsudemo Puzzle"},
-    (struct game_entry){.code = "BS4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Simple 2960 Tomodachi Series Vol. 4 - The Trump"},
-    (struct game_entry){.code = "AAJ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sin Kisekae Monogatari"},
-    (struct game_entry){.code = "A4P", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sister Princess - RePure"},
-    (struct game_entry){.code = "BSD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sitting Ducks"},
-    (struct game_entry){.code = "B4D", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sky Dancers - They Magically Fly!"},
-    (struct game_entry){.code = "A9K", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Slime Morimori Dragon Quest - Shougeki no Shippo Dan"},
-    (struct game_entry){.code = "ATB", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Slot! Pro 2 Advance - GoGo Juggler & New Tairyou"},
-    (struct game_entry){.code = "ASF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Slot! Pro Advance - Takarabune & Ooedo Sakurafubuki 2"},
-    (struct game_entry){.code = "BSV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Smashing Drive"},
-    (struct game_entry){.code = "ASG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Smuggler's Run"},
-    (struct game_entry){.code = "AEA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Snap Kid's"},
-    (struct game_entry){.code = "ASQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Snood"},
-    (struct game_entry){.code = "B2V", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Snood 2 - On Vacation"},
-    (struct game_entry){.code = "AK6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Soccer Kid"},
-    (struct game_entry){.code = "ALS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Soccer Mania"},
-    (struct game_entry){.code = "ASO", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic Advance"},
-    (struct game_entry){.code = "A2N", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic Advance 2"},
-    (struct game_entry){.code = "B3S", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic Advance 3"},
-    (struct game_entry){.code = "BSB", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic Battle"},
-    (struct game_entry){.code = "A3V", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic Pinball Party"},
-    (struct game_entry){.code = "A86", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic Pinball Party"},
-    (struct game_entry){.code = "BIJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sonic The Hedgehog - Genesis"},
-    (struct game_entry){.code = "B67", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sorry! - Aggravation - Scrabble Junior"},
-    (struct game_entry){.code = "A5U", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Space Channel 5 - Ulala's Cosmic Attack"},
-    (struct game_entry){.code = "AJS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Space Hexcite - Maetel Legend EX"},
-    (struct game_entry){.code = "AID", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Space Invaders"},
-    (struct game_entry){.code = "AS6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Speedball 2 - Brutal Deluxe"},
-    (struct game_entry){.code = "AKX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spider-Man"},
-    (struct game_entry){.code = "BC9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spider-Man - Battle For New York"},
-    (struct game_entry){.code = "ASE", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spider-Man - Mysterio's Menace"},
-    (struct game_entry){.code = "BSP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spider-Man 2"},
-    (struct game_entry){.code = "BI3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spider-Man 3"},
-    (struct game_entry){.code = "AC6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spirit - Stallion of the Cimarron"},
-    (struct game_entry){.code = "AWN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spirit & Spells"},
-    (struct game_entry){.code = "BSQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpongeBob SquarePants - Battle for Bikini Bottom"},
-    (struct game_entry){.code = "BQ4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpongeBob SquarePants - Creature from the Krusty Krab"},
-    (struct game_entry){.code = "BQQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpongeBob SquarePants - Lights, Camera, Pants!"},
-    (struct game_entry){.code = "AQ3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpongeBob SquarePants - Revenge of the Flying Dutchman"},
-    (struct game_entry){.code = "ASP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpongeBob SquarePants - SuperSponge"},
-    (struct game_entry){.code = "BZX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpongeBob's Atlantis Squarepantis"},
-    (struct game_entry){.code = "AKB", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sports Illustrated for Kids - Baseball"},
-    (struct game_entry){.code = "AKF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sports Illustrated for Kids - Football"},
-    (struct game_entry){.code = "B23", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sportsman's Pack - Cabela's Big Game Hunter + Rapala Pro Fishing"},
-    (struct game_entry){.code = "B6A", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spy Hunter - Super Sprint"},
-    (struct game_entry){.code = "AV3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spy Kids 3-D - Game Over"},
-    (struct game_entry){.code = "A2K", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spy Kids Challenger"},
-    (struct game_entry){.code = "BSS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spy Muppets - License to Croak"},
-    (struct game_entry){.code = "AHN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SpyHunter"},
-    (struct game_entry){.code = "AOW", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro - Attack of the Rhynocs"},
-    (struct game_entry){.code = "ASY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro - Season of Ice"},
-    (struct game_entry){.code = "A2S", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro 2 - Season of Flame"},
-    (struct game_entry){.code = "A4S", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro Advance"},
-    (struct game_entry){.code = "BS8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro Advance - Wakuwaku Tomodachi"},
-    (struct game_entry){.code = "BST", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro Orange - The Cortex Conspiracy"},
-    (struct game_entry){.code = "B8S", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Spyro Superpack - Season of Ice + Season of Flame"},
-    (struct game_entry){.code = "BSX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SSX 3"},
-    (struct game_entry){.code = "AXY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "SSX Tricky"},
-    (struct game_entry){.code = "A9G", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Stadium Games"},
-    (struct game_entry){.code = "BSW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star Wars - Flight of the Falcon"},
-    (struct game_entry){.code = "ASW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star Wars - Jedi Power Battles"},
-    (struct game_entry){.code = "A2W", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star Wars - The New Droid Army"},
-    (struct game_entry){.code = "AS2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star Wars Episode II - Attack of the Clones"},
-    (struct game_entry){.code = "BE3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star Wars Episode III - Revenge of the Sith"},
-    (struct game_entry){.code = "BCK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star Wars Trilogy - Apprentice of the Force"},
-    (struct game_entry){.code = "AS8", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Star X"},
-    (struct game_entry){.code = "AYH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Starsky & Hutch"},
-    (struct game_entry){.code = "BKT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Steel Empire"},
-    (struct game_entry){.code = "ATU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Steven Gerrard's Total Soccer 2002"},
-    (struct game_entry){.code = "B35", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Strawberry Shortcake - Summertime Adventure"},
-    (struct game_entry){.code = "BQW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Strawberry Shortcake - Summertime Adventure - Special Edition"},
-    (struct game_entry){.code = "B4T", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Strawberry Shortcake - Sweet Dreams"},
-    (struct game_entry){.code = "AZU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Street Fighter Alpha 3 - Upper"},
-    (struct game_entry){.code = "A3Z", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Street Jam Basketball"},
-    (struct game_entry){.code = "BCZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Street Racing Syndicate"},
-    (struct game_entry){.code = "AFH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Strike Force Hydra"},
-    (struct game_entry){.code = "ASL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Stuart Little 2"},
-    (struct game_entry){.code = "AUX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Stuntman"},
-    (struct game_entry){.code = "B4L", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sugar Sugar Une - Heart Gaippai! Moegi Gakuen"},
-    (struct game_entry){.code = "AB4", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Summon Night - Swordcraft Story"},
-    (struct game_entry){.code = "BSK", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Summon Night - Swordcraft Story 2"},
-    (struct game_entry){.code = "B3C", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Summon Night Craft Sword Monogatari - Hajimari no Ishi"},
-    (struct game_entry){.code = "BG6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Army War"},
-    (struct game_entry){.code = "AVZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Bubble Pop"},
-    (struct game_entry){.code = "ABM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Bust-A-Move"},
-    (struct game_entry){.code = "BSA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Chinese 1 - 2 Advance"},
-    (struct game_entry){.code = "BCL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Collapse! II"},
-    (struct game_entry){.code = "ADF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Dodge Ball Advance"},
-    (struct game_entry){.code = "BDP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Duper Sumos"},
-    (struct game_entry){.code = "AG5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Ghouls 'N Ghosts"},
-    (struct game_entry){.code = "BF8", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Hornet FA 18F"},
-    (struct game_entry){.code = "AMA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Mario Advance"},
-    (struct game_entry){.code = "AMZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Mario Advance (Kiosk Demo)"},
-    (struct game_entry){.code = "AX4", .storage = BACKUP_FLASH128,  .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Mario Advance 4 - Super Mario Bros. 3"},
-    (struct game_entry){.code = "AA2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Mario World - Super Mario Advance 2"},
-    (struct game_entry){.code = "ALU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Monkey Ball Jr."},
-    (struct game_entry){.code = "AZ8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Puzzle Fighter II Turbo"},
-    (struct game_entry){.code = "BDM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Real Mahjong Dousoukai"},
-    (struct game_entry){.code = "AOG", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Robot Taisen - Original Generation"},
-    (struct game_entry){.code = "B2R", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Robot Taisen - Original Generation 2"},
-    (struct game_entry){.code = "ASR", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Robot Taisen A"},
-    (struct game_entry){.code = "A6S", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Robot Taisen D"},
-    (struct game_entry){.code = "B6J", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Robot Taisen J"},
-    (struct game_entry){.code = "AJ9", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Robot Taisen R"},
-    (struct game_entry){.code = "AXR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Super Street Fighter II Turbo - Revival"},
-    (struct game_entry){.code = "ASU", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Superman - Countdown to Apokolips"},
-    (struct game_entry){.code = "BQX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Superman Returns - Fortress of Solitude"},
-    (struct game_entry){.code = "BXU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Surf's Up"},
-    (struct game_entry){.code = "ASK", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sutakomi - Star Communicator"},
-    (struct game_entry){.code = "ABG", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sweet Cookie Pie"},
-    (struct game_entry){.code = "AVS", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Sword of Mana"},
-    (struct game_entry){.code = "BSF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sylvania Family - Fashion Designer ni Naritai"},
-    (struct game_entry){.code = "A4L", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sylvania Family 4 - Meguru Kisetsu no Tapestry"},
-    (struct game_entry){.code = "BS5", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Sylvanian Family - Yousei no Stick to Fushigi no Ki"},
-    (struct game_entry){.code = "ATO", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tactics Ogre - The Knight of Lodis"},
-    (struct game_entry){.code = "BU6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Taiketsu! Ultra Hero"},
-    (struct game_entry){.code = "BJW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tak - The Great Juju Challenge"},
-    (struct game_entry){.code = "BT9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tak 2 - The Staff of Dreams"},
-    (struct game_entry){.code = "BJU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tak and the Power of Juju"},
-    (struct game_entry){.code = "AN8", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tales of Phantasia"},
-    (struct game_entry){.code = "AN9", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tales of the World - Narikiri Dungeon 2"},
-    (struct game_entry){.code = "B3T", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tales of the World - Narikiri Dungeon 3"},
-    (struct game_entry){.code = "A9P", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tales of the World - Summoner's Lineage"},
-    (struct game_entry){.code = "AYM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tanbi Musou - Meine Liebe"},
-    (struct game_entry){.code = "ATA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tang Tang"},
-    (struct game_entry){.code = "BTI", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tantei Gakuen Q - Kyukyoku Trick ni Idome!"},
-    (struct game_entry){.code = "BTQ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tantei Gakuen Q - Meitantei ha Kimi da!"},
-    (struct game_entry){.code = "BT3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tantei Jinguuji Saburou Shiroi Kage no Syoujyo"},
-    (struct game_entry){.code = "AJG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tarzan - Return to the Jungle"},
-    (struct game_entry){.code = "AXQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Taxi 3"},
-    (struct game_entry){.code = "BBL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Teen Titans"},
-    (struct game_entry){.code = "BZU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Teen Titans 2"},
-    (struct game_entry){.code = "BNT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Teenage Mutant Ninja Turtles"},
-    (struct game_entry){.code = "BT2", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Teenage Mutant Ninja Turtles 2 - Battlenexus"},
-    (struct game_entry){.code = "BT8", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Teenage Mutant Ninja Turtles Double Pack"},
-    (struct game_entry){.code = "ATK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tekken Advance"},
-    (struct game_entry){.code = "BTP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ten Pin Alley 2"},
-    (struct game_entry){.code = "AT8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis Masters Series 2003"},
-    (struct game_entry){.code = "AVA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis no Ouji-sama - Aim at the Victory!"},
-    (struct game_entry){.code = "ATI", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis no Ouji-sama - Genius Boys Academy"},
-    (struct game_entry){.code = "A9L", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis no Ouji-sama 2003 - Cool Blue"},
-    (struct game_entry){.code = "A8R", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis no Ouji-sama 2003 - Passion Red"},
-    (struct game_entry){.code = "B4G", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis no Ouji-sama 2004 - Glorious Gold"},
-    (struct game_entry){.code = "B4S", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tennis no Ouji-sama 2004 - Stylish Silver"},
-    (struct game_entry){.code = "AO3", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Terminator 3 - Rise of the Machines"},
-    (struct game_entry){.code = "BTT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tetris Advance"},
-    (struct game_entry){.code = "ATW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tetris Worlds"},
-    (struct game_entry){.code = "BXA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Texas Hold 'Em Poker"},
-    (struct game_entry){.code = "BRV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "That's So Raven"},
-    (struct game_entry){.code = "BZS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Thats So Raven 2 - Supernatural Style"},
-    (struct game_entry){.code = "BJN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Adventures of Jimmy Neutron - Boy Genius - Jet Fusion"},
-    (struct game_entry){.code = "AJX", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Adventures of Jimmy Neutron vs Jimmy Negatron"},
-    (struct game_entry){.code = "A7M", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Amazing Virtual Sea Monkeys"},
-    (struct game_entry){.code = "BUY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Ant Bully"},
-    (struct game_entry){.code = "BBI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Barbie Diaries - High School Mystery"},
-    (struct game_entry){.code = "BKF", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Bee Game"},
-    (struct game_entry){.code = "BBO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Berenstain Bears - And the Spooky Old Tree"},
-    (struct game_entry){.code = "BCT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Cat in the Hat by Dr. Seuss"},
-    (struct game_entry){.code = "BCQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Cheetah Girls"},
-    (struct game_entry){.code = "B2W", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Chronicles of Narnia - The Lion, the Witch and the Wardrobe"},
-    (struct game_entry){.code = "AF6", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Fairly Odd Parents! - Breakin' da Rules"},
-    (struct game_entry){.code = "BFO", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Fairly Odd Parents! - Clash with the Anti-World"},
-    (struct game_entry){.code = "AFV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Fairly Odd Parents! - Enter the Cleft"},
-    (struct game_entry){.code = "BF2", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Fairly Odd Parents! - Shadow Showdown"},
-    (struct game_entry){.code = "AFS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Flintstones - Big Trouble in Bedrock"},
-    (struct game_entry){.code = "BIE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Grim - Adventures of Billy and Mandy"},
-    (struct game_entry){.code = "ALI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Haunted Mansion"},
-    (struct game_entry){.code = "AH9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Hobbit"},
-    (struct game_entry){.code = "AHL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Incredible Hulk"},
-    (struct game_entry){.code = "BIC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Incredibles"},
-    (struct game_entry){.code = "BIQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Incredibles - Rise of the Underminer"},
-    (struct game_entry){.code = "AIO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Invincible Iron Man"},
-    (struct game_entry){.code = "AJF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Jungle Book"},
-    (struct game_entry){.code = "AKO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The King of Fighters EX - Neo Blood"},
-    (struct game_entry){.code = "AEX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The King of Fighters EX2 - Howling Blood"},
-    (struct game_entry){.code = "BAK", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Koala Brothers - Outback Adventures"},
-    (struct game_entry){.code = "ALA", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Land Before Time"},
-    (struct game_entry){.code = "BLO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Land Before Time - Into the Mysterious Beyond"},
-    (struct game_entry){.code = "B3Y", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Legend of Spyro - A New Beginning"},
-    (struct game_entry){.code = "BU7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Legend of Spyro - The Eternal Night"},
-    (struct game_entry){.code = "AZL", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Legend of Zelda - A Link to the Past & Four Swords"},
-    (struct game_entry){.code = "BZM", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Legend of Zelda - The Minish Cap"},
-    (struct game_entry){.code = "BLK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Lion King 1.5"},
-    (struct game_entry){.code = "BN9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Little Mermaid - Magic in Two Kingdoms"},
-    (struct game_entry){.code = "ALO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Lord of the Rings - The Fellowship of the Ring"},
-    (struct game_entry){.code = "BLR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Lord of the Rings - The Return of the King"},
-    (struct game_entry){.code = "B3A", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Lord of the Rings - The Third Age"},
-    (struct game_entry){.code = "ALP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Lord of the Rings - The Two Towers"},
-    (struct game_entry){.code = "ALV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Lost Vikings"},
-    (struct game_entry){.code = "AUM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Mummy"},
-    (struct game_entry){.code = "AZM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Muppets - On With the Show!"},
-    (struct game_entry){.code = "APD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Pinball of the Dead"},
-    (struct game_entry){.code = "AZO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Pinball of the Dead"},
-    (struct game_entry){.code = "BPX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Polar Express"},
-    (struct game_entry){.code = "AP5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Powerpuff Girls - Him and Seek"},
-    (struct game_entry){.code = "APT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Powerpuff Girls - Mojo Jojo A-Go-Go"},
-    (struct game_entry){.code = "BD7", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Proud Family"},
-    (struct game_entry){.code = "A3R", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Revenge of Shinobi"},
-    (struct game_entry){.code = "ARD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Ripping Friends"},
-    (struct game_entry){.code = "B33", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Santa Clause 3 - The Escape Clause"},
-    (struct game_entry){.code = "ASZ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Scorpion King - Sword of Osiris"},
-    (struct game_entry){.code = "A4A", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Simpsons - Road Rage"},
-    (struct game_entry){.code = "B4P", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Sims"},
-    (struct game_entry){.code = "ASI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "The Sims - Bustin' Out"},
-    (struct game_entry){.code = "B46", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Sims 2"},
-    (struct game_entry){.code = "B4O", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Sims 2 - Pets"},
-    (struct game_entry){.code = "A7S", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Smurfs - The Revenge of the Smurfs"},
-    (struct game_entry){.code = "BSN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The SpongeBob SquarePants Movie"},
-    (struct game_entry){.code = "BZC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Suite Life of Zack & Cody - Tipton Trouble"},
-    (struct game_entry){.code = "AA6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Sum of All Fears"},
-    (struct game_entry){.code = "A3T", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Three Stooges"},
-    (struct game_entry){.code = "BTR", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Tower SP"},
-    (struct game_entry){.code = "BOC", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Urbz - Sims in the City"},
-    (struct game_entry){.code = "BWL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Wild"},
-    (struct game_entry){.code = "AWT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Wild Thornberrys - Chimp Chase"},
-    (struct game_entry){.code = "AWL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "The Wild Thornberrys Movie"},
-    (struct game_entry){.code = "BTH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Thunder Alley"},
-    (struct game_entry){.code = "BTB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Thunderbirds"},
-    (struct game_entry){.code = "ATN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Thunderbirds - International Rescue"},
-    (struct game_entry){.code = "BTW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tiger Woods PGA Tour 2004"},
-    (struct game_entry){.code = "AT5", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tiger Woods PGA Tour Golf"},
-    (struct game_entry){.code = "BNC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tim Burton's The Nightmare Before Christmas - The Pumpkin King"},
-    (struct game_entry){.code = "ATT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tiny Toon Adventures - Scary Dreams"},
-    (struct game_entry){.code = "AWS", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tiny Toon Adventures - Wacky Stackers"},
-    (struct game_entry){.code = "ATV", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tir et But - Edition Champions du Monde"},
-    (struct game_entry){.code = "BTC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Titeuf - Mega-Compet"},
-    (struct game_entry){.code = "BEX", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "TMNT"},
-    (struct game_entry){.code = "ATQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "TOCA World Touring Cars"},
-    (struct game_entry){.code = "AF7", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tokimeki Yume Series 1 - Ohanaya-san ni Narou!"},
-    (struct game_entry){.code = "BTF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tokyo Majin Gakuen - Fuju Houroku"},
-    (struct game_entry){.code = "BTZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tokyo Xtreme Racer Advance"},
-    (struct game_entry){.code = "ATJ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tom and Jerry - The Magic Ring"},
-    (struct game_entry){.code = "AIF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tom and Jerry in Infurnal Escape"},
-    (struct game_entry){.code = "BJT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tom and Jerry Tales"},
-    (struct game_entry){.code = "AR6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tom Clancy's Rainbow Six - Rogue Spear"},
-    (struct game_entry){.code = "AO4", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tom Clancy's Splinter Cell"},
-    (struct game_entry){.code = "BSL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tom Clancy's Splinter Cell - Pandora Tomorrow"},
-    (struct game_entry){.code = "AGL", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tomato Adventure"},
-    (struct game_entry){.code = "BL8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tomb Raider - Legend"},
-    (struct game_entry){.code = "AL9", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tomb Raider - The Prophecy"},
-    (struct game_entry){.code = "AUT", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tomb Raider - The Prophecy"},
-    (struct game_entry){.code = "OPL", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tomb Raider (OpenLara)"},
-    (struct game_entry){.code = "BT7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tonka - On the Job"},
-    (struct game_entry){.code = "BH9", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's American Sk8land"},
-    (struct game_entry){.code = "BXS", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's Downhill Jam"},
-    (struct game_entry){.code = "ATH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's Pro Skater 2"},
-    (struct game_entry){.code = "AT3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's Pro Skater 3"},
-    (struct game_entry){.code = "AT6", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's Pro Skater 4"},
-    (struct game_entry){.code = "BTO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's Underground"},
-    (struct game_entry){.code = "B2T", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Tony Hawk's Underground 2"},
-    (struct game_entry){.code = "AT7", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tootuff - The Gagmachine"},
-    (struct game_entry){.code = "A2Y", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Top Gun - Combat Zones"},
-    (struct game_entry){.code = "ATG", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Top Gun - Firestorm Advance"},
-    (struct game_entry){.code = "B27", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Top Spin 2"},
-    (struct game_entry){.code = "ATC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "TopGear GT Championship"},
-    (struct game_entry){.code = "BTG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "TopGear Rally"},
-    (struct game_entry){.code = "AYE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "TopGear Rally"},
-    (struct game_entry){.code = "BTU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Totally Spies"},
-    (struct game_entry){.code = "B2L", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Totally Spies 2 - Undercover"},
-    (struct game_entry){.code = "A59", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Toukon Heat"},
-    (struct game_entry){.code = "ATR", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Toyrobo Force"},
-    (struct game_entry){.code = "AZQ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Treasure Planet"},
-    (struct game_entry){.code = "B9S", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Trick Star"},
-    (struct game_entry){.code = "BTJ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tringo"},
-    (struct game_entry){.code = "BT6", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Trollz - Hair Affair!"},
-    (struct game_entry){.code = "BTN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tron 2.0 - Killer App"},
-    (struct game_entry){.code = "AK3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Turbo Turtle Adventure"},
-    (struct game_entry){.code = "AT4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Turok Evolution"},
-    (struct game_entry){.code = "ATM", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tweety and the Magic Gems"},
-    (struct game_entry){.code = "AMJ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Tweety no Hearty Party"},
-    (struct game_entry){.code = "BFV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 1 - Fashion Designer Monogatari + Kawaii Pet Game Gallery 2"},
-    (struct game_entry){.code = "BOP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 2 - Oshare Princess 4 + Renai Uranai Daisakusen"},
-    (struct game_entry){.code = "BQM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 3 - Konchuu Monster + Suchai Labyrinth"},
-    (struct game_entry){.code = "BHF", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 4 - Ham Ham Monster EX + Fantasy Puzzle Hamster Monogatari"},
-    (struct game_entry){.code = "BMW", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 5 - Wan Wan Meitantei EX + Mahou no Kuni no Keaki-Okusan Monogatari"},
-    (struct game_entry){.code = "BWN", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 6 - Wan Nyon Idol Gakuen + Koinu Toissho Special"},
-    (struct game_entry){.code = "B2P", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Twin Series 7 - Twin Puzzle - Kisekae Wanko Ex + Puzzle Rainbow Magic 2"},
-    (struct game_entry){.code = "BTY", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ty the Tasmanian Tiger 2 - Bush Rescue"},
-    (struct game_entry){.code = "BTV", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ty the Tasmanian Tiger 3 - Night of the Quinkan"},
-    (struct game_entry){.code = "BUV", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Uchu no Stellvia"},
-    (struct game_entry){.code = "AUC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Uchuu Daisakusen Choco Vader - Uchuu Kara no Shinryakusha"},
-    (struct game_entry){.code = "BUH", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ueki no Housoku Shinki Sakuretsu! Nouryokumono Battle"},
-    (struct game_entry){.code = "AEW", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ui-Ire - World Soccer Winning Eleven"},
-    (struct game_entry){.code = "BUZ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Arcade Games"},
-    (struct game_entry){.code = "AVE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Beach Soccer"},
-    (struct game_entry){.code = "ABU", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Brain Games"},
-    (struct game_entry){.code = "BUC", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Card Games"},
-    (struct game_entry){.code = "AK2", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Muscle - The Kinnikuman Legacy - The Path of the Superhero"},
-    (struct game_entry){.code = "BUA", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Puzzle Games"},
-    (struct game_entry){.code = "BUL", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Spider-Man"},
-    (struct game_entry){.code = "BUW", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultimate Winter Games"},
-    (struct game_entry){.code = "BUT", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Ultra Keibitai - Monster Attack"},
-    (struct game_entry){.code = "BU4", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Unfabulous"},
-    (struct game_entry){.code = "BU5", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Uno 52"},
-    (struct game_entry){.code = "BUI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Uno Freefall"},
-    (struct game_entry){.code = "AYI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Urban Yeti!"},
-    (struct game_entry){.code = "AVP", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "V.I.P."},
-    (struct game_entry){.code = "BAN", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Van Helsing"},
-    (struct game_entry){.code = "BRX", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Vattroller X"},
-    (struct game_entry){.code = "BZT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "VeggieTales - LarryBoy and the Bad Apple"},
-    (struct game_entry){.code = "AVT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Virtua Tennis"},
-    (struct game_entry){.code = "AVK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Virtual Kasparov"},
-    (struct game_entry){.code = "AVM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "V-Master Cross"},
-    (struct game_entry){.code = "AVR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "V-Rally 3"},
-    (struct game_entry){.code = "BWT", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "W.i.t.c.h."},
-    (struct game_entry){.code = "BSR", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wade Hixton's Counter Punch"},
-    (struct game_entry){.code = "BMI", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wagamama - Fairy Milmo de Pon! DokiDoki Memorial"},
-    (struct game_entry){.code = "BWP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wagamama Fairy Mirumo de Pon Nazo no Kagi to Shinjitsu no Tobir"},
-    (struct game_entry){.code = "BMY", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wagamama Fairy Mirumo de Pon! - 8 Nin no Toki no Yousei"},
-    (struct game_entry){.code = "AWK", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Wagamama Fairy Mirumo de Pon! - Ougon Maracas no Densetsu"},
-    (struct game_entry){.code = "BMP", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wagamama Fairy Mirumo de Pon! - Taisen Mahoudama"},
-    (struct game_entry){.code = "BWF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wagamama Fairy Mirumo de Pon! Yume no Kakera"},
-    (struct game_entry){.code = "AWD", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wakeboarding Unleashed featuring Shaun Murray"},
-    (struct game_entry){.code = "BWD", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Wan Nyan Doubutsu Byouin"},
-    (struct game_entry){.code = "BWK", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wanko Dekururi! Wankuru"},
-    (struct game_entry){.code = "BWX", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Wanko Mix Chiwanko World"},
-    (struct game_entry){.code = "BWM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "WanWan Meitantei"},
-    (struct game_entry){.code = "AWA", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wario Land 4"},
-    (struct game_entry){.code = "RZW", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "WarioWare Twisted!"},
-    (struct game_entry){.code = "AZW", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "WarioWare, Inc. - Mega Microgames!"},
-    (struct game_entry){.code = "AW3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Watashi no Makesalon"},
-    (struct game_entry){.code = "BWE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Whac-A-Mole"},
-    (struct game_entry){.code = "A73", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Whistle! - Dai 37 Kai Tokyo-to Chuugakkou Sougou Taiiku Soccer Taikai"},
-    (struct game_entry){.code = "A55", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Who Wants to Be a Millionaire"},
-    (struct game_entry){.code = "B55", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Who Wants to Be a Millionaire - 2nd Edition"},
-    (struct game_entry){.code = "BWJ", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Who Wants to Be a Millionaire - Junior"},
-    (struct game_entry){.code = "AW9", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wing Commander - Prophecy"},
-    (struct game_entry){.code = "AWQ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wings"},
-    (struct game_entry){.code = "BWH", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Winnie the Pooh's Rumbly Tumbly Adventure"},
-    (struct game_entry){.code = "BWZ", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Winnie the Pooh's Rumbly Tumbly Adventure + Rayman 3"},
-    (struct game_entry){.code = "AWP", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Winning Post for GameBoy Advance"},
-    (struct game_entry){.code = "BWY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Winter Sports"},
-    (struct game_entry){.code = "BWI", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "WinX Club"},
-    (struct game_entry){.code = "BWV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Winx Club - Quest For The Codex"},
-    (struct game_entry){.code = "AWZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wizardry Summoner"},
-    (struct game_entry){.code = "AWO", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Wolfenstein 3D"},
-    (struct game_entry){.code = "AWW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Woody Woodpecker in Crazy Castle 5"},
-    (struct game_entry){.code = "BB8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Word Safari - The Friendship Totems"},
-    (struct game_entry){.code = "AAS", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "World Advance Soccer - Shouri heno Michi"},
-    (struct game_entry){.code = "BP9", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "World Championship Poker"},
-    (struct game_entry){.code = "B26", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "World Poker Tour"},
-    (struct game_entry){.code = "BWO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "World Poker Tour"},
-    (struct game_entry){.code = "BWR", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "World Reborn"},
-    (struct game_entry){.code = "AWC", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "World Tennis Stars"},
-    (struct game_entry){.code = "AWB", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Worms Blast"},
-    (struct game_entry){.code = "AWY", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Worms World Party"},
-    (struct game_entry){.code = "ATE", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "WTA Tour Tennis"},
-    (struct game_entry){.code = "ACI", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "WTA Tour Tennis Pocket"},
-    (struct game_entry){.code = "AW8", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "WWE - Road to WrestleMania X8"},
-    (struct game_entry){.code = "BWW", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "WWE Survivor Series"},
-    (struct game_entry){.code = "AWF", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "WWF - Road to WrestleMania"},
-    (struct game_entry){.code = "AWV", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "X2 - Wolverine's Revenge"},
-    (struct game_entry){.code = "AXI", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "X-bladez - Inline Skater"},
-    (struct game_entry){.code = "AXM", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "X-Men - Reign of Apocalypse"},
-    (struct game_entry){.code = "B3X", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "X-Men - The Official Game"},
-    (struct game_entry){.code = "BXM", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "XS Moto"},
-    (struct game_entry){.code = "AX3", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "xXx"},
-    (struct game_entry){.code = "B64", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yars' Revenge - Pong - Asteroids"},
-    (struct game_entry){.code = "BYU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Yggdra Union - We'll Never Fight Alone"},
-    (struct game_entry){.code = "BYV", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yo-Gi-Oh! Double Pack 2 - Destiny Board Traveler + Dungeon Dice Monsters"},
-    (struct game_entry){.code = "KYG", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yoshi Topsy-Turvy"},
-    (struct game_entry){.code = "A3A", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Yoshi's Island - Super Mario Advance 3"},
-    (struct game_entry){.code = "AFU", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Youkaidou"},
-    (struct game_entry){.code = "BYY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu Yu Hakusho - Spirit Detective"},
-    (struct game_entry){.code = "BYD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! - Destiny Board Traveler"},
-    (struct game_entry){.code = "AY8", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! - Reshef of Destruction"},
-    (struct game_entry){.code = "BY7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! 7 Trials to Glory - World Championship Tournament 2005"},
-    (struct game_entry){.code = "BYO", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Day Of The Duelist - World Championship Tournament 2005"},
-    (struct game_entry){.code = "BY2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Double Pack"},
-    (struct game_entry){.code = "AY6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Duel Monsters 6 Expert 2"},
-    (struct game_entry){.code = "BY3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Duel Monsters Expert 3"},
-    (struct game_entry){.code = "BYI", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Duel Monsters International 2"},
-    (struct game_entry){.code = "AYD", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Dungeon Dice Monsters"},
-    (struct game_entry){.code = "BYG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! GX - Duel Academy"},
-    (struct game_entry){.code = "BYS", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Sugoroku no Sugoroku"},
-    (struct game_entry){.code = "AY5", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! The Eternal Duelist Soul"},
-    (struct game_entry){.code = "AY7", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! The Sacred Cards"},
-    (struct game_entry){.code = "BY6", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Ultimate Masters 2006"},
-    (struct game_entry){.code = "BYW", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! World Championship Tournament 2004"},
-    (struct game_entry){.code = "AYW", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Gi-Oh! Worldwide Edition - Stairway to the Destined Duel"},
-    (struct game_entry){.code = "A4V", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yuujou no Victory Goal 4v4 Arashi - Get the Goal!!"},
-    (struct game_entry){.code = "AUY", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Yuureiyashiki no Nijuuyojikan"},
-    (struct game_entry){.code = "BRG", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Yu-Yu-Hakusho - Tournament Tactics"},
-    (struct game_entry){.code = "AZP", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zapper"},
-    (struct game_entry){.code = "A4G", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "ZatchBell! - Electric Arena"},
-    (struct game_entry){.code = "AGT", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zen-Nippon GT Senshuken"},
-    (struct game_entry){.code = "A2Z", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zen-Nippon Shounen Soccer Taikai 2 - Mezase Nippon-ichi!"},
-    (struct game_entry){.code = "AF3", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Zero One"},
-    (struct game_entry){.code = "BZO", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Zero One SP"},
-    (struct game_entry){.code = "AZT", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zero-Tours"},
-    (struct game_entry){.code = "BJ3", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zettai Zetsumei - Dangerous Jiisan 3 Hateshinaki Mamonogatari"},
-    (struct game_entry){.code = "BZD", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zettai Zetsumei Dangerous Jiisan - Shijou Saikyou no Togeza"},
-    (struct game_entry){.code = "BZG", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zettai Zetsumei Dangerous Jiisan - Zettai Okujou Bai Orensu Kouchou"},
-    (struct game_entry){.code = "BZ2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zettai Zetsumei Den Chara Suji-Sa"},
-    (struct game_entry){.code = "AZD", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zidane Football Generation"},
-    (struct game_entry){.code = "BZY", .storage = BACKUP_NONE,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zoey 101"},
-    (struct game_entry){.code = "AZ2", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zoids - Legacy"},
-    (struct game_entry){.code = "ATZ", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zoids Saga"},
-    (struct game_entry){.code = "BZF", .storage = BACKUP_SRAM,      .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zoids Saga - Fuzors"},
-    (struct game_entry){.code = "AZE", .storage = BACKUP_FLASH64,   .flags = GAME_ENTRY_FLAGS_NONE, .title = "Zone of the Enders - The Fist of Mars"},
-    (struct game_entry){.code = "ANC", .storage = BACKUP_EEPROM_4K, .flags = GAME_ENTRY_FLAGS_NONE, .title = "ZooCube"},
-    (struct game_entry){.code = "BMZ", .storage = BACKUP_EEPROM_64K,.flags = GAME_ENTRY_FLAGS_NONE, .title = "Zooo"},
-};
+uint32_t
+db_rom_crc32(
+    uint8_t const *rom,
+    size_t rom_size
+) {
+    uint32_t crc;
 
-struct game_entry *
-db_lookup_game(
-    uint8_t const *game_code
+    pthread_once(&crc32_table_once, db_crc32_init_table);
+
+    crc = 0xFFFFFFFF;
+    while (rom_size >= 8) {
+        uint32_t lo;
+        uint32_t hi;
+
+        lo = crc ^ ((uint32_t)rom[0] | ((uint32_t)rom[1] << 8) | ((uint32_t)rom[2] << 16) | ((uint32_t)rom[3] << 24));
+        hi = (uint32_t)rom[4] | ((uint32_t)rom[5] << 8) | ((uint32_t)rom[6] << 16) | ((uint32_t)rom[7] << 24);
+        crc = crc32_table[7][lo & 0xFF]
+            ^ crc32_table[6][(lo >> 8) & 0xFF]
+            ^ crc32_table[5][(lo >> 16) & 0xFF]
+            ^ crc32_table[4][lo >> 24]
+            ^ crc32_table[3][hi & 0xFF]
+            ^ crc32_table[2][(hi >> 8) & 0xFF]
+            ^ crc32_table[1][(hi >> 16) & 0xFF]
+            ^ crc32_table[0][hi >> 24]
+        ;
+        rom += 8;
+        rom_size -= 8;
+    }
+
+    while (rom_size) {
+        crc = (crc >> 8) ^ crc32_table[0][(crc ^ *rom) & 0xFF];
+        ++rom;
+        --rom_size;
+    }
+
+    return (~crc);
+}
+
+/*
+** Find the revision of a game with the given CRC32 in the (sorted) list of revisions whose features
+** differ from the ones of their game code.
+*/
+static
+struct game_revision const *
+db_lookup_revision(
+    uint32_t crc32
 ) {
-    size_t i;
+    size_t lo;
+    size_t hi;
 
-    for (i = 0; i < array_length(game_database); ++i) {
-        if (!strncmp((char const *)game_code, game_database[i].code, 3)) {
-            struct game_entry *entry;
+    lo = 0;
+    hi = game_revisions_len;
+    while (lo < hi) {
+        size_t mid;
 
-            entry = calloc(1, sizeof(*entry));
-            memcpy(entry, game_database + i, sizeof(*entry));
-            return (entry);
+        mid = lo + (hi - lo) / 2;
+        if (game_revisions[mid].crc32 == crc32) {
+            return (&game_revisions[mid]);
+        } else if (game_revisions[mid].crc32 < crc32) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
     return (NULL);
 }
 
+/*
+** Look for the game with the given game code in the database and return a copy of its entry,
+** or NULL if it couldn't be found.
+**
+** If the CRC32 of the ROM matches a known revision of that game, the features of that revision
+** take precedence over the ones of the game code.
+*/
+struct game_entry *
+db_lookup_game(
+    uint8_t const *code,
+    uint32_t crc32
+) {
+    struct game_revision const *revision;
+    struct game_entry *entry;
+    uint16_t slot;
+
+    slot = db_index_slots[db_index_hash(code, db_index_seeds[db_index_hash(code, 0) % DB_INDEX_BUCKETS]) % DB_INDEX_SLOTS];
+    if (!slot || strncmp((char const *)code, game_database[slot - 1].code, 3)) {
+        return (NULL);
+    }
+
+    entry = calloc(1, sizeof(*entry));
+    hs_assert(entry);
+    memcpy(entry, game_database + slot - 1, sizeof(*entry));
+
+    revision = db_lookup_revision(crc32);
+    if (revision && !strncmp((char const *)code, revision->code, 3)) {
+        entry->storage = revision->storage;
+        entry->flags = revision->flags;
+    }
+
+    return (entry);
+}
+
+/*
+** The strings looked for in the ROM to auto-detect its features.
+**
+** These are the version tags the libraries of the official SDK embed in the games using them.
+** Only their prefix up to the first '_' is compared, which is also what the scan looks for.
+*/
+enum db_tags {
+    DB_TAG_EEPROM = 0,
+    DB_TAG_SRAM,
+    DB_TAG_FLASH1M,
+    DB_TAG_FLASH512,
+    DB_TAG_FLASH,
+    DB_TAG_RTC,
+
+    DB_TAG_LEN,
+};
+
+static char const * const db_tags_str[] = {
+    [DB_TAG_EEPROM] = "EEPROM_",        // EEPROM_V
+    [DB_TAG_SRAM] = "SRAM_",            // SRAM_V, SRAM_F_V
+    [DB_TAG_FLASH1M] = "FLASH1M_",      // FLASH1M_V
+    [DB_TAG_FLASH512] = "FLASH512_",    // FLASH512_V
+    [DB_TAG_FLASH] = "FLASH_",          // FLASH_V
+    [DB_TAG_RTC] = "SIIRTC_",           // SIIRTC_V
+};
+
+/*
+** Look for all the tags in the ROM in a single pass and return a bitmask of those found.
+**
+** All the tags end with a '_', which is quite rare in the rest of the ROM. We look for it with
+** `memchr()`, which is vectorized by the libc, and only compare the tags when one is found.
+*/
 static
-void const *
-array_search(
-    uint8_t const *haystack,
-    size_t haystack_len,
-    char const *needle,
-    size_t needle_len
+uint32_t
+db_scan_tags(
+    uint8_t const *rom,
+    size_t rom_size
 ) {
-    uint8_t const *tmp;
+    size_t tags_len[DB_TAG_LEN];
+    uint8_t const *end;
+    uint8_t const *ptr;
+    uint32_t found;
+    size_t i;
+
+    for (i = 0; i < DB_TAG_LEN; ++i) {
+        tags_len[i] = strlen(db_tags_str[i]);
+    }
+
+    found = 0;
+    end = rom + rom_size;
+    ptr = memchr(rom, '_', rom_size);
+    while (ptr && found != (1u << DB_TAG_LEN) - 1) {
+        for (i = 0; i < DB_TAG_LEN; ++i) {
+            size_t len;
 
-    tmp = haystack;
-    while (haystack_len >= needle_len) {
-        if (!memcmp(tmp, needle, needle_len)) {
-            return (tmp);
+            len = tags_len[i];
+            if ((size_t)(ptr - rom) + 1 >= len && !memcmp(ptr + 1 - len, db_tags_str[i], len - 1)) {
+                found |= 1u << i;
+            }
         }
-        ++tmp;
-        --haystack_len;
+
+        ++ptr;
+        ptr = memchr(ptr, '_', end - ptr);
     }
-    return (NULL);
+    return (found);
 }
 
 /*
 ** Create and fill a `struct game_entry` by auto-detecting the available features based on the given rom.
 **
-** So far, the only thing we auto-detect is the backup storage.
+** So far, the only things we auto-detect are the backup storage and the RTC.
 ** Beside that, all other fields of the returned `struct game_entry` are set to their default value.
 **
-** The auto-detection algorithms for the backup storage are very simple: they look for a bunch of strings in the game's ROM.
+** The auto-detection algorithms are very simple: they look for a bunch of strings in the game's ROM.
 */
 struct game_entry *
 db_autodetect_game_features(
@@ -1786,31 +228,32 @@ db_autodetect_game_features(
     size_t rom_size
 ) {
     struct game_entry *entry;
+    uint32_t tags;
 
     entry = calloc(1, sizeof(*entry));
+    tags = db_scan_tags(rom, rom_size);
 
-    if (array_search(rom, rom_size, "EEPROM_V", 7)) {
+    if (tags & (1u << DB_TAG_EEPROM)) {
         logln(HS_INFO, "Detected EEPROM 64K memory.");
         logln(HS_WARNING, "If you are having issues with corrupted saves, try EEPROM 8K instead.");
         entry->storage = BACKUP_EEPROM_64K;
-    } else if (
-           array_search(rom, rom_size, "SRAM_V", 5)
-        || array_search(rom, rom_size, "SRAM_F_V", 5)
-    ) {
+    } else if (tags & (1u << DB_TAG_SRAM)) {
         logln(HS_INFO, "Detected SRAM memory");
         entry->storage = BACKUP_SRAM;
-    } else if (array_search(rom, rom_size, "FLASH1M_V", 8)) {
+    } else if (tags & (1u << DB_TAG_FLASH1M)) {
         logln(HS_INFO, "Detected Flash 128 kilobytes / 1 megabit");
         entry->storage = BACKUP_FLASH128;
-    } else if (
-           array_search(rom, rom_size, "FLASH_V", 6)
-        || array_search(rom, rom_size, "FLASH512_V", 9)
-    ) {
+    } else if (tags & ((1u << DB_TAG_FLASH) | (1u << DB_TAG_FLASH512))) {
         logln(HS_INFO, "Detected Flash 64 kilobytes / 512 kilobits");
         entry->storage = BACKUP_FLASH64;
     } else {
         entry->storage = BACKUP_NONE;
     }
 
+    if (tags & (1u << DB_TAG_RTC)) {
+        logln(HS_INFO, "Detected RTC");
+        entry->flags |= GAME_ENTRY_FLAGS_RTC;
+    }
+
     return (entry);
 }
@@ -0,0 +1,175 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** Build-time generator of the perfect hash table indexing the game database by game code.
+** It also makes sure the database is consistent: no duplicated game code and sorted revisions.
+**
+** The buckets are processed from the biggest to the smallest, and for each of them we look
+** for the first seed that sends all of its codes to free slots ("hash and displace").
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "gba/gba.h"
+#include "gba/db.h"
+
+static size_t bucket_len[DB_INDEX_BUCKETS];
+static size_t bucket_order[DB_INDEX_BUCKETS];
+static uint16_t seeds[DB_INDEX_BUCKETS];
+static uint16_t slots[DB_INDEX_SLOTS];
+
+static
+int
+bucket_cmp(
+    void const *a,
+    void const *b
+) {
+    size_t len_a;
+    size_t len_b;
+
+    len_a = bucket_len[*(size_t const *)a];
+    len_b = bucket_len[*(size_t const *)b];
+    return ((len_a < len_b) - (len_a > len_b));
+}
+
+/*
+** Try to place all the codes of the given bucket with the given seed.
+** Return true if one of them collides with an already used slot.
+*/
+static
+bool
+bucket_place(
+    size_t bucket,
+    uint32_t seed
+) {
+    size_t placed[DB_INDEX_SLOTS];
+    size_t placed_len;
+    size_t i;
+
+    placed_len = 0;
+    for (i = 0; i < game_database_len; ++i) {
+        uint8_t const *code;
+        size_t slot;
+
+        code = (uint8_t const *)game_database[i].code;
+        if (db_index_hash(code, 0) % DB_INDEX_BUCKETS != bucket) {
+            continue;
+        }
+
+        slot = db_index_hash(code, seed) % DB_INDEX_SLOTS;
+        if (slots[slot]) {
+            while (placed_len) {
+                slots[placed[--placed_len]] = 0;
+            }
+            return (true);
+        }
+
+        slots[slot] = i + 1;
+        placed[placed_len++] = slot;
+    }
+    return (false);
+}
+
+static
+void
+print_array(
+    FILE *file,
+    char const *name,
+    char const *len,
+    uint16_t const *array,
+    size_t array_len
+) {
+    size_t i;
+
+    fprintf(file, "static uint16_t const %s[%s] = {", name, len);
+    for (i = 0; i < array_len; ++i) {
+        fprintf(file, "%s%u,", (i % 16) ? " " : "\n    ", array[i]);
+    }
+    fprintf(file, "\n};\n\n");
+}
+
+int
+main(
+    int argc,
+    char *argv[]
+) {
+    FILE *file;
+    size_t i;
+    size_t j;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s OUTPUT\n", argv[0]);
+        return (EXIT_FAILURE);
+    }
+
+    if (game_database_len >= DB_INDEX_SLOTS) {
+        fprintf(stderr, "The game database has more entries than DB_INDEX_SLOTS.\n");
+        return (EXIT_FAILURE);
+    }
+
+    for (i = 0; i < game_database_len; ++i) {
+        for (j = i + 1; j < game_database_len; ++j) {
+            if (!strncmp(game_database[i].code, game_database[j].code, 3)) {
+                fprintf(stderr, "The game code \"%.3s\" appears twice in the game database.\n", game_database[i].code);
+                return (EXIT_FAILURE);
+            }
+        }
+        ++bucket_len[db_index_hash((uint8_t const *)game_database[i].code, 0) % DB_INDEX_BUCKETS];
+    }
+
+    for (i = 1; i < game_revisions_len; ++i) {
+        if (game_revisions[i - 1].crc32 >= game_revisions[i].crc32) {
+            fprintf(stderr, "The game revisions must be sorted by CRC32 (see %08X).\n", game_revisions[i].crc32);
+            return (EXIT_FAILURE);
+        }
+    }
+
+    for (i = 0; i < DB_INDEX_BUCKETS; ++i) {
+        bucket_order[i] = i;
+    }
+
+    qsort(bucket_order, DB_INDEX_BUCKETS, sizeof(*bucket_order), bucket_cmp);
+
+    for (i = 0; i < DB_INDEX_BUCKETS && bucket_len[bucket_order[i]]; ++i) {
+        uint32_t seed;
+
+        for (seed = 1; seed <= UINT16_MAX; ++seed) {
+            if (!bucket_place(bucket_order[i], seed)) {
+                break;
+            }
+        }
+
+        if (seed > UINT16_MAX) {
+            fprintf(stderr, "Failed to find a seed for bucket %zu, try increasing DB_INDEX_SLOTS.\n", bucket_order[i]);
+            return (EXIT_FAILURE);
+        }
+
+        seeds[bucket_order[i]] = seed;
+    }
+
+    file = fopen(argv[1], "w");
+    if (!file) {
+        fprintf(stderr, "Failed to open \"%s\".\n", argv[1]);
+        return (EXIT_FAILURE);
+    }
+
+    fprintf(file, "/* Generated by source/gba/db/index.c, do not edit. */\n\n");
+    print_array(file, "db_index_seeds", "DB_INDEX_BUCKETS", seeds, DB_INDEX_BUCKETS);
+
+    // The slots hold the index of the entry plus one, so that 0 means the slot is free.
+    print_array(file, "db_index_slots", "DB_INDEX_SLOTS", slots, DB_INDEX_SLOTS);
+
+    if (fclose(file)) {
+        fprintf(stderr, "Failed to write \"%s\".\n", argv[1]);
+        return (EXIT_FAILURE);
+    }
+
+    return (EXIT_SUCCESS);
+}
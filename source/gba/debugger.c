@@ -14,6 +14,7 @@
 #include "gba/gba.h"
 #include "gba/core.h"
 #include "gba/event.h"
+#include "compat.h"
 
 void gba_state_pause(struct gba *);
 void gba_send_notification_raw(struct gba *gba, struct event_header const *notif_header);
@@ -25,16 +26,134 @@ debugger_init(
     memset(debugger, 0, sizeof(*debugger));
 }
 
+/*
+** Evaluate the given condition and return true if it holds.
+**
+** The condition was checked by the debugger when compiling it, so the stack can't overflow.
+*/
+bool
+debugger_eval_condition(
+    struct gba *gba,
+    struct condition const *cond
+) {
+    uint32_t stack[CONDITION_STACK_LEN];
+    size_t sp;
+    size_t i;
+
+    if (!cond->len) {
+        return (true);
+    }
+
+    sp = 0;
+    for (i = 0; i < cond->len; ++i) {
+        struct condition_instr const *instr;
+        uint32_t rhs;
+
+        instr = &cond->code[i];
+        switch (instr->op) {
+            case CONDITION_OP_PUSH:     stack[sp++] = instr->arg; continue;
+            case CONDITION_OP_REG:      stack[sp++] = gba->core.registers[instr->arg]; continue;
+            case CONDITION_OP_LOAD32:   stack[sp - 1] = mem_read32_raw(gba, stack[sp - 1]); continue;
+            case CONDITION_OP_NEG:      stack[sp - 1] = -stack[sp - 1]; continue;
+        }
+
+        // Binary operators
+        rhs = stack[--sp];
+        switch (instr->op) {
+            case CONDITION_OP_ADD:      stack[sp - 1] += rhs; break;
+            case CONDITION_OP_SUB:      stack[sp - 1] -= rhs; break;
+            case CONDITION_OP_MUL:      stack[sp - 1] *= rhs; break;
+            case CONDITION_OP_DIV:      stack[sp - 1] = rhs ? stack[sp - 1] / rhs : 0; break;
+            case CONDITION_OP_EQ:       stack[sp - 1] = stack[sp - 1] == rhs; break;
+            case CONDITION_OP_NE:       stack[sp - 1] = stack[sp - 1] != rhs; break;
+            case CONDITION_OP_LT:       stack[sp - 1] = stack[sp - 1] < rhs; break;
+            case CONDITION_OP_LE:       stack[sp - 1] = stack[sp - 1] <= rhs; break;
+            case CONDITION_OP_GT:       stack[sp - 1] = stack[sp - 1] > rhs; break;
+            case CONDITION_OP_GE:       stack[sp - 1] = stack[sp - 1] >= rhs; break;
+            case CONDITION_OP_AND:      stack[sp - 1] = stack[sp - 1] && rhs; break;
+            case CONDITION_OP_OR:       stack[sp - 1] = stack[sp - 1] || rhs; break;
+            default:                    panic(HS_DEBUG, "Unknown condition opcode %u.", instr->op);
+        }
+    }
+
+    return (stack[0] != 0);
+}
+
+/*
+** Replace the breakpoints with the given ones.
+*/
+void
+debugger_set_breakpoints(
+    struct gba *gba,
+    struct breakpoint const *breakpoints,
+    size_t len
+) {
+    uint32_t mask;
+    uint32_t bits;
+    size_t i;
+
+    bits = 4;
+    while (((size_t)1 << bits) < len * 2) {
+        ++bits;
+    }
+
+    free(gba->debugger.breakpoints.set);
+    free(gba->debugger.breakpoints.conds);
+    gba->debugger.breakpoints.set = malloc(sizeof(uint32_t) << bits);
+    gba->debugger.breakpoints.conds = malloc(sizeof(struct condition) << bits);
+    hs_assert(gba->debugger.breakpoints.set);
+    hs_assert(gba->debugger.breakpoints.conds);
+    memset(gba->debugger.breakpoints.set, 0xFF, sizeof(uint32_t) << bits);
+    gba->debugger.breakpoints.set_bits = bits;
+    gba->debugger.breakpoints.len = 0;
+
+    mask = (1u << bits) - 1;
+    for (i = 0; i < len; ++i) {
+        uint32_t addr;
+        uint32_t slot;
+
+        addr = breakpoints[i].ptr;
+        if (addr == BREAKPOINT_SET_EMPTY) {
+            continue;
+        }
+
+        /*
+        ** Breakpoints sharing the same address each get their own slot, as they may
+        ** have different conditions.
+        */
+        slot = hs_fibonacci_hash(addr, bits);
+        while (gba->debugger.breakpoints.set[slot] != BREAKPOINT_SET_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+
+        gba->debugger.breakpoints.set[slot] = addr;
+        gba->debugger.breakpoints.conds[slot] = breakpoints[i].cond;
+        ++gba->debugger.breakpoints.len;
+    }
+}
+
+/*
+** Pause the emulation if there is a breakpoint on the instruction about to be executed
+** and its condition holds.
+**
+** Only called if there is at least one breakpoint.
+*/
 void
 debugger_eval_breakpoints(
     struct gba *gba
 ) {
+    uint32_t const *set;
+    uint32_t mask;
+    uint32_t slot;
     uint32_t pc;
-    struct breakpoint *bp;
 
     pc = gba->core.pc - (gba->core.cpsr.thumb ? 2 : 4) * 2;
-    for (bp = gba->debugger.breakpoints.list; bp && bp < gba->debugger.breakpoints.list + gba->debugger.breakpoints.len; ++bp) {
-        if (bp->ptr == pc) {
+    set = gba->debugger.breakpoints.set;
+    mask = (1u << gba->debugger.breakpoints.set_bits) - 1;
+    slot = hs_fibonacci_hash(pc, gba->debugger.breakpoints.set_bits);
+
+    while (set[slot] != BREAKPOINT_SET_EMPTY) {
+        if (set[slot] == pc && debugger_eval_condition(gba, &gba->debugger.breakpoints.conds[slot])) {
             struct notification_breakpoint notif;
 
             notif.header.kind = NOTIFICATION_BREAKPOINT;
@@ -47,9 +166,74 @@ debugger_eval_breakpoints(
             gba_state_pause(gba);
             break;
         }
+        slot = (slot + 1) & mask;
     }
 }
 
+/*
+** Replace the watchpoints with the given ones and rebuild the index of the watched pages.
+*/
+void
+debugger_set_watchpoints(
+    struct gba *gba,
+    struct watchpoint const *watchpoints,
+    size_t len
+) {
+    size_t i;
+
+    free(gba->debugger.watchpoints.list);
+    gba->debugger.watchpoints.list = calloc(len ? len : 1, sizeof(struct watchpoint));
+    hs_assert(gba->debugger.watchpoints.list);
+    memcpy(gba->debugger.watchpoints.list, watchpoints, sizeof(struct watchpoint) * len);
+    gba->debugger.watchpoints.len = len;
+
+    memset(gba->debugger.watchpoints.read_pages, 0, sizeof(gba->debugger.watchpoints.read_pages));
+    memset(gba->debugger.watchpoints.write_pages, 0, sizeof(gba->debugger.watchpoints.write_pages));
+
+    for (i = 0; i < len; ++i) {
+        struct watchpoint *wp;
+        uint64_t *pages;
+        uint64_t first;
+        uint64_t last;
+        uint64_t page;
+
+        wp = &gba->debugger.watchpoints.list[i];
+        wp->size = max(wp->size, 1u);
+        pages = wp->write ? gba->debugger.watchpoints.write_pages : gba->debugger.watchpoints.read_pages;
+
+        first = wp->ptr >> WATCHPOINT_PAGE_SHIFT;
+        last = ((uint64_t)wp->ptr + wp->size - 1) >> WATCHPOINT_PAGE_SHIFT;
+
+        // The page index wraps around, so there's no need to go further than one full turn.
+        last = min(last, first + WATCHPOINT_PAGE_COUNT - 1);
+
+        for (page = first; page <= last; ++page) {
+            uint32_t idx;
+
+            idx = page & (WATCHPOINT_PAGE_COUNT - 1);
+            pages[idx / 64] |= 1ull << (idx % 64);
+        }
+    }
+}
+
+/*
+** Return true if the given watchpoint overlaps the access of `size` bytes at `addr`.
+*/
+static inline
+bool
+debugger_watchpoint_overlaps(
+    struct watchpoint const *wp,
+    uint32_t addr,
+    size_t size
+) {
+    return ((uint64_t)wp->ptr < (uint64_t)addr + size && (uint64_t)addr < (uint64_t)wp->ptr + wp->size);
+}
+
+/*
+** Pause the emulation if the given write triggers a watchpoint.
+**
+** Only called if the write touches a watched page.
+*/
 void
 debugger_eval_write_watchpoints(
     struct gba *gba,
@@ -59,8 +243,13 @@ debugger_eval_write_watchpoints(
 ) {
     struct watchpoint *wp;
 
-    for (wp = gba->debugger.watchpoints.list; wp && wp < gba->debugger.watchpoints.list + gba->debugger.watchpoints.len; ++wp) {
-        if (wp->ptr >= addr && wp->ptr < addr + size && wp->write) {
+    for (wp = gba->debugger.watchpoints.list; wp < gba->debugger.watchpoints.list + gba->debugger.watchpoints.len; ++wp) {
+        if (
+               wp->write
+            && debugger_watchpoint_overlaps(wp, addr, size)
+            && (!wp->match_value || wp->value == new_value)
+            && debugger_eval_condition(gba, &wp->cond)
+        ) {
             struct notification_watchpoint notif;
 
             notif.header.kind = NOTIFICATION_WATCHPOINT;
@@ -81,6 +270,11 @@ debugger_eval_write_watchpoints(
     }
 }
 
+/*
+** Pause the emulation if the given read triggers a watchpoint.
+**
+** Only called if the read touches a watched page. Instruction fetches never trigger a watchpoint.
+*/
 void
 debugger_eval_read_watchpoints(
     struct gba *gba,
@@ -89,8 +283,8 @@ debugger_eval_read_watchpoints(
 ) {
     struct watchpoint *wp;
 
-    for (wp = gba->debugger.watchpoints.list; wp && wp < gba->debugger.watchpoints.list + gba->debugger.watchpoints.len; ++wp) {
-        if (wp->ptr >= addr && wp->ptr < addr + size && !wp->write) {
+    for (wp = gba->debugger.watchpoints.list; wp < gba->debugger.watchpoints.list + gba->debugger.watchpoints.len; ++wp) {
+        if (!wp->write && debugger_watchpoint_overlaps(wp, addr, size) && debugger_eval_condition(gba, &wp->cond)) {
             struct notification_watchpoint notif;
 
             notif.header.kind = NOTIFICATION_WATCHPOINT;
@@ -111,13 +305,109 @@ debugger_eval_read_watchpoints(
     }
 }
 
+/*
+** Push a record to the ring of the binary trace, waiting for the reader if it's full.
+*/
+static
+void
+debugger_trace_push(
+    struct trace_ring *ring,
+    struct trace_record const *record
+) {
+    size_t head;
+
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    while (head - atomic_load_explicit(&ring->tail, memory_order_acquire) >= TRACE_RING_LEN) {
+        hs_usleep(100);
+    }
+
+    ring->records[head % TRACE_RING_LEN] = *record;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+/*
+** Record a memory access of the instruction being traced.
+**
+** Only called if the binary trace records the memory accesses.
+*/
+void
+debugger_trace_mem(
+    struct gba *gba,
+    uint32_t addr,
+    size_t size,
+    uint32_t val,
+    bool write
+) {
+    struct trace_record record;
+
+    if (gba->debugger.run_mode != GBA_RUN_MODE_TRACE || !gba->debugger.trace.ring) {
+        return ;
+    }
+
+    memset(&record, 0, sizeof(record));
+    record.kind = TRACE_RECORD_MEM;
+    record.mem.addr = addr;
+    record.mem.val = val;
+    record.mem.size = size;
+    record.mem.write = write;
+    debugger_trace_push(gba->debugger.trace.ring, &record);
+}
+
+/*
+** Run a single instruction and push its records to the ring of the binary trace.
+*/
+static
+void
+debugger_trace_insn(
+    struct gba *gba
+) {
+    struct trace_record insn;
+    struct trace_record regs;
+    uint32_t old_regs[15];
+    size_t len;
+    size_t i;
+
+    memset(&insn, 0, sizeof(insn));
+    insn.kind = TRACE_RECORD_INSN;
+    insn.insn.pc = gba->core.pc - (gba->core.cpsr.thumb ? 2 : 4) * 2;
+    insn.insn.opcode = gba->core.prefetch[0];
+    insn.insn.cpsr = gba->core.cpsr.raw;
+    insn.insn.cycles = gba->scheduler.cycles;
+    memcpy(old_regs, gba->core.registers, sizeof(old_regs));
+
+    sched_run_for(gba, 1);
+
+    for (i = 0; i < array_length(old_regs); ++i) {
+        insn.insn.changed |= (old_regs[i] != gba->core.registers[i]) << i;
+    }
+
+    debugger_trace_push(gba->debugger.trace.ring, &insn);
+
+    memset(&regs, 0, sizeof(regs));
+    regs.kind = TRACE_RECORD_REGS;
+    len = 0;
+    for (i = 0; i < array_length(old_regs); ++i) {
+        if (insn.insn.changed & (1 << i)) {
+            regs.regs[len++] = gba->core.registers[i];
+            if (len == TRACE_RECORD_REGS_LEN) {
+                debugger_trace_push(gba->debugger.trace.ring, &regs);
+                len = 0;
+            }
+        }
+    }
+
+    if (len) {
+        debugger_trace_push(gba->debugger.trace.ring, &regs);
+    }
+}
+
 void
 debugger_execute_run_mode(
     struct gba *gba
 ) {
     switch (gba->debugger.run_mode) {
         case GBA_RUN_MODE_NORMAL: {
-            sched_run_for(gba, GBA_CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH);
+            sched_run_slice(gba);
             break;
         };
         case GBA_RUN_MODE_FRAME: {
@@ -134,9 +424,14 @@ debugger_execute_run_mode(
 
             cnt = 4096; // Split the process in chunks of 4096 insns.
 
-            while (cnt && gba->debugger.trace.count) {
-                sched_run_for(gba, 1);
-                gba->debugger.trace.tracer_cb(gba->debugger.trace.arg);
+            // Stop as soon as a breakpoint or a watchpoint pauses the emulation.
+            while (cnt && gba->debugger.trace.count && gba->state == GBA_STATE_RUN) {
+                if (gba->debugger.trace.ring) {
+                    debugger_trace_insn(gba);
+                } else {
+                    sched_run_for(gba, 1);
+                    gba->debugger.trace.tracer_cb(gba->debugger.trace.arg);
+                }
 
                 --gba->debugger.trace.count;
                 --cnt;
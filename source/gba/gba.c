@@ -7,6 +7,7 @@
 **
 \******************************************************************************/
 
+#include <pthread.h>
 #include <string.h>
 #include "hades.h"
 #include "gba/gba.h"
@@ -16,8 +17,20 @@
 #include "gba/channel.h"
 #include "gba/event.h"
 
+static pthread_once_t decode_insns_once = PTHREAD_ONCE_INIT;
+
+static
+void
+gba_decode_insns(void)
+{
+    core_arm_decode_insns();
+    core_thumb_decode_insns();
+}
+
 /*
 ** Create a new GBA emulator.
+**
+** Multiple emulators can run at the same time, each one in its own thread.
 */
 struct gba *
 gba_create(void)
@@ -29,11 +42,8 @@ gba_create(void)
 
     memset(gba, 0, sizeof(*gba));
 
-    // Initialize the ARM and Thumb decoder
-    {
-        core_arm_decode_insns();
-        core_thumb_decode_insns();
-    }
+    // Initialize the ARM and Thumb decoder, shared by all the emulators
+    pthread_once(&decode_insns_once, gba_decode_insns);
 
     // Channels
     {
@@ -63,23 +73,17 @@ gba_send_notification_raw(
         case NOTIFICATION_PAUSE:
         case NOTIFICATION_STOP:
         case NOTIFICATION_RUN: {
-            channel_lock(&gba->channels.notifications);
             channel_push(&gba->channels.notifications, notif_header);
-            channel_release(&gba->channels.notifications);
 
 #ifdef WITH_DEBUGGER
-            channel_lock(&gba->channels.debug);
-            channel_push(&gba->channels.debug, notif_header);
-            channel_release(&gba->channels.debug);
+            channel_try_push(&gba->channels.debug, notif_header);
 #endif
 
             break;
         };
         case NOTIFICATION_QUICKSAVE:
         case NOTIFICATION_QUICKLOAD: {
-            channel_lock(&gba->channels.notifications);
             channel_push(&gba->channels.notifications, notif_header);
-            channel_release(&gba->channels.notifications);
             break;
         };
 #ifdef WITH_DEBUGGER
@@ -87,9 +91,7 @@ gba_send_notification_raw(
         case NOTIFICATION_WATCHPOINTS_LIST_SET:
         case NOTIFICATION_WATCHPOINT:
         case NOTIFICATION_BREAKPOINT: {
-            channel_lock(&gba->channels.debug);
-            channel_push(&gba->channels.debug, notif_header);
-            channel_release(&gba->channels.debug);
+            channel_try_push(&gba->channels.debug, notif_header);
             break;
         }
 #endif
@@ -131,6 +133,13 @@ gba_state_pause(
     struct gba *gba
 ) {
     gba->state = GBA_STATE_PAUSE;
+
+#ifdef WITH_DEBUGGER
+    // A binary trace ends with the first pause, whether it's over or interrupted: the frontend frees its ring.
+    gba->debugger.trace.ring = NULL;
+    gba->debugger.trace.mem = false;
+#endif
+
     gba_send_notification(gba, NOTIFICATION_PAUSE);
 }
 
@@ -148,6 +157,11 @@ gba_state_reset(
     struct gba *gba,
     struct launch_config const *config
 ) {
+#ifdef WITH_COUNTERS
+    // First, so the events added by the reset are counted too.
+    counters_reset(gba);
+#endif
+
     // Scheduler
     {
         struct scheduler *scheduler;
@@ -155,19 +169,24 @@ gba_state_reset(
         scheduler = &gba->scheduler;
         memset(scheduler, 0, sizeof(*scheduler));
 
+        scheduler->slice = SCHED_SLICE_MIN;
         scheduler->events_size = 64;
         scheduler->events = calloc(scheduler->events_size, sizeof(struct scheduler_event));
         hs_assert(scheduler->events);
 
-        sched_update_speed(gba, config->speed);
+        scheduler->audio_frequency = config->audio_frequency;
+        sched_update_speed(gba, config->speed, config->audio_sync);
+
+        atomic_store(&gba->shared_data.stats.frames, 0);
+        atomic_store(&gba->shared_data.stats.dropped_frames, 0);
 
         // Frame limiter
         sched_add_event(
             gba,
             NEW_REPEAT_EVENT(
                 SCHED_EVENT_FRAME_LIMITER,
-                GBA_CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH * GBA_SCREEN_REAL_HEIGHT,  // Timing of first trigger
-                GBA_CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH * GBA_SCREEN_REAL_HEIGHT   // Period
+                GBA_CYCLES_PER_FRAME,  // Timing of first trigger
+                GBA_CYCLES_PER_FRAME   // Period
             )
         );
     }
@@ -180,9 +199,14 @@ gba_state_reset(
         memset(memory, 0, sizeof(*memory));
 
         // Copy the BIOS and ROM to memory
-        memcpy(gba->memory.bios, config->bios.data, min(config->bios.size, BIOS_SIZE));
+        if (config->bios.size) {
+            memcpy(gba->memory.bios, config->bios.data, min(config->bios.size, BIOS_SIZE));
+        }
         memcpy(gba->memory.rom, config->rom.data, min(config->rom.size, CART_SIZE));
         gba->memory.rom_size = config->rom.size;
+
+        // Install the BIOS stub if there is no BIOS
+        hle_reset(gba, config->hle, !config->bios.size);
     }
 
     // IO
@@ -287,8 +311,13 @@ gba_state_reset(
         }
     }
 
+    // Link cable
+    link_reset(gba);
+
     // Backup storage
     {
+        size_t i;
+
         gba->memory.backup_storage.type = config->backup_storage.type;
         switch (gba->memory.backup_storage.type) {
             case BACKUP_EEPROM_4K: {
@@ -314,6 +343,10 @@ gba_state_reset(
             default: panic(HS_CORE, "Unknown backup type %i", gba->memory.backup_storage.type); break;
         }
 
+        for (i = 0; i < array_length(gba->shared_data.backup_storage.dirty); ++i) {
+            atomic_store(&gba->shared_data.backup_storage.dirty[i], 0);
+        }
+
         if (gba->shared_data.backup_storage.size) {
             gba->shared_data.backup_storage.data = malloc(gba->shared_data.backup_storage.size);
             hs_assert(gba->shared_data.backup_storage.data);
@@ -341,7 +374,8 @@ gba_state_reset(
         core->prefetch[1] = 0xF0000000;
         core->prefetch_access_type = NON_SEQUENTIAL;
 
-        if (config->skip_bios) {
+        // The BIOS stub can't boot the console, it is always skipped.
+        if (config->skip_bios || !config->bios.size) {
             core->r13_irq = 0x03007FA0;
             core->r13_svc = 0x03007FE0;
             core->sp = 0x03007F00;
@@ -353,6 +387,14 @@ gba_state_reset(
         }
     }
 
+#ifdef WITH_PROFILER
+    profiler_reset(gba, config->profiler_period);
+#endif
+
+#ifdef WITH_COVERAGE
+    coverage_reset(gba);
+#endif
+
     gba_send_notification(gba, NOTIFICATION_RESET);
 }
 
@@ -416,7 +458,7 @@ gba_process_message(
             struct message_speed const *msg_speed;
 
             msg_speed = (struct message_speed const *)message;
-            sched_update_speed(gba, msg_speed->speed);
+            sched_update_speed(gba, msg_speed->speed, msg_speed->audio_sync);
             break;
         };
         case MESSAGE_QUICKSAVE: {
@@ -456,6 +498,8 @@ gba_process_message(
             gba->debugger.trace.count = msg_trace->count;
             gba->debugger.trace.tracer_cb = msg_trace->tracer_cb;
             gba->debugger.trace.arg = msg_trace->arg;
+            gba->debugger.trace.ring = msg_trace->ring;
+            gba->debugger.trace.mem = msg_trace->ring && msg_trace->mem;
 
             gba->debugger.run_mode = GBA_RUN_MODE_TRACE;
             gba_state_run(gba);
@@ -479,11 +523,7 @@ gba_process_message(
 
             msg_set_breakpoints_list = (struct message_set_breakpoints_list const *)message;
 
-            free(gba->debugger.breakpoints.list);
-            gba->debugger.breakpoints.len = msg_set_breakpoints_list->len;
-            gba->debugger.breakpoints.list = calloc(gba->debugger.breakpoints.len, sizeof(struct breakpoint));
-            hs_assert(gba->debugger.breakpoints.list);
-            memcpy(gba->debugger.breakpoints.list, msg_set_breakpoints_list->breakpoints, sizeof(struct breakpoint) * gba->debugger.breakpoints.len);
+            debugger_set_breakpoints(gba, msg_set_breakpoints_list->breakpoints, msg_set_breakpoints_list->len);
 
             gba_send_notification(gba, NOTIFICATION_BREAKPOINTS_LIST_SET);
             break;
@@ -493,11 +533,7 @@ gba_process_message(
 
             msg_set_watchpoints_list = (struct message_set_watchpoints_list const *)message;
 
-            free(gba->debugger.watchpoints.list);
-            gba->debugger.watchpoints.len = msg_set_watchpoints_list->len;
-            gba->debugger.watchpoints.list = calloc(gba->debugger.watchpoints.len, sizeof(struct watchpoint));
-            hs_assert(gba->debugger.watchpoints.list);
-            memcpy(gba->debugger.watchpoints.list, msg_set_watchpoints_list->watchpoints, sizeof(struct watchpoint) * gba->debugger.watchpoints.len);
+            debugger_set_watchpoints(gba, msg_set_watchpoints_list->watchpoints, msg_set_watchpoints_list->len);
 
             gba_send_notification(gba, NOTIFICATION_WATCHPOINTS_LIST_SET);
             break;
@@ -506,6 +542,33 @@ gba_process_message(
     }
 }
 
+/*
+** Process all the messages waiting in the message channel.
+**
+** This is called by `gba_run()`, but frontends driving the emulator synchronously from
+** their own thread can also call it directly, followed by `sched_run_for()`.
+*/
+void
+gba_process_all_messages(
+    struct gba *gba
+) {
+    struct channel *messages;
+    struct message const *msg;
+
+    messages = &gba->channels.messages;
+
+    channel_lock(messages);
+
+    msg = (struct message const *)channel_peek(messages);
+    while (msg) {
+        gba_process_message(gba, msg);
+        channel_pop(messages);
+        msg = (struct message const *)channel_peek(messages);
+    }
+
+    channel_release(messages);
+}
+
 /*
 ** Run the given GBA emulator.
 ** This will process all the message sent to the gba until an exit message is sent.
@@ -520,18 +583,11 @@ gba_run(
 
     while (!gba->exit) {
         // Consume all messages
-        {
-            struct message const *msg;
-
-            channel_lock(messages);
-
-            msg = (struct message const *)channel_next(messages, NULL);
-            while (msg) {
-                gba_process_message(gba, msg);
-                msg = (struct message const *)channel_next(messages, &msg->header);
-            }
+        if (channel_pending(messages) || gba->state != GBA_STATE_RUN) {
+            gba_process_all_messages(gba);
 
-            channel_clear(messages);
+            // The frontend is interacting with the emulator, keep the next slices short.
+            sched_reset_slice(gba);
 
             // If the exit flag was raised, leave now
             if (gba->exit) {
@@ -539,11 +595,11 @@ gba_run(
             }
 
             // Wait until there's new messages in the message queue.
-            if (gba->state == GBA_STATE_PAUSE) {
+            if (gba->state != GBA_STATE_RUN) {
+                channel_lock(messages);
                 channel_wait(messages);
+                channel_release(messages);
             }
-
-            channel_release(messages);
         }
 
         // Process the current state
@@ -556,7 +612,7 @@ gba_run(
 #ifdef WITH_DEBUGGER
                 debugger_execute_run_mode(gba);
 #else
-                sched_run_for(gba, GBA_CYCLES_PER_PIXEL * GBA_SCREEN_REAL_WIDTH);
+                sched_run_slice(gba);
 #endif
                 break;
             };
@@ -571,6 +627,10 @@ void
 gba_delete(
     struct gba *gba
 ) {
+    hle_cleanup(gba);
+#ifdef WITH_PROFILER
+    profiler_cleanup(gba);
+#endif
     free(gba);
 }
 
@@ -652,3 +712,27 @@ gba_delete_notification(
         }
     }
 }
+
+/*
+** Delete all the pending notifications of the given emulator, for the frontends that ignore them.
+*/
+void
+gba_delete_all_notifications(
+    struct gba *gba
+) {
+    struct channel *channel;
+    struct event_header const *event;
+
+    channel = &gba->channels.notifications;
+
+    channel_lock(channel);
+
+    event = channel_peek(channel);
+    while (event) {
+        gba_delete_notification((struct notification const *)event);
+        channel_pop(channel);
+        event = channel_peek(channel);
+    }
+
+    channel_release(channel);
+}
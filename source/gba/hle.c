@@ -0,0 +1,1274 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** References:
+**   * GBATEK
+**      https://problemkaputt.de/gbatek.htm#biosfunctions
+*/
+
+#include <inttypes.h>
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "gba/hle.h"
+
+#define HLE_BIOS_IF                 0x03007FF8  // The interrupts acknowledged by the game's IRQ handler
+#define HLE_BIOS_BUS_AFTER_SWI      0xE3A02004  // The value left on the BIOS bus when a call returns
+#define HLE_BIOS_CHECKSUM           0xBAAE187F
+
+// The approximate costs of the BIOS, in cycles, on top of the memory accesses.
+#define HLE_CYCLES_SWI              40          // The dispatcher, excluding the pipeline refill of the return
+#define HLE_CYCLES_DIV              20
+#define HLE_CYCLES_DIV_BIT          13          // Per bit of the quotient
+#define HLE_CYCLES_SQRT             30
+#define HLE_CYCLES_SQRT_BIT         16          // Per bit of the result
+#define HLE_CYCLES_ARCTAN           110
+#define HLE_CYCLES_CPUSET           30
+#define HLE_CYCLES_CPUSET_UNIT      7           // Per halfword or word
+#define HLE_CYCLES_CPUFASTSET       30
+#define HLE_CYCLES_CPUFASTSET_BLOCK 7           // Per block of 8 words
+#define HLE_CYCLES_UNCOMP           40
+#define HLE_CYCLES_UNCOMP_BYTE      10          // Per byte written
+#define HLE_CYCLES_HUFF_BIT         8           // Per bit of the compressed stream
+#define HLE_CYCLES_BGAFFINE         70          // Per entry
+#define HLE_CYCLES_OBJAFFINE        40          // Per entry
+
+// The number of instructions after which `HLE_CHECK` gives up waiting for the BIOS to return.
+#define HLE_CHECK_MAX_STEPS         (GBA_CYCLES_PER_FRAME * 8)
+
+struct hle_call {
+    uint64_t cycles;
+    bool retry;                         // Run the call again once the core wakes up
+};
+
+struct hle_swi {
+    char const *name;
+    bool (*handler)(struct gba *gba, struct hle_call *call);
+
+    // The registers set by the call, compared by `HLE_CHECK`.
+    uint16_t outputs;
+
+    // False for the calls that wait for an interrupt, which can't be compared.
+    bool checked;
+};
+
+struct hle_output {
+    uint32_t addr;
+    bool halfwords;                     // True for the VRAM variants, which can't write bytes
+    uint8_t pending;                    // The byte waiting for its pair, if `addr` is odd
+};
+
+struct hle_region {
+    uint32_t start;
+    uint8_t *data;
+    size_t size;
+};
+
+#define HLE_REGIONS_LEN             5
+#define HLE_SNAPSHOT_SIZE           (EWRAM_SIZE + IWRAM_SIZE + PALRAM_SIZE + VRAM_SIZE + OAM_SIZE)
+
+/*
+** The sine table of the BIOS, in 1.1.14 fixed point.
+*/
+static int16_t const hle_sine[256] = {
+         0,    402,    804,   1205,   1606,   2006,   2404,   2801,
+      3196,   3590,   3981,   4370,   4756,   5139,   5520,   5897,
+      6270,   6639,   7005,   7366,   7723,   8076,   8423,   8765,
+      9102,   9434,   9760,  10080,  10394,  10702,  11003,  11297,
+     11585,  11866,  12140,  12406,  12665,  12916,  13160,  13395,
+     13623,  13842,  14053,  14256,  14449,  14635,  14811,  14978,
+     15137,  15286,  15426,  15557,  15679,  15791,  15893,  15986,
+     16069,  16143,  16207,  16261,  16305,  16340,  16364,  16379,
+     16384,  16379,  16364,  16340,  16305,  16261,  16207,  16143,
+     16069,  15986,  15893,  15791,  15679,  15557,  15426,  15286,
+     15137,  14978,  14811,  14635,  14449,  14256,  14053,  13842,
+     13623,  13395,  13160,  12916,  12665,  12406,  12140,  11866,
+     11585,  11297,  11003,  10702,  10394,  10080,   9760,   9434,
+      9102,   8765,   8423,   8076,   7723,   7366,   7005,   6639,
+      6270,   5897,   5520,   5139,   4756,   4370,   3981,   3590,
+      3196,   2801,   2404,   2006,   1606,   1205,    804,    402,
+         0,   -402,   -804,  -1205,  -1606,  -2006,  -2404,  -2801,
+     -3196,  -3590,  -3981,  -4370,  -4756,  -5139,  -5520,  -5897,
+     -6270,  -6639,  -7005,  -7366,  -7723,  -8076,  -8423,  -8765,
+     -9102,  -9434,  -9760, -10080, -10394, -10702, -11003, -11297,
+    -11585, -11866, -12140, -12406, -12665, -12916, -13160, -13395,
+    -13623, -13842, -14053, -14256, -14449, -14635, -14811, -14978,
+    -15137, -15286, -15426, -15557, -15679, -15791, -15893, -15986,
+    -16069, -16143, -16207, -16261, -16305, -16340, -16364, -16379,
+    -16384, -16379, -16364, -16340, -16305, -16261, -16207, -16143,
+    -16069, -15986, -15893, -15791, -15679, -15557, -15426, -15286,
+    -15137, -14978, -14811, -14635, -14449, -14256, -14053, -13842,
+    -13623, -13395, -13160, -12916, -12665, -12406, -12140, -11866,
+    -11585, -11297, -11003, -10702, -10394, -10080,  -9760,  -9434,
+     -9102,  -8765,  -8423,  -8076,  -7723,  -7366,  -7005,  -6639,
+     -6270,  -5897,  -5520,  -5139,  -4756,  -4370,  -3981,  -3590,
+     -3196,  -2801,  -2404,  -2006,  -1606,  -1205,   -804,   -402,
+};
+
+/*
+** The BIOS installed when none is given: it boots the game, dispatches the IRQs like the
+** real one (at the same addresses, so the BIOS bus reads the same values) and returns
+** immediately from the calls the HLE doesn't support.
+*/
+static uint32_t const hle_bios_stub[] = {
+    [0x000 / 4] = 0xE3A0F302,           // mov pc, #0x08000000
+    [0x004 / 4] = 0xE1B0F00E,           // movs pc, lr
+    [0x008 / 4] = 0xE1B0F00E,           // movs pc, lr
+    [0x00C / 4] = 0xE25EF004,           // subs pc, lr, #4
+    [0x010 / 4] = 0xE25EF008,           // subs pc, lr, #8
+    [0x014 / 4] = 0xE1B0F00E,           // movs pc, lr
+    [0x018 / 4] = 0xEA000042,           // b 0x128
+    [0x01C / 4] = 0xE25EF004,           // subs pc, lr, #4
+
+    [0x128 / 4] = 0xE92D500F,           // stmfd sp!, {r0-r3, r12, lr}
+    [0x12C / 4] = 0xE3A00301,           // mov r0, #0x04000000
+    [0x130 / 4] = 0xE28FE000,           // add lr, pc, #0
+    [0x134 / 4] = 0xE510F004,           // ldr pc, [r0, #-4]
+    [0x138 / 4] = 0xE8BD500F,           // ldmfd sp!, {r0-r3, r12, lr}
+    [0x13C / 4] = 0xE25EF004,           // subs pc, lr, #4
+};
+
+static
+uint32_t
+hle_read(
+    struct gba *gba,
+    struct hle_call *call,
+    uint32_t addr,
+    uint32_t size,
+    enum access_types access_type
+) {
+    call->cycles += mem_access_cycles(gba, addr, size, access_type);
+    switch (size) {
+        case sizeof(uint8_t):   return (mem_read8_raw(gba, addr));
+        case sizeof(uint16_t):  return (mem_read16_raw(gba, addr));
+        default:                return (mem_read32_raw(gba, addr));
+    }
+}
+
+static
+void
+hle_write(
+    struct gba *gba,
+    struct hle_call *call,
+    uint32_t addr,
+    uint32_t val,
+    uint32_t size,
+    enum access_types access_type
+) {
+    call->cycles += mem_access_cycles(gba, addr, size, access_type);
+    switch (size) {
+        case sizeof(uint8_t):   mem_write8_raw(gba, addr, val); break;
+        case sizeof(uint16_t):  mem_write16_raw(gba, addr, val); break;
+        default:                mem_write32_raw(gba, addr, val); break;
+    }
+}
+
+/*
+** The BIOS refuses to read its own memory.
+*/
+static inline
+bool
+hle_is_bios_addr(
+    uint32_t addr
+) {
+    return (!(addr & 0x0E000000));
+}
+
+static
+uint32_t
+hle_bits(
+    uint32_t val
+) {
+    return (val ? 32 - __builtin_clz(val) : 0);
+}
+
+static
+bool
+hle_div_common(
+    struct gba *gba,
+    struct hle_call *call,
+    int32_t num,
+    int32_t den
+) {
+    struct core *core;
+    uint32_t abs_num;
+    uint32_t abs_den;
+    int32_t quot;
+    int32_t rem;
+
+    // The BIOS never returns, or returns garbage, on a division by zero.
+    if (!den) {
+        return (true);
+    }
+
+    core = &gba->core;
+
+    if (num == INT32_MIN && den == -1) {
+        quot = INT32_MIN;
+        rem = 0;
+    } else {
+        quot = num / den;
+        rem = num % den;
+    }
+
+    abs_num = num < 0 ? -(uint32_t)num : (uint32_t)num;
+    abs_den = den < 0 ? -(uint32_t)den : (uint32_t)den;
+
+    core->r0 = quot;
+    core->r1 = rem;
+    core->r3 = quot < 0 ? -(uint32_t)quot : (uint32_t)quot;
+
+    call->cycles += HLE_CYCLES_DIV;
+    if (abs_num >= abs_den) {
+        call->cycles += HLE_CYCLES_DIV_BIT * (hle_bits(abs_num) - hle_bits(abs_den) + 1);
+    }
+
+    return (false);
+}
+
+static
+bool
+hle_div(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    return (hle_div_common(gba, call, gba->core.r0, gba->core.r1));
+}
+
+static
+bool
+hle_div_arm(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    return (hle_div_common(gba, call, gba->core.r1, gba->core.r0));
+}
+
+static
+bool
+hle_sqrt(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    uint32_t val;
+    uint32_t res;
+    uint32_t bit;
+
+    val = gba->core.r0;
+    res = 0;
+    bit = 1u << 30;
+
+    while (bit > val) {
+        bit >>= 2;
+    }
+
+    while (bit) {
+        if (val >= res + bit) {
+            val -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    gba->core.r0 = res;
+    call->cycles += HLE_CYCLES_SQRT + HLE_CYCLES_SQRT_BIT * ((hle_bits(gba->core.r0) + 1) / 2);
+    return (false);
+}
+
+/*
+** The polynomial approximation of the BIOS.
+** The products wrap like the 32-bit multiplications of the BIOS.
+*/
+static
+int32_t
+hle_arctan_poly(
+    int32_t i
+) {
+    int32_t a;
+    int32_t b;
+
+    a = -((int32_t)((uint32_t)i * (uint32_t)i) >> 14);
+    b = ((int32_t)(0xA9u * (uint32_t)a) >> 14) + 0x390;
+    b = ((int32_t)((uint32_t)b * (uint32_t)a) >> 14) + 0x91C;
+    b = ((int32_t)((uint32_t)b * (uint32_t)a) >> 14) + 0xFB6;
+    b = ((int32_t)((uint32_t)b * (uint32_t)a) >> 14) + 0x16AA;
+    b = ((int32_t)((uint32_t)b * (uint32_t)a) >> 14) + 0x2081;
+    b = ((int32_t)((uint32_t)b * (uint32_t)a) >> 14) + 0x3651;
+    b = ((int32_t)((uint32_t)b * (uint32_t)a) >> 14) + 0xA2F9;
+    return ((int32_t)((uint32_t)i * (uint32_t)b) >> 16);
+}
+
+static
+bool
+hle_arctan(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    gba->core.r0 = hle_arctan_poly(gba->core.r0);
+    call->cycles += HLE_CYCLES_ARCTAN;
+    return (false);
+}
+
+static
+int32_t
+hle_arctan_ratio(
+    struct hle_call *call,
+    int32_t num,
+    int32_t den
+) {
+    int64_t ratio;
+
+    ratio = ((int64_t)num << 14) / den;
+    call->cycles += HLE_CYCLES_DIV + HLE_CYCLES_DIV_BIT * 15;
+    return (hle_arctan_poly((int32_t)ratio));
+}
+
+static
+bool
+hle_arctan2(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    int32_t x;
+    int32_t y;
+    int32_t res;
+
+    x = gba->core.r0;
+    y = gba->core.r1;
+
+    call->cycles += HLE_CYCLES_ARCTAN;
+
+    if (!y) {
+        res = x >= 0 ? 0x0000 : 0x8000;
+    } else if (!x) {
+        res = y >= 0 ? 0x4000 : 0xC000;
+    } else if (y >= 0) {
+        if (x >= 0 && x >= y) {
+            res = hle_arctan_ratio(call, y, x);
+        } else if (x < 0 && -x >= y) {
+            res = hle_arctan_ratio(call, y, x) + 0x8000;
+        } else {
+            res = 0x4000 - hle_arctan_ratio(call, x, y);
+        }
+    } else {
+        if (x <= 0 && -x > -y) {
+            res = hle_arctan_ratio(call, y, x) + 0x8000;
+        } else if (x > 0 && x >= -y) {
+            res = hle_arctan_ratio(call, y, x) + 0x10000;
+        } else {
+            res = 0xC000 - hle_arctan_ratio(call, x, y);
+        }
+    }
+
+    gba->core.r0 = (uint32_t)res & 0xFFFF;
+    return (false);
+}
+
+static
+bool
+hle_cpu_set(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    uint32_t src;
+    uint32_t dst;
+    uint32_t size;
+    uint32_t count;
+    uint32_t val;
+    bool fill;
+    uint32_t i;
+
+    size = bitfield_get(gba->core.r2, 26) ? sizeof(uint32_t) : sizeof(uint16_t);
+    fill = bitfield_get(gba->core.r2, 24);
+    count = gba->core.r2 & 0x1FFFFF;
+    src = gba->core.r0 & ~(size - 1);
+    dst = gba->core.r1 & ~(size - 1);
+
+    call->cycles += HLE_CYCLES_CPUSET;
+
+    if (hle_is_bios_addr(src) || hle_is_bios_addr(src + (fill ? size : count * size))) {
+        return (false);
+    }
+
+    val = 0;
+    for (i = 0; i < count; ++i) {
+        if (!fill || !i) {
+            val = hle_read(gba, call, src, size, NON_SEQUENTIAL);
+            src += fill ? 0 : size;
+        }
+        hle_write(gba, call, dst, val, size, NON_SEQUENTIAL);
+        dst += size;
+        call->cycles += HLE_CYCLES_CPUSET_UNIT;
+    }
+
+    return (false);
+}
+
+static
+bool
+hle_cpu_fast_set(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    uint32_t src;
+    uint32_t dst;
+    uint32_t count;
+    uint32_t val;
+    bool fill;
+    uint32_t i;
+
+    fill = bitfield_get(gba->core.r2, 24);
+    count = ((gba->core.r2 & 0x1FFFFF) + 7) & ~7u;      // Rounded up to a block of 8 words
+    src = gba->core.r0 & ~3;
+    dst = gba->core.r1 & ~3;
+
+    call->cycles += HLE_CYCLES_CPUFASTSET;
+
+    if (hle_is_bios_addr(src) || hle_is_bios_addr(src + (fill ? 4 : count * 4))) {
+        return (false);
+    }
+
+    val = 0;
+    for (i = 0; i < count; ++i) {
+        enum access_types access_type;
+
+        access_type = (i % 8) ? SEQUENTIAL : NON_SEQUENTIAL;
+        if (!fill || !i) {
+            val = hle_read(gba, call, src, sizeof(uint32_t), access_type);
+            src += fill ? 0 : 4;
+        }
+        hle_write(gba, call, dst, val, sizeof(uint32_t), access_type);
+        dst += 4;
+
+        if (!(i % 8)) {
+            call->cycles += HLE_CYCLES_CPUFASTSET_BLOCK;
+        }
+    }
+
+    return (false);
+}
+
+static
+void
+hle_bg_obj_matrix(
+    int32_t sx,
+    int32_t sy,
+    uint32_t angle,
+    int32_t matrix[4]
+) {
+    int32_t sin;
+    int32_t cos;
+
+    sin = hle_sine[(angle >> 8) & 0xFF];
+    cos = hle_sine[((angle >> 8) + 64) & 0xFF];
+
+    matrix[0] = (sx * cos) >> 14;
+    matrix[1] = (-sx * sin) >> 14;
+    matrix[2] = (sy * sin) >> 14;
+    matrix[3] = (sy * cos) >> 14;
+}
+
+static
+bool
+hle_bg_affine_set(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    uint32_t src;
+    uint32_t dst;
+    uint32_t count;
+    uint32_t i;
+
+    src = gba->core.r0;
+    dst = gba->core.r1;
+    count = gba->core.r2;
+
+    for (i = 0; i < count; ++i) {
+        int32_t matrix[4];
+        int32_t orig_x;
+        int32_t orig_y;
+        int32_t disp_x;
+        int32_t disp_y;
+
+        orig_x = (int32_t)hle_read(gba, call, src + 0, sizeof(uint32_t), NON_SEQUENTIAL);
+        orig_y = (int32_t)hle_read(gba, call, src + 4, sizeof(uint32_t), NON_SEQUENTIAL);
+        disp_x = (int16_t)hle_read(gba, call, src + 8, sizeof(uint16_t), NON_SEQUENTIAL);
+        disp_y = (int16_t)hle_read(gba, call, src + 10, sizeof(uint16_t), NON_SEQUENTIAL);
+
+        hle_bg_obj_matrix(
+            (int16_t)hle_read(gba, call, src + 12, sizeof(uint16_t), NON_SEQUENTIAL),
+            (int16_t)hle_read(gba, call, src + 14, sizeof(uint16_t), NON_SEQUENTIAL),
+            hle_read(gba, call, src + 16, sizeof(uint16_t), NON_SEQUENTIAL),
+            matrix
+        );
+
+        hle_write(gba, call, dst + 0, (uint16_t)matrix[0], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 2, (uint16_t)matrix[1], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 4, (uint16_t)matrix[2], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 6, (uint16_t)matrix[3], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 8, orig_x - (matrix[0] * disp_x + matrix[1] * disp_y), sizeof(uint32_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 12, orig_y - (matrix[2] * disp_x + matrix[3] * disp_y), sizeof(uint32_t), NON_SEQUENTIAL);
+
+        call->cycles += HLE_CYCLES_BGAFFINE;
+        src += 20;
+        dst += 16;
+    }
+
+    return (false);
+}
+
+static
+bool
+hle_obj_affine_set(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    uint32_t src;
+    uint32_t dst;
+    uint32_t count;
+    uint32_t offset;
+    uint32_t i;
+
+    src = gba->core.r0;
+    dst = gba->core.r1;
+    count = gba->core.r2;
+    offset = gba->core.r3;
+
+    for (i = 0; i < count; ++i) {
+        int32_t matrix[4];
+
+        hle_bg_obj_matrix(
+            (int16_t)hle_read(gba, call, src + 0, sizeof(uint16_t), NON_SEQUENTIAL),
+            (int16_t)hle_read(gba, call, src + 2, sizeof(uint16_t), NON_SEQUENTIAL),
+            hle_read(gba, call, src + 4, sizeof(uint16_t), NON_SEQUENTIAL),
+            matrix
+        );
+
+        hle_write(gba, call, dst + 0 * offset, (uint16_t)matrix[0], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 1 * offset, (uint16_t)matrix[1], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 2 * offset, (uint16_t)matrix[2], sizeof(uint16_t), NON_SEQUENTIAL);
+        hle_write(gba, call, dst + 3 * offset, (uint16_t)matrix[3], sizeof(uint16_t), NON_SEQUENTIAL);
+
+        call->cycles += HLE_CYCLES_OBJAFFINE;
+        src += 8;
+        dst += 4 * offset;
+    }
+
+    return (false);
+}
+
+/*
+** Write a byte of decompressed data.
+** The VRAM variants write it by halfwords, so the last byte of an odd size is lost.
+*/
+static
+void
+hle_output_put(
+    struct gba *gba,
+    struct hle_call *call,
+    struct hle_output *output,
+    uint8_t val
+) {
+    if (!output->halfwords) {
+        hle_write(gba, call, output->addr, val, sizeof(uint8_t), NON_SEQUENTIAL);
+    } else if (output->addr & 1) {
+        hle_write(gba, call, output->addr & ~1, output->pending | (val << 8), sizeof(uint16_t), NON_SEQUENTIAL);
+    } else {
+        output->pending = val;
+    }
+
+    ++output->addr;
+    call->cycles += HLE_CYCLES_UNCOMP_BYTE;
+}
+
+/*
+** Read back a byte of decompressed data, including the one that isn't written yet.
+*/
+static
+uint8_t
+hle_output_peek(
+    struct gba *gba,
+    struct hle_call *call,
+    struct hle_output const *output,
+    uint32_t addr
+) {
+    if (output->halfwords && (output->addr & 1) && addr == output->addr - 1) {
+        return (output->pending);
+    }
+    return (hle_read(gba, call, addr, sizeof(uint8_t), NON_SEQUENTIAL));
+}
+
+/*
+** Read the header of compressed data and return the size of the decompressed data, or 0
+** if the source can't be read.
+*/
+static
+uint32_t
+hle_uncomp_header(
+    struct gba *gba,
+    struct hle_call *call,
+    uint32_t src
+) {
+    call->cycles += HLE_CYCLES_UNCOMP;
+    if (hle_is_bios_addr(src)) {
+        return (0);
+    }
+    return (hle_read(gba, call, src, sizeof(uint32_t), NON_SEQUENTIAL) >> 8);
+}
+
+static
+bool
+hle_lz77_uncomp(
+    struct gba *gba,
+    struct hle_call *call,
+    bool halfwords
+) {
+    struct hle_output output;
+    uint32_t remaining;
+    uint32_t src;
+
+    src = gba->core.r0;
+    output.addr = gba->core.r1;
+    output.halfwords = halfwords;
+    output.pending = 0;
+
+    remaining = hle_uncomp_header(gba, call, src);
+    src += 4;
+
+    while (remaining) {
+        uint8_t flags;
+        uint32_t i;
+
+        flags = hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL);
+        for (i = 0; i < 8 && remaining; ++i, flags <<= 1) {
+            if (flags & 0x80) {
+                uint32_t disp;
+                uint32_t len;
+                uint8_t b0;
+                uint8_t b1;
+
+                b0 = hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL);
+                b1 = hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL);
+                disp = (((b0 & 0xF) << 8) | b1) + 1;
+                len = min((b0 >> 4) + 3u, remaining);
+                remaining -= len;
+
+                while (len--) {
+                    hle_output_put(gba, call, &output, hle_output_peek(gba, call, &output, output.addr - disp));
+                }
+            } else {
+                hle_output_put(gba, call, &output, hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL));
+                --remaining;
+            }
+        }
+    }
+
+    return (false);
+}
+
+static
+bool
+hle_lz77_uncomp_wram(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    return (hle_lz77_uncomp(gba, call, false));
+}
+
+static
+bool
+hle_lz77_uncomp_vram(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    return (hle_lz77_uncomp(gba, call, true));
+}
+
+static
+bool
+hle_rl_uncomp(
+    struct gba *gba,
+    struct hle_call *call,
+    bool halfwords
+) {
+    struct hle_output output;
+    uint32_t remaining;
+    uint32_t src;
+
+    src = gba->core.r0;
+    output.addr = gba->core.r1;
+    output.halfwords = halfwords;
+    output.pending = 0;
+
+    remaining = hle_uncomp_header(gba, call, src);
+    src += 4;
+
+    while (remaining) {
+        uint8_t flag;
+        uint32_t len;
+
+        flag = hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL);
+        if (flag & 0x80) {
+            uint8_t val;
+
+            len = min((flag & 0x7Fu) + 3u, remaining);
+            val = hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL);
+            remaining -= len;
+            while (len--) {
+                hle_output_put(gba, call, &output, val);
+            }
+        } else {
+            len = min((flag & 0x7Fu) + 1u, remaining);
+            remaining -= len;
+            while (len--) {
+                hle_output_put(gba, call, &output, hle_read(gba, call, src++, sizeof(uint8_t), NON_SEQUENTIAL));
+            }
+        }
+    }
+
+    return (false);
+}
+
+static
+bool
+hle_rl_uncomp_wram(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    return (hle_rl_uncomp(gba, call, false));
+}
+
+static
+bool
+hle_rl_uncomp_vram(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    return (hle_rl_uncomp(gba, call, true));
+}
+
+/*
+** Each node of the tree has the offset of its children in its 6 lower bits, and the bits
+** 7 and 6 tell if the left and right children are data.
+**
+** The decompressed data is written by words.
+*/
+static
+bool
+hle_huff_uncomp(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    uint32_t remaining;
+    uint32_t data_bits;
+    uint32_t root;
+    uint32_t node_addr;
+    uint32_t src;
+    uint32_t dst;
+    uint32_t out;
+    uint32_t out_bits;
+    uint8_t node;
+
+    src = gba->core.r0;
+    dst = gba->core.r1 & ~3;
+
+    remaining = hle_uncomp_header(gba, call, src);
+    if (!remaining) {
+        return (false);
+    }
+
+    data_bits = hle_read(gba, call, src, sizeof(uint8_t), NON_SEQUENTIAL) & 0xF;
+    if (data_bits != 4 && data_bits != 8) {
+        return (true);
+    }
+
+    root = src + 5;
+    src += 4 + (hle_read(gba, call, src + 4, sizeof(uint8_t), NON_SEQUENTIAL) + 1) * 2;
+
+    node_addr = root;
+    node = hle_read(gba, call, root, sizeof(uint8_t), NON_SEQUENTIAL);
+    out = 0;
+    out_bits = 0;
+
+    while (remaining) {
+        uint32_t stream;
+        int32_t i;
+
+        stream = hle_read(gba, call, src, sizeof(uint32_t), NON_SEQUENTIAL);
+        src += 4;
+
+        for (i = 31; i >= 0 && remaining; --i) {
+            uint32_t child;
+            bool is_data;
+
+            child = (node_addr & ~1) + (node & 0x3F) * 2 + 2;
+            if ((stream >> i) & 1) {
+                child += 1;
+                is_data = bitfield_get(node, 6);
+            } else {
+                is_data = bitfield_get(node, 7);
+            }
+
+            call->cycles += HLE_CYCLES_HUFF_BIT;
+
+            if (is_data) {
+                out |= (hle_read(gba, call, child, sizeof(uint8_t), NON_SEQUENTIAL) & ((1u << data_bits) - 1)) << out_bits;
+                out_bits += data_bits;
+
+                if (out_bits == 32) {
+                    hle_write(gba, call, dst, out, sizeof(uint32_t), NON_SEQUENTIAL);
+                    dst += 4;
+                    remaining = remaining > 4 ? remaining - 4 : 0;
+                    out = 0;
+                    out_bits = 0;
+                }
+
+                node_addr = root;
+            } else {
+                node_addr = child;
+            }
+            node = hle_read(gba, call, node_addr, sizeof(uint8_t), NON_SEQUENTIAL);
+        }
+    }
+
+    return (false);
+}
+
+static
+bool
+hle_halt(
+    struct gba *gba,
+    struct hle_call *call __unused
+) {
+    gba->core.state = CORE_HALT;
+    return (false);
+}
+
+static
+bool
+hle_stop(
+    struct gba *gba,
+    struct hle_call *call __unused
+) {
+    mem_io_write8(gba, IO_REG_HALTCNT, 0x80);
+    return (false);
+}
+
+/*
+** Wait until one of the interrupts in r1 is acknowledged by the game's IRQ handler.
+**
+** The core is halted and the call is run again once it wakes up, after the IRQ handler had
+** the chance to run. The old interrupts are only discarded the first time.
+*/
+static
+bool
+hle_intr_wait(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    struct core *core;
+    uint16_t flags;
+
+    core = &gba->core;
+    gba->io.ime.raw = 1;
+
+    flags = mem_read16_raw(gba, HLE_BIOS_IF);
+
+    // Discard the interrupts acknowledged before the call
+    if (core->r0 && !gba->hle.waiting) {
+        flags &= ~core->r1;
+        mem_write16_raw(gba, HLE_BIOS_IF, flags);
+    }
+
+    if (flags & core->r1) {
+        mem_write16_raw(gba, HLE_BIOS_IF, flags & ~core->r1);
+        gba->hle.waiting = false;
+        return (false);
+    }
+
+    // Don't halt if an IRQ is about to be taken, the core would wake up before running it.
+    if (!(gba->io.int_enabled.raw & gba->io.int_flag.raw)) {
+        core->state = CORE_HALT;
+    }
+
+    gba->hle.waiting = true;
+    call->retry = true;
+    return (false);
+}
+
+static
+bool
+hle_vblank_intr_wait(
+    struct gba *gba,
+    struct hle_call *call
+) {
+    gba->core.r0 = 1;
+    gba->core.r1 = 1;
+    return (hle_intr_wait(gba, call));
+}
+
+static
+bool
+hle_get_bios_checksum(
+    struct gba *gba,
+    struct hle_call *call __unused
+) {
+    gba->core.r0 = HLE_BIOS_CHECKSUM;
+    return (false);
+}
+
+#define R(x)    (1u << (x))
+
+static struct hle_swi const hle_swis[HLE_SWI_LEN] = {
+    [0x00] = { "SoftReset",         NULL,                   0,                  false },
+    [0x01] = { "RegisterRamReset",  NULL,                   0,                  false },
+    [0x02] = { "Halt",              hle_halt,               0,                  false },
+    [0x03] = { "Stop",              hle_stop,               0,                  false },
+    [0x04] = { "IntrWait",          hle_intr_wait,          0,                  false },
+    [0x05] = { "VBlankIntrWait",    hle_vblank_intr_wait,   0,                  false },
+    [0x06] = { "Div",               hle_div,                R(0) | R(1) | R(3), true },
+    [0x07] = { "DivArm",            hle_div_arm,            R(0) | R(1) | R(3), true },
+    [0x08] = { "Sqrt",              hle_sqrt,               R(0),               true },
+    [0x09] = { "ArcTan",            hle_arctan,             R(0),               true },
+    [0x0A] = { "ArcTan2",           hle_arctan2,            R(0),               true },
+    [0x0B] = { "CpuSet",            hle_cpu_set,            0,                  true },
+    [0x0C] = { "CpuFastSet",        hle_cpu_fast_set,       0,                  true },
+    [0x0D] = { "GetBiosChecksum",   hle_get_bios_checksum,  R(0),               true },
+    [0x0E] = { "BgAffineSet",       hle_bg_affine_set,      0,                  true },
+    [0x0F] = { "ObjAffineSet",      hle_obj_affine_set,     0,                  true },
+    [0x10] = { "BitUnPack",         NULL,                   0,                  false },
+    [0x11] = { "LZ77UnCompWram",    hle_lz77_uncomp_wram,   0,                  true },
+    [0x12] = { "LZ77UnCompVram",    hle_lz77_uncomp_vram,   0,                  true },
+    [0x13] = { "HuffUnComp",        hle_huff_uncomp,        0,                  true },
+    [0x14] = { "RLUnCompWram",      hle_rl_uncomp_wram,     0,                  true },
+    [0x15] = { "RLUnCompVram",      hle_rl_uncomp_vram,     0,                  true },
+};
+
+#undef R
+
+/*
+** Reset the HLE, and install the BIOS stub if no BIOS was given.
+**
+** Must be called after the memory was reset.
+*/
+void
+hle_reset(
+    struct gba *gba,
+    enum hle_modes mode,
+    bool bios_stub
+) {
+    struct hle *hle;
+
+    hle = &gba->hle;
+
+    if (bios_stub) {
+        if (mode != HLE_ON) {
+            logln(HS_WARNING, "No BIOS was given, the high-level emulation of the BIOS is enabled.");
+            mode = HLE_ON;
+        }
+        memcpy(gba->memory.bios, hle_bios_stub, sizeof(hle_bios_stub));
+    }
+
+    hle->mode = mode;
+    hle->bios_stub = bios_stub;
+    hle->waiting = false;
+    memset(hle->stats, 0, sizeof(hle->stats));
+    memset(hle->warned, 0, sizeof(hle->warned));
+}
+
+void
+hle_cleanup(
+    struct gba *gba
+) {
+    free(gba->hle.snapshot);
+    free(gba->hle.result);
+    gba->hle.snapshot = NULL;
+    gba->hle.result = NULL;
+}
+
+static
+void
+hle_regions(
+    struct gba *gba,
+    struct hle_region regions[HLE_REGIONS_LEN]
+) {
+    regions[0] = (struct hle_region){ EWRAM_START, gba->memory.ewram, EWRAM_SIZE };
+    regions[1] = (struct hle_region){ IWRAM_START, gba->memory.iwram, IWRAM_SIZE };
+    regions[2] = (struct hle_region){ PALRAM_START, gba->memory.palram, PALRAM_SIZE };
+    regions[3] = (struct hle_region){ VRAM_START, gba->memory.vram, VRAM_SIZE };
+    regions[4] = (struct hle_region){ OAM_START, gba->memory.oam, OAM_SIZE };
+}
+
+static
+void
+hle_regions_save(
+    struct hle_region const regions[HLE_REGIONS_LEN],
+    uint8_t *buffer
+) {
+    size_t i;
+
+    for (i = 0; i < HLE_REGIONS_LEN; ++i) {
+        memcpy(buffer, regions[i].data, regions[i].size);
+        buffer += regions[i].size;
+    }
+}
+
+static
+void
+hle_regions_restore(
+    struct hle_region const regions[HLE_REGIONS_LEN],
+    uint8_t const *buffer
+) {
+    size_t i;
+
+    for (i = 0; i < HLE_REGIONS_LEN; ++i) {
+        memcpy(regions[i].data, buffer, regions[i].size);
+        buffer += regions[i].size;
+    }
+}
+
+/*
+** Leave the call, charging the cycles it took.
+*/
+static
+void
+hle_return(
+    struct gba *gba,
+    struct hle_call const *call
+) {
+    struct core *core;
+
+    core = &gba->core;
+
+    core_idle_for(gba, HLE_CYCLES_SWI + call->cycles);
+
+    // Return right after the SWI, or on it to run it again
+    core->pc -= (core->cpsr.thumb ? 2 : 4) * (call->retry ? 2 : 1);
+    core_reload_pipeline(gba);
+
+    gba->memory.bios_bus = HLE_BIOS_BUS_AFTER_SWI;
+}
+
+/*
+** Run the call with the HLE, roll the RAMs and the registers back, run it again with the
+** BIOS and report the differences.
+**
+** The writes outside of the RAMs (eg. a `CpuSet` to the IO registers) can't be rolled back
+** and are done twice.
+*/
+static
+void
+hle_check(
+    struct gba *gba,
+    uint32_t comment
+) {
+    struct hle_region regions[HLE_REGIONS_LEN];
+    struct hle_swi const *swi;
+    struct hle_stats *stats;
+    struct hle_call call;
+    struct core *core;
+    struct core before;
+    struct core after;
+    enum arm_modes mode;
+    uint64_t start;
+    uint32_t ret;
+    size_t offset;
+    size_t steps;
+    size_t i;
+    bool thumb;
+    bool mismatch;
+
+    core = &gba->core;
+    swi = hle_swis + comment;
+
+    if (!gba->hle.snapshot) {
+        gba->hle.snapshot = malloc(HLE_SNAPSHOT_SIZE);
+        gba->hle.result = malloc(HLE_SNAPSHOT_SIZE);
+        hs_assert(gba->hle.snapshot);
+        hs_assert(gba->hle.result);
+    }
+
+    hle_regions(gba, regions);
+    hle_regions_save(regions, gba->hle.snapshot);
+    before = *core;
+
+    memset(&call, 0, sizeof(call));
+    if (swi->handler(gba, &call)) {
+        core_interrupt(gba, VEC_SVC, MODE_SVC);
+        return ;
+    }
+
+    after = *core;
+    hle_regions_save(regions, gba->hle.result);
+    hle_regions_restore(regions, gba->hle.snapshot);
+    *core = before;
+
+    // Run the BIOS until it returns right after the SWI
+    mode = core->cpsr.mode;
+    thumb = core->cpsr.thumb;
+    ret = core->pc - (thumb ? 2 : 4);
+    start = gba->scheduler.cycles;
+
+    core_interrupt(gba, VEC_SVC, MODE_SVC);
+
+    steps = 0;
+    while (core->cpsr.mode != mode || core->cpsr.thumb != thumb || core->pc - (thumb ? 4 : 8) != ret) {
+        if (++steps > HLE_CHECK_MAX_STEPS) {
+            logln(HS_WARNING, "HLE check: the BIOS didn't return from %s (SWI 0x%02x).", swi->name, comment);
+            return ;
+        }
+        core_next(gba);
+    }
+
+    stats = gba->hle.stats + comment;
+    ++stats->calls;
+    stats->hle_cycles += HLE_CYCLES_SWI + call.cycles;
+    stats->hle_cycles += mem_access_cycles(gba, ret, thumb ? 2 : 4, NON_SEQUENTIAL) + mem_access_cycles(gba, ret, thumb ? 2 : 4, SEQUENTIAL);
+    stats->lle_cycles += gba->scheduler.cycles - start;
+
+    mismatch = false;
+
+    for (i = 0; i < array_length(core->registers); ++i) {
+        if (bitfield_get(swi->outputs, i) && after.registers[i] != core->registers[i]) {
+            logln(
+                HS_WARNING,
+                "HLE check: %s (SWI 0x%02x) set r%zu to 0x%08x instead of 0x%08x.",
+                swi->name,
+                comment,
+                i,
+                after.registers[i],
+                core->registers[i]
+            );
+            mismatch = true;
+        }
+    }
+
+    offset = 0;
+    for (i = 0; i < HLE_REGIONS_LEN; ++i) {
+        uint8_t const *expected;
+        uint8_t const *got;
+        size_t diffs;
+        size_t first;
+        size_t j;
+
+        expected = regions[i].data;
+        got = gba->hle.result + offset;
+        offset += regions[i].size;
+
+        if (!memcmp(expected, got, regions[i].size)) {
+            continue;
+        }
+
+        diffs = 0;
+        first = 0;
+        for (j = 0; j < regions[i].size; ++j) {
+            if (expected[j] != got[j]) {
+                first = diffs ? first : j;
+                ++diffs;
+            }
+        }
+
+        logln(
+            HS_WARNING,
+            "HLE check: %s (SWI 0x%02x) wrote %zu wrong byte(s), the first at 0x%08zx is 0x%02x instead of 0x%02x.",
+            swi->name,
+            comment,
+            diffs,
+            regions[i].start + first,
+            got[first],
+            expected[first]
+        );
+        mismatch = true;
+    }
+
+    stats->mismatches += mismatch;
+}
+
+/*
+** Run the software interrupt with the given comment natively.
+**
+** Return true if it isn't supported, in which case the BIOS must run it.
+*/
+bool
+hle_swi(
+    struct gba *gba,
+    uint32_t comment
+) {
+    struct hle_swi const *swi;
+    struct hle_call call;
+
+    comment &= HLE_SWI_LEN - 1;
+    swi = hle_swis + comment;
+
+    if (!swi->handler) {
+        if (gba->hle.bios_stub && !bitfield_get(gba->hle.warned[comment / 64], comment % 64)) {
+            logln(
+                HS_WARNING,
+                "%s (SWI 0x%02x) isn't supported without a BIOS and is ignored.",
+                swi->name ?: "Unknown call",
+                comment
+            );
+            gba->hle.warned[comment / 64] |= (uint64_t)1 << (comment % 64);
+        }
+        return (true);
+    }
+
+    if (gba->hle.mode == HLE_CHECK && swi->checked) {
+        hle_check(gba, comment);
+        return (false);
+    }
+
+    memset(&call, 0, sizeof(call));
+    if (swi->handler(gba, &call)) {
+        return (true);
+    }
+
+    hle_return(gba, &call);
+    return (false);
+}
+
+/*
+** Write, for each call compared by `HLE_CHECK`, how many times the HLE was wrong and how
+** far its cycles were from the BIOS's.
+**
+** Return true if the write failed.
+*/
+bool
+hle_write_report(
+    struct gba const *gba,
+    FILE *file
+) {
+    size_t i;
+
+    fprintf(file, "swi,name,calls,mismatches,hle_cycles_mean,lle_cycles_mean\n");
+    for (i = 0; i < HLE_SWI_LEN; ++i) {
+        struct hle_stats const *stats;
+
+        stats = gba->hle.stats + i;
+        if (!stats->calls) {
+            continue;
+        }
+
+        fprintf(
+            file,
+            "0x%02zx,%s,%" PRIu64 ",%" PRIu64 ",%.1f,%.1f\n",
+            i,
+            hle_swis[i].name,
+            stats->calls,
+            stats->mismatches,
+            (double)stats->hle_cycles / stats->calls,
+            (double)stats->lle_cycles / stats->calls
+        );
+    }
+
+    return (ferror(file) != 0);
+}
@@ -0,0 +1,462 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** The serial port and the link cable.
+**
+** Only the normal (8 and 32 bits) and multi-player modes go through the link cable. When
+** the emulator isn't linked, or for the other modes, transfers end as soon as they start.
+**
+** A linked emulator stops at a sync point every quantum: it publishes its cycle counter,
+** picks up the transfer the parent may have started in the meantime and waits for the
+** emulators lagging more than a quantum behind.
+** Because of that, the other emulators can't be more than two quanta ahead of the parent
+** when it starts a transfer, and they all see it before it ends if it lasts at least
+** two quanta. They then meet at the end of the transfer to exchange their data.
+*/
+
+#include <inttypes.h>
+#include <sched.h>
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "gba/link.h"
+#include "gba/scheduler.h"
+
+// The amount of times a waiting emulator spins before yielding its time slice.
+#define LINK_SPINS              256
+
+static uint32_t const multi_baud_rates[4] = { 9600, 38400, 57600, 115200 };
+
+/*
+** Initialize an empty link cable, where each emulator can run `quantum` cycles ahead of
+** the others.
+*/
+void
+link_init(
+    struct link *link,
+    uint64_t quantum
+) {
+    size_t i;
+
+    memset(link, 0, sizeof(*link));
+    link->quantum = quantum;
+
+    for (i = 0; i < LINK_MAX_PLAYERS; ++i) {
+        atomic_init(&link->connected[i], false);
+        atomic_init(&link->cycles[i], UINT64_MAX);
+        atomic_init(&link->arrived[i], 0);
+        atomic_init(&link->data[0][i], 0);
+        atomic_init(&link->data[1][i], 0);
+    }
+    atomic_init(&link->seq, 0);
+}
+
+/*
+** Plug the given emulator to the link cable, as its next player.
+**
+** All the emulators must be connected before they are reset and before any of them runs.
+*/
+void
+link_connect(
+    struct link *link,
+    struct gba *gba
+) {
+    size_t id;
+
+    hs_assert(link->players_len < LINK_MAX_PLAYERS);
+
+    id = link->players_len++;
+    link->players[id] = gba;
+    atomic_store(&link->cycles[id], 0);
+    atomic_store(&link->connected[id], true);
+
+    gba->link.link = link;
+    gba->link.id = id;
+    gba->link.seq = 0;
+}
+
+/*
+** Unplug the given emulator from the link cable.
+**
+** The other emulators stop waiting for it, so this must be called as soon as an emulator
+** stops running, otherwise the others would wait for it forever.
+*/
+void
+link_disconnect(
+    struct gba *gba
+) {
+    struct link *link;
+
+    link = gba->link.link;
+    if (!link) {
+        return ;
+    }
+
+    atomic_store(&link->connected[gba->link.id], false);
+    atomic_store(&link->cycles[gba->link.id], UINT64_MAX);
+    gba->link.link = NULL;
+}
+
+/*
+** Called when the emulator is reset: schedule its sync points.
+*/
+void
+link_reset(
+    struct gba *gba
+) {
+    struct link *link;
+
+    link = gba->link.link;
+    if (!link) {
+        return ;
+    }
+
+    atomic_store(&link->cycles[gba->link.id], 0);
+    gba->link.seq = atomic_load(&link->seq);
+
+    sched_add_event(
+        gba,
+        NEW_REPEAT_EVENT(
+            SCHED_EVENT_LINK_SYNC,
+            link->quantum,      // Timing of first trigger
+            link->quantum       // Period
+        )
+    );
+}
+
+static inline
+void
+link_wait(
+    uint32_t *spins
+) {
+    if (++*spins >= LINK_SPINS) {
+        sched_yield();
+    }
+}
+
+static
+enum sio_modes
+link_sio_mode(
+    struct gba const *gba
+) {
+    if (gba->io.rcnt.not_sio_mode) {
+        return (gba->io.rcnt.gpio_mode ? SIO_MODE_JOYBUS : SIO_MODE_GPIO);
+    }
+
+    switch (gba->io.siocnt.mode) {
+        case 0b00:      return (SIO_MODE_NORMAL_8);
+        case 0b01:      return (SIO_MODE_NORMAL_32);
+        case 0b10:      return (SIO_MODE_MULTI);
+        default:        return (SIO_MODE_UART);
+    }
+}
+
+/*
+** Return the amount of cycles the transfer the parent is starting takes.
+*/
+static
+uint64_t
+link_transfer_duration(
+    struct gba const *gba,
+    enum sio_modes mode
+) {
+    uint64_t bits;
+
+    if (mode == SIO_MODE_MULTI) {
+        // A start bit, 16 bits of data and a stop bit for each player.
+        bits = 18 * gba->link.link->players_len;
+        return (bits * GBA_CYCLES_PER_SECOND / multi_baud_rates[gba->io.siocnt.baud_rate]);
+    }
+
+    bits = (mode == SIO_MODE_NORMAL_32) ? 32 : 8;
+    return (bits * (gba->io.siocnt.internal_shift_clock ? 8 : 64));  // 2MHz or 256KHz
+}
+
+/*
+** Schedule the end of the transfer started by the parent, if there's a new one.
+**
+** Return true if the transfer should have ended already, which happens when the quantum is too
+** long for the transfer.
+*/
+static
+bool
+link_poll(
+    struct gba *gba
+) {
+    struct link *link;
+    uint64_t seq;
+    uint64_t end;
+
+    link = gba->link.link;
+    seq = atomic_load_explicit(&link->seq, memory_order_acquire);
+    if (seq == gba->link.seq) {
+        return (false);
+    }
+
+    gba->link.seq = seq;
+    end = link->end;
+
+    // The children are busy while the parent is sending.
+    if (link->mode == SIO_MODE_MULTI) {
+        gba->io.siocnt.start = true;
+    }
+
+    if (end < gba->scheduler.cycles) {
+        logln(HS_WARNING, "Link transfer received %" PRIu64 " cycles late, the quantum is too long.", gba->scheduler.cycles - end);
+        end = gba->scheduler.cycles;
+    }
+
+    sched_add_event(gba, NEW_FIX_EVENT(SCHED_EVENT_LINK_TRANSFER_END, end));
+
+    return (end == gba->scheduler.cycles);
+}
+
+/*
+** A sync point, reached every quantum.
+*/
+void
+link_sync(
+    struct gba *gba,
+    struct event_args args __unused
+) {
+    struct link *link;
+    uint64_t now;
+    uint32_t spins;
+    size_t i;
+
+    link = gba->link.link;
+    if (!link) {
+        return ;
+    }
+
+    now = gba->scheduler.cycles;
+    atomic_store_explicit(&link->cycles[gba->link.id], now, memory_order_release);
+
+    if (link_poll(gba)) {
+        return ;
+    }
+
+    // Wait for the emulators lagging more than a quantum behind.
+    spins = 0;
+    for (i = 0; i < link->players_len; ++i) {
+        while (atomic_load_explicit(&link->cycles[i], memory_order_acquire) < now - min(now, link->quantum)) {
+
+            // The parent may be waiting for us at the end of a transfer we haven't seen yet.
+            if (link_poll(gba)) {
+                return ;
+            }
+
+            link_wait(&spins);
+        }
+    }
+
+    link_poll(gba);
+}
+
+/*
+** Start a transfer. Only called on the parent.
+*/
+static
+void
+link_transfer_start(
+    struct gba *gba,
+    enum sio_modes mode
+) {
+    struct link *link;
+
+    link = gba->link.link;
+
+    link->end = gba->scheduler.cycles + link_transfer_duration(gba, mode);
+    link->mode = mode;
+    atomic_store_explicit(&link->seq, gba->link.seq + 1, memory_order_release);
+    gba->link.seq += 1;
+
+    gba->io.siocnt.start = true;
+
+    sched_add_event(gba, NEW_FIX_EVENT(SCHED_EVENT_LINK_TRANSFER_END, link->end));
+}
+
+/*
+** The end of a transfer: wait for all the emulators to reach it and exchange their data.
+*/
+void
+link_transfer_end(
+    struct gba *gba,
+    struct event_args args __unused
+) {
+    struct link *link;
+    struct io *io;
+    uint64_t data[LINK_MAX_PLAYERS];
+    bool present[LINK_MAX_PLAYERS];
+    enum sio_modes mode;
+    uint64_t seq;
+    uint32_t spins;
+    size_t id;
+    size_t i;
+
+    link = gba->link.link;
+    if (!link) {
+        return ;
+    }
+
+    io = &gba->io;
+    id = gba->link.id;
+    seq = gba->link.seq;
+    mode = link->mode;
+
+    // Publish our data, then wait for the others.
+    switch (mode) {
+        case SIO_MODE_NORMAL_8: {
+            data[id] = io->siomlt_send.bytes[0] | ((uint64_t)(id == 0 || io->siocnt.start) << 32);
+            break;
+        };
+        case SIO_MODE_NORMAL_32: {
+            data[id] = io->siomulti[0].raw | ((uint32_t)io->siomulti[1].raw << 16) | ((uint64_t)(id == 0 || io->siocnt.start) << 32);
+            break;
+        };
+        default: {
+            data[id] = io->siomlt_send.raw | ((uint64_t)1 << 32);
+            break;
+        };
+    }
+
+    atomic_store_explicit(&link->data[seq % 2][id], data[id], memory_order_relaxed);
+    atomic_store_explicit(&link->arrived[id], seq, memory_order_release);
+    atomic_store_explicit(&link->cycles[id], gba->scheduler.cycles, memory_order_release);
+
+    spins = 0;
+    for (i = 0; i < link->players_len; ++i) {
+        while (
+               atomic_load_explicit(&link->arrived[i], memory_order_acquire) < seq
+            && atomic_load_explicit(&link->connected[i], memory_order_acquire)
+        ) {
+            link_wait(&spins);
+        }
+
+        present[i] = atomic_load_explicit(&link->arrived[i], memory_order_acquire) >= seq;
+        data[i] = present[i] ? atomic_load_explicit(&link->data[seq % 2][i], memory_order_relaxed) : 0;
+    }
+
+    for (; i < LINK_MAX_PLAYERS; ++i) {
+        present[i] = false;
+    }
+
+    logev(HS_IO, "Link transfer %" PRIu64 " ended (player %zu, mode %u)", seq, id, mode);
+
+    switch (mode) {
+        case SIO_MODE_NORMAL_8:
+        case SIO_MODE_NORMAL_32: {
+            uint32_t in;
+            bool ready;
+
+            // Only the first two emulators are connected in normal mode.
+            if (id > 1) {
+                return ;
+            }
+
+            // The child only takes part in the transfer if it was waiting for it.
+            ready = present[1] && (data[1] >> 32);
+            if (id == 1 && !ready) {
+                return ;
+            }
+
+            in = (id == 0) ? (ready ? data[1] : UINT32_MAX) : data[0];
+            if (mode == SIO_MODE_NORMAL_8) {
+                io->siomlt_send.bytes[0] = in;
+            } else {
+                io->siomulti[0].raw = in;
+                io->siomulti[1].raw = in >> 16;
+            }
+            break;
+        };
+        default: {
+            for (i = 0; i < LINK_MAX_PLAYERS; ++i) {
+                io->siomulti[i].raw = present[i] ? data[i] : 0xFFFF;
+            }
+
+            io->siocnt.multi_id = id;
+            io->siocnt.multi_error = false;
+            break;
+        };
+    }
+
+    io->siocnt.start = false;
+    if (io->siocnt.irq) {
+        io->int_flag.serial = true;
+    }
+}
+
+/*
+** Write to REG_SIOCNT.
+*/
+void
+link_siocnt_write8(
+    struct gba *gba,
+    uint32_t byte,
+    uint8_t val
+) {
+    struct link *link;
+    struct io *io;
+    enum sio_modes mode;
+    bool busy;
+
+    io = &gba->io;
+    link = gba->link.link;
+
+    // The parent can't restart a transfer before it ends, neither can a child in multi-player mode.
+    busy = link && io->siocnt.start && (gba->link.id == 0 || link_sio_mode(gba) == SIO_MODE_MULTI);
+
+    if (byte == 0 && link) {
+        uint8_t mask;
+
+        // SI (and in multi-player mode, SD, the ID and the error flag) are read-only.
+        mask = (link_sio_mode(gba) == SIO_MODE_MULTI) ? 0x7C : 0x04;
+        io->siocnt.bytes[0] = (val & ~mask) | (io->siocnt.bytes[0] & mask);
+    } else if (byte == 0) {
+        io->siocnt.bytes[0] = val;
+    } else {
+        io->siocnt.bytes[1] = val;
+    }
+
+    mode = link_sio_mode(gba);
+
+    if (link && (mode == SIO_MODE_NORMAL_8 || mode == SIO_MODE_NORMAL_32 || mode == SIO_MODE_MULTI)) {
+        if (mode == SIO_MODE_MULTI) {
+            io->siocnt.si_terminal = (gba->link.id != 0);
+            io->siocnt.sd_terminal = (link->players_len > 1);
+        }
+
+        if (busy) {
+            io->siocnt.start = true;
+            return ;
+        }
+
+        if (byte != 0 || !io->siocnt.start) {
+            return ;
+        }
+
+        // The parent starts the transfers, the children wait for them.
+        if (gba->link.id == 0 && (mode == SIO_MODE_MULTI || io->siocnt.shift_clock)) {
+            link_transfer_start(gba, mode);
+            return ;
+        } else if (gba->link.id != 0 && mode == SIO_MODE_MULTI) {
+            io->siocnt.start = false;
+            return ;
+        } else if (gba->link.id != 0 && !io->siocnt.shift_clock) {
+            return ;
+        }
+    }
+
+    /* Stub */
+    if (io->siocnt.start && io->siocnt.irq) {
+        io->int_flag.serial = true;
+    }
+    io->siocnt.start = false;
+}
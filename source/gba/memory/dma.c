@@ -15,6 +15,9 @@ static uint32_t src_mask[4]   = {0x07FFFFFF, 0x0FFFFFFF, 0x0FFFFFFF, 0x0FFFFFFF}
 static uint32_t dst_mask[4]   = {0x07FFFFFF, 0x07FFFFFF, 0x07FFFFFF, 0x0FFFFFFF};
 static uint32_t count_mask[4] = {0x3FFF,     0x3FFF,     0x3FFF,     0xFFFF};
 
+// The longest EEPROM command sent through a DMA: a write request to a 64K EEPROM.
+#define DMA_EEPROM_MAX_LEN      (2 + EEPROM_64K_ADDR_LEN + 64 + 1)
+
 void
 mem_io_dma_ctl_write8(
     struct gba *gba,
@@ -75,6 +78,152 @@ mem_io_dma_ctl_write8(
     }
 }
 
+/*
+** Return true if the given range of addresses is entirely within the EWRAM or the IWRAM.
+*/
+static inline
+bool
+dma_is_in_ram(
+    uint32_t first,
+    uint32_t last
+) {
+    return (
+           (first >> 24) == (last >> 24)
+        && ((first >> 24) == EWRAM_REGION || (first >> 24) == IWRAM_REGION)
+    );
+}
+
+/*
+** Return true if the given range of addresses is entirely within the EEPROM's window.
+*/
+static inline
+bool
+dma_is_in_eeprom(
+    struct eeprom const *eeprom,
+    uint32_t first,
+    uint32_t last
+) {
+    return ((first & eeprom->mask) == eeprom->range && (last & eeprom->mask) == eeprom->range);
+}
+
+/*
+** Return true if the given DMA transfer is a serial command sent to, or a reply read from,
+** the EEPROM, that `dma_run_eeprom_transfer()` can handle.
+*/
+static
+bool
+dma_is_eeprom_transfer(
+    struct gba const *gba,
+    struct dma_channel const *channel,
+    int32_t src_step,
+    int32_t dst_step
+) {
+    struct eeprom const *eeprom;
+    uint32_t src_last;
+    uint32_t dst_last;
+
+    if (gba->memory.backup_storage.type != BACKUP_EEPROM_4K && gba->memory.backup_storage.type != BACKUP_EEPROM_64K) {
+        return (false);
+    }
+
+    if (!channel->internal_count || channel->internal_count > DMA_EEPROM_MAX_LEN) {
+        return (false);
+    }
+
+#ifdef WITH_DEBUGGER
+    // The watchpoints and the memory trace expect each access to go through `mem_read16()` and `mem_write16()`.
+    if (gba->debugger.watchpoints.len || gba->debugger.trace.mem) {
+        return (false);
+    }
+#endif
+
+    eeprom = &gba->memory.backup_storage.chip.eeprom;
+    src_last = channel->internal_src + src_step * (int32_t)(channel->internal_count - 1);
+    dst_last = channel->internal_dst + dst_step * (int32_t)(channel->internal_count - 1);
+
+    return (
+           (dma_is_in_ram(channel->internal_src, src_last) && dma_is_in_eeprom(eeprom, channel->internal_dst, dst_last))
+        || (dma_is_in_eeprom(eeprom, channel->internal_src, src_last) && dma_is_in_ram(channel->internal_dst, dst_last))
+    );
+}
+
+/*
+** Run a 16-bit DMA transfer between the EWRAM or the IWRAM and the EEPROM.
+**
+** The cycles of each access are taken like a regular transfer, so the transfer can be
+** interrupted at the same point, but the bits are only exchanged with the EEPROM once
+** the transfer is over (or interrupted), all at once.
+** The cycles are added directly to the scheduler's counter while no event is due.
+**
+** Nothing can look at the EEPROM or the RAM while the DMA is running, so the result is the same.
+*/
+static
+void
+dma_run_eeprom_transfer(
+    struct gba *gba,
+    struct dma_channel *channel,
+    int32_t src_step,
+    int32_t dst_step
+) {
+    uint8_t bits[DMA_EEPROM_MAX_LEN];
+    enum access_types access;
+    bool to_eeprom;
+    uint32_t src;
+    uint32_t dst;
+    size_t len;
+    size_t i;
+
+    to_eeprom = dma_is_in_ram(channel->internal_src, channel->internal_src);
+    src = channel->internal_src;
+    dst = channel->internal_dst;
+    access = NON_SEQUENTIAL;
+    len = 0;
+
+    while (channel->internal_count > 0 && !gba->core.reenter_dma_transfer_loop) {
+        uint32_t src_cycles;
+        uint32_t dst_cycles;
+
+        src_cycles = mem_access_cycles(gba, channel->internal_src, sizeof(uint16_t), access);
+        dst_cycles = mem_access_cycles(gba, channel->internal_dst, sizeof(uint16_t), access);
+
+        // Skip `core_idle_for()` when no event can fire before the end of both accesses.
+        if (likely(gba->scheduler.cycles + src_cycles + dst_cycles < gba->scheduler.next_event)) {
+            gba->scheduler.cycles += src_cycles + dst_cycles;
+            gba->memory.gamepak_bus_in_use = to_eeprom;
+
+#ifdef WITH_COUNTERS
+            counter_add(&gba->counters.mem[(channel->internal_src >> 24) & 0xF][access], src_cycles);
+            counter_add(&gba->counters.mem[(channel->internal_dst >> 24) & 0xF][access], dst_cycles);
+#endif
+        } else {
+            mem_access(gba, channel->internal_src, sizeof(uint16_t), access);
+            mem_access(gba, channel->internal_dst, sizeof(uint16_t), access);
+        }
+
+        channel->internal_src += src_step;
+        channel->internal_dst += dst_step;
+        channel->internal_count -= 1;
+        access = SEQUENTIAL;
+        ++len;
+    }
+
+    if (to_eeprom) {
+        for (i = 0; i < len; ++i) {
+            channel->bus <<= 16;
+            channel->bus |= mem_read16_raw(gba, src + src_step * (int32_t)i);
+            bits[i] = channel->bus & 1;
+        }
+        mem_eeprom_write_bits(gba, bits, len);
+    } else {
+        mem_eeprom_read_bits(gba, bits, len);
+        for (i = 0; i < len; ++i) {
+            channel->bus <<= 16;
+            channel->bus |= bits[i];
+            mem_write16_raw(gba, dst + dst_step * (int32_t)i, channel->bus);
+        }
+    }
+}
+
 /*
 ** Run a single DMA transfer.
 */
@@ -109,7 +258,7 @@ dma_run_channel(
         case 0b11:      src_step = 0; break;
     }
 
-    logln(
+    logev(
         HS_DMA,
         "DMA transfer from 0x%08x%c to 0x%08x%c (len=%#08x, unit_size=%u, channel %zu)",
         channel->internal_src,
@@ -135,6 +284,8 @@ dma_run_channel(
             channel->internal_count -= 1;
             access = SEQUENTIAL;
         }
+    } else if (unlikely(dma_is_eeprom_transfer(gba, channel, src_step, dst_step))) {
+        dma_run_eeprom_transfer(gba, channel, src_step, dst_step);
     } else { // unit_size == 2
         while (channel->internal_count > 0 && !gba->core.reenter_dma_transfer_loop) {
             if (likely(channel->internal_src >= EWRAM_START)) {
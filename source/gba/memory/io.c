@@ -148,6 +148,11 @@ mem_io_reg_name(
         case IO_REG_IME:            return ("ime");
         case IO_REG_POSTFLG:        return ("postflg");
         case IO_REG_HALTCNT:        return ("haltcnt");
+        case IO_REG_SIOMULTI0:      return ("siomulti0");
+        case IO_REG_SIOMULTI1:      return ("siomulti1");
+        case IO_REG_SIOMULTI2:      return ("siomulti2");
+        case IO_REG_SIOMULTI3:      return ("siomulti3");
+        case IO_REG_SIOMLT_SEND:    return ("siomlt_send");
         case IO_REG_SIOCNT:         return ("siocnt");
         case IO_REG_RCNT:           return ("rcnt");
         default:                    return ("<unknown>");
@@ -164,7 +169,7 @@ mem_io_read8(
 ) {
     struct io const *io;
 
-    logln(HS_IO, "IO read to register %s (%#08x)", mem_io_reg_name(addr), addr);
+    logev(HS_IO, "IO read to register %s (%#08x)", mem_io_reg_name(addr), addr);
 
     io = &gba->io;
     switch (addr) {
@@ -326,6 +331,16 @@ mem_io_read8(
         case IO_REG_KEYCNT + 1:             return (io->keycnt.bytes[1]);
 
         /* Serial communication */
+        case IO_REG_SIOMULTI0:              return (io->siomulti[0].bytes[0]);
+        case IO_REG_SIOMULTI0 + 1:          return (io->siomulti[0].bytes[1]);
+        case IO_REG_SIOMULTI1:              return (io->siomulti[1].bytes[0]);
+        case IO_REG_SIOMULTI1 + 1:          return (io->siomulti[1].bytes[1]);
+        case IO_REG_SIOMULTI2:              return (io->siomulti[2].bytes[0]);
+        case IO_REG_SIOMULTI2 + 1:          return (io->siomulti[2].bytes[1]);
+        case IO_REG_SIOMULTI3:              return (io->siomulti[3].bytes[0]);
+        case IO_REG_SIOMULTI3 + 1:          return (io->siomulti[3].bytes[1]);
+        case IO_REG_SIOMLT_SEND:            return (io->siomlt_send.bytes[0]);
+        case IO_REG_SIOMLT_SEND + 1:        return (io->siomlt_send.bytes[1]);
         case IO_REG_SIOCNT:                 return (io->siocnt.bytes[0]);
         case IO_REG_SIOCNT + 1:             return (io->siocnt.bytes[1]);
         case IO_REG_RCNT:                   return (io->rcnt.bytes[0]);
@@ -370,7 +385,7 @@ mem_io_write8(
 ) {
     struct io *io;
 
-    logln(HS_IO, "IO write to register %s (%#08x) (%#02x)", mem_io_reg_name(addr), addr, val);
+    logev(HS_IO, "IO write to register %s (%#08x) (%#02x)", mem_io_reg_name(addr), addr, val);
 
     io = &gba->io;
     switch (addr) {
@@ -758,17 +773,18 @@ mem_io_write8(
         };
 
         /* Serial communication */
+        case IO_REG_SIOMULTI0:              io->siomulti[0].bytes[0] = val; break;
+        case IO_REG_SIOMULTI0 + 1:          io->siomulti[0].bytes[1] = val; break;
+        case IO_REG_SIOMULTI1:              io->siomulti[1].bytes[0] = val; break;
+        case IO_REG_SIOMULTI1 + 1:          io->siomulti[1].bytes[1] = val; break;
+        case IO_REG_SIOMULTI2:              io->siomulti[2].bytes[0] = val; break;
+        case IO_REG_SIOMULTI2 + 1:          io->siomulti[2].bytes[1] = val; break;
+        case IO_REG_SIOMULTI3:              io->siomulti[3].bytes[0] = val; break;
+        case IO_REG_SIOMULTI3 + 1:          io->siomulti[3].bytes[1] = val; break;
+        case IO_REG_SIOMLT_SEND:            io->siomlt_send.bytes[0] = val; break;
+        case IO_REG_SIOMLT_SEND + 1:        io->siomlt_send.bytes[1] = val; break;
         case IO_REG_SIOCNT:
-        case IO_REG_SIOCNT + 1: {
-            io->siocnt.bytes[addr - IO_REG_SIOCNT] = val;
-
-            /* Stub */
-            if (io->siocnt.start && io->siocnt.irq) {
-                gba->io.int_flag.serial = true;
-            }
-            io->siocnt.start = false;
-            break;
-        };
+        case IO_REG_SIOCNT + 1:             link_siocnt_write8(gba, addr - IO_REG_SIOCNT, val); break;
 
         case IO_REG_RCNT:
         case IO_REG_RCNT + 1:               io->rcnt.bytes[addr - IO_REG_RCNT] = val; break;
@@ -37,29 +37,36 @@
 **
 ** Source: GBATek
 */
-static uint32_t access_time16[2][16] = {
+static uint32_t const default_access_time16[2][16] = {
     [NON_SEQUENTIAL]    = { 1, 1, 3, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1 },
     [SEQUENTIAL]        = { 1, 1, 3, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1 },
 };
 
-static uint32_t access_time32[2][16] = {
+static uint32_t const default_access_time32[2][16] = {
     [NON_SEQUENTIAL]    = { 1, 1, 6, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1 },
     [SEQUENTIAL]        = { 1, 1, 6, 1, 1, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1 },
 };
 
-static uint32_t gamepak_nonseq_waitstates[4] = { 4, 3, 2, 8 };
+static uint32_t const gamepak_nonseq_waitstates[4] = { 4, 3, 2, 8 };
 
 /*
 ** Set the waitstates for ROM/SRAM memory according to the content of REG_WAITCNT.
 */
 void
 mem_update_waitstates(
-    struct gba const *gba
+    struct gba *gba
 ) {
     struct io const *io;
+    uint32_t (*access_time16)[16];
+    uint32_t (*access_time32)[16];
     uint32_t x;
 
     io = &gba->io;
+    access_time16 = gba->memory.access_time16;
+    access_time32 = gba->memory.access_time32;
+
+    memcpy(access_time16, default_access_time16, sizeof(default_access_time16));
+    memcpy(access_time32, default_access_time32, sizeof(default_access_time32));
 
     // 16 bit, non seq
     access_time16[NON_SEQUENTIAL][CART_0_REGION_1] = 1 + gamepak_nonseq_waitstates[io->waitcnt.ws0_nonseq];
@@ -86,6 +93,67 @@ mem_update_waitstates(
     }
 }
 
+/*
+** Align the given address on the size of the access, and return its page.
+**
+** The first access to each 128KiB block of the cartridge is always non-sequential.
+*/
+static inline
+uint32_t
+mem_access_align(
+    uint32_t *addr,
+    uint32_t size,  // In bytes
+    enum access_types *access_type
+) {
+    uint32_t page;
+
+    *addr = align_on(*addr, size);
+    page = (*addr >> 24) & 0xF;
+
+    if (unlikely(page >= CART_REGION_START && page <= CART_REGION_END && !(*addr & 0x1FFFF))) {
+        *access_type = NON_SEQUENTIAL;
+    }
+
+    return (page);
+}
+
+/*
+** Return the amount of cycles of an access to the given page, once `mem_access_align()` adjusted it.
+*/
+static inline
+uint32_t
+mem_access_lookup(
+    struct gba const *gba,
+    uint32_t page,
+    uint32_t size,  // In bytes
+    enum access_types access_type
+) {
+    if (size <= sizeof(uint16_t)) {
+        return (gba->memory.access_time16[access_type][page]);
+    } else {
+        return (gba->memory.access_time32[access_type][page]);
+    }
+}
+
+/*
+** Return the amount of cycles needed for as many bus accesses are needed to transfer a data of
+** the given size and access type, without taking them.
+**
+** The prefetch buffer is ignored.
+*/
+uint32_t
+mem_access_cycles(
+    struct gba const *gba,
+    uint32_t addr,
+    uint32_t size,  // In bytes
+    enum access_types access_type
+) {
+    uint32_t page;
+
+    page = mem_access_align(&addr, size, &access_type);
+    return (mem_access_lookup(gba, page, size, access_type));
+}
+
 /*
 ** Calculate and add to the current cycle counter the amount of cycles needed for as many bus accesses
 ** are needed to transfer a data of the given size and access type.
@@ -99,19 +167,14 @@ mem_access(
 ) {
     uint32_t cycles;
     uint32_t page;
+#ifdef WITH_COUNTERS
+    uint64_t start;
 
-    addr = align_on(addr, size);
-    page = (addr >> 24) & 0xF;
+    start = gba->scheduler.cycles;
+#endif
 
-    if (unlikely(page >= CART_REGION_START && page <= CART_REGION_END && !(addr & 0x1FFFF))) {
-        access_type = NON_SEQUENTIAL;
-    }
-
-    if (size <= sizeof(uint16_t)) {
-        cycles = access_time16[access_type][page];
-    } else {
-        cycles = access_time32[access_type][page];
-    }
+    page = mem_access_align(&addr, size, &access_type);
+    cycles = mem_access_lookup(gba, page, size, access_type);
 
     gba->memory.gamepak_bus_in_use = (page >= CART_REGION_START && page <= CART_REGION_END);
     if (gba->memory.gamepak_bus_in_use && gba->memory.pbuffer.enabled && !gba->core.is_dma_running) {
@@ -119,6 +182,10 @@ mem_access(
     } else {
         core_idle_for(gba, cycles);
     }
+
+#ifdef WITH_COUNTERS
+    counter_add(&gba->counters.mem[page][access_type], gba->scheduler.cycles - start);
+#endif
 }
 
 void
@@ -132,6 +199,10 @@ mem_prefetch_buffer_access(
     pbuffer = &gba->memory.pbuffer;
 
     if (pbuffer->tail == addr) {
+#ifdef WITH_COUNTERS
+        ++gba->counters.prefetch_hits;
+#endif
+
         if (pbuffer->size == 0) { // Finish to fetch if it isn't done yet
             gba->memory.gamepak_bus_in_use = false;
             core_idle_for(gba, pbuffer->countdown);
@@ -146,17 +217,21 @@ mem_prefetch_buffer_access(
             core_idle(gba);
         }
     } else {
+#ifdef WITH_COUNTERS
+        ++gba->counters.prefetch_misses;
+#endif
+
         // Do it first or it'll screw our pbuffer settings
         core_idle_for(gba, intended_cycles);
 
         if (gba->core.cpsr.thumb) {
             pbuffer->insn_len = sizeof(uint16_t);
             pbuffer->capacity = 8;
-            pbuffer->reload = access_time16[SEQUENTIAL][(addr >> 24) & 0xF];
+            pbuffer->reload = gba->memory.access_time16[SEQUENTIAL][(addr >> 24) & 0xF];
         } else {
             pbuffer->insn_len = sizeof(uint32_t);
             pbuffer->capacity = 4;
-            pbuffer->reload = access_time32[SEQUENTIAL][(addr >> 24) & 0xF];
+            pbuffer->reload = gba->memory.access_time32[SEQUENTIAL][(addr >> 24) & 0xF];
         }
 
         pbuffer->countdown = pbuffer->reload;
@@ -278,7 +353,7 @@ mem_openbus_read(
                     }                                                                       \
                     _ret = (gba)->memory.bios_bus >> _shift;                                \
                 } else {                                                                    \
-                    logln(HS_MEMORY, "Invalid BIOS read of size %zu from 0x%08x", sizeof(T), _addr); \
+                    logev(HS_MEMORY, "Invalid BIOS read of size %zu from 0x%08x", sizeof(T), _addr); \
                     _ret = mem_openbus_read((gba), _addr);                                  \
                 }                                                                           \
                 break;                                                                      \
@@ -351,7 +426,7 @@ mem_openbus_read(
                 break;                                                                      \
             };                                                                              \
             default: {                                                                      \
-                logln(HS_MEMORY, "Invalid read of size %zu from 0x%08x", sizeof(T), _addr); \
+                logev(HS_MEMORY, "Invalid read of size %zu from 0x%08x", sizeof(T), _addr); \
                 _ret = mem_openbus_read((gba), _addr);                                      \
                 break;                                                                      \
             }                                                                               \
@@ -485,7 +560,7 @@ mem_openbus_read(
                 );                                                                              \
                 break;                                                                          \
             default: {                                                                          \
-                logln(HS_MEMORY, "Invalid write of size %zu to 0x%08x", sizeof(T), _addr);      \
+                logev(HS_MEMORY, "Invalid write of size %zu to 0x%08x", sizeof(T), _addr);      \
                 break;                                                                          \
             };                                                                                  \
         };                                                                                      \
@@ -508,12 +583,24 @@ mem_read8(
     uint32_t addr,
     enum access_types access_type
 ) {
+    uint8_t value;
+
 #ifdef WITH_DEBUGGER
-    debugger_eval_read_watchpoints(gba, addr, sizeof(uint8_t));
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.read_pages, addr, sizeof(uint8_t)))) {
+        debugger_eval_read_watchpoints(gba, addr, sizeof(uint8_t));
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint8_t), access_type);
-    return (template_read(uint8_t, gba, addr));
+    value = template_read(uint8_t, gba, addr);
+
+#ifdef WITH_DEBUGGER
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint8_t), value, false);
+    }
+#endif
+
+    return (value);
 }
 
 uint16_t
@@ -533,12 +620,24 @@ mem_read16(
     uint32_t addr,
     enum access_types access_type
 ) {
+    uint16_t value;
+
 #ifdef WITH_DEBUGGER
-    debugger_eval_read_watchpoints(gba, addr, sizeof(uint16_t));
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.read_pages, addr, sizeof(uint16_t)))) {
+        debugger_eval_read_watchpoints(gba, addr, sizeof(uint16_t));
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint16_t), access_type);
-    return (template_read(uint16_t, gba, addr));
+    value = template_read(uint16_t, gba, addr);
+
+#ifdef WITH_DEBUGGER
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint16_t), value, false);
+    }
+#endif
+
+    return (value);
 }
 
 /*
@@ -555,7 +654,9 @@ mem_read16_ror(
     uint32_t value;
 
 #ifdef WITH_DEBUGGER
-    debugger_eval_read_watchpoints(gba, addr, sizeof(uint16_t));
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.read_pages, addr, sizeof(uint16_t)))) {
+        debugger_eval_read_watchpoints(gba, addr, sizeof(uint16_t));
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint16_t), access_type);
@@ -563,6 +664,12 @@ mem_read16_ror(
     rotate = (addr & 0b1) * 8;
     value = template_read(uint16_t, gba, addr);
 
+#ifdef WITH_DEBUGGER
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint16_t), value, false);
+    }
+#endif
+
     /* Unaligned 16-bits loads are supposed to be unpredictable, but in practise the GBA rotates them */
     return (ror32(value, rotate));
 }
@@ -584,12 +691,24 @@ mem_read32(
     uint32_t addr,
     enum access_types access_type
 ) {
+    uint32_t value;
+
 #ifdef WITH_DEBUGGER
-    debugger_eval_read_watchpoints(gba, addr, sizeof(uint32_t));
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.read_pages, addr, sizeof(uint32_t)))) {
+        debugger_eval_read_watchpoints(gba, addr, sizeof(uint32_t));
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint32_t), access_type);
-    return (template_read(uint32_t, gba, addr));
+    value = template_read(uint32_t, gba, addr);
+
+#ifdef WITH_DEBUGGER
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint32_t), value, false);
+    }
+#endif
+
+    return (value);
 }
 
 /*
@@ -606,7 +725,9 @@ mem_read32_ror(
     uint32_t value;
 
 #ifdef WITH_DEBUGGER
-    debugger_eval_read_watchpoints(gba, addr, sizeof(uint32_t));
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.read_pages, addr, sizeof(uint32_t)))) {
+        debugger_eval_read_watchpoints(gba, addr, sizeof(uint32_t));
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint32_t), access_type);
@@ -614,9 +735,45 @@ mem_read32_ror(
     rotate = (addr % 4) << 3;
     value = template_read(uint32_t, gba, addr);
 
+#ifdef WITH_DEBUGGER
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint32_t), value, false);
+    }
+#endif
+
     return (ror32(value, rotate));
 }
 
+/*
+** Fetch the half-word at the given address for the CPU's pipeline.
+**
+** Unlike `mem_read16()`, instruction fetches never trigger a watchpoint.
+*/
+uint16_t
+mem_fetch16(
+    struct gba *gba,
+    uint32_t addr,
+    enum access_types access_type
+) {
+    mem_access(gba, addr, sizeof(uint16_t), access_type);
+    return (template_read(uint16_t, gba, addr));
+}
+
+/*
+** Fetch the word at the given address for the CPU's pipeline.
+**
+** Unlike `mem_read32()`, instruction fetches never trigger a watchpoint.
+*/
+uint32_t
+mem_fetch32(
+    struct gba *gba,
+    uint32_t addr,
+    enum access_types access_type
+) {
+    mem_access(gba, addr, sizeof(uint32_t), access_type);
+    return (template_read(uint32_t, gba, addr));
+}
+
 void
 mem_write8_raw(
     struct gba *gba,
@@ -637,7 +794,13 @@ mem_write8(
     enum access_types access_type
 ) {
 #ifdef WITH_DEBUGGER
-    debugger_eval_write_watchpoints(gba, addr, sizeof(uint8_t), val);
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.write_pages, addr, sizeof(uint8_t)))) {
+        debugger_eval_write_watchpoints(gba, addr, sizeof(uint8_t), val);
+    }
+
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint8_t), val, true);
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint8_t), access_type);
@@ -665,7 +828,13 @@ mem_write16(
     enum access_types access_type
 ) {
 #ifdef WITH_DEBUGGER
-    debugger_eval_write_watchpoints(gba, addr, sizeof(uint16_t), val);
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.write_pages, addr, sizeof(uint16_t)))) {
+        debugger_eval_write_watchpoints(gba, addr, sizeof(uint16_t), val);
+    }
+
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint16_t), val, true);
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint16_t), access_type);
@@ -692,7 +861,13 @@ mem_write32(
     enum access_types access_type
 ) {
 #ifdef WITH_DEBUGGER
-    debugger_eval_write_watchpoints(gba, addr, sizeof(uint32_t), val);
+    if (unlikely(gba->debugger.watchpoints.len && debugger_is_page_watched(gba->debugger.watchpoints.write_pages, addr, sizeof(uint32_t)))) {
+        debugger_eval_write_watchpoints(gba, addr, sizeof(uint32_t), val);
+    }
+
+    if (unlikely(gba->debugger.trace.mem)) {
+        debugger_trace_mem(gba, addr, sizeof(uint32_t), val, true);
+    }
 #endif
 
     mem_access(gba, addr, sizeof(uint32_t), access_type);
@@ -7,6 +7,7 @@
 **
 \******************************************************************************/
 
+#include <string.h>
 #include "hades.h"
 #include "gba/gba.h"
 
@@ -124,7 +125,7 @@ mem_eeprom_write8(
                 for (i = 0; i < 8; ++i) {
                     gba->shared_data.backup_storage.data[eeprom->transfer_address + i] = (eeprom->transfer_data >> (56 - 8 * i)) & 0xFF;
                 }
-                gba->shared_data.backup_storage.dirty = true;
+                mem_backup_storage_mark_dirty(gba, eeprom->transfer_address, 8);
 
                 eeprom->state = EEPROM_STATE_END;
             }
@@ -138,3 +139,119 @@ mem_eeprom_write8(
         }
     }
 }
+
+/*
+** Feed the given bits to the EEPROM, as if they were written one after the other.
+**
+** Games send their commands through DMA transfers, one bit per half-word. When the bits
+** are a whole command (a read request, or a write request with its 64 bits of data) they
+** are decoded all at once, otherwise they go through the state machine one by one.
+*/
+void
+mem_eeprom_write_bits(
+    struct gba *gba,
+    uint8_t const *bits,
+    size_t len
+) {
+    struct eeprom *eeprom;
+    enum eeprom_cmds cmd;
+    uint32_t address;
+    uint64_t data;
+    size_t expected_len;
+    size_t i;
+
+    eeprom = &gba->memory.backup_storage.chip.eeprom;
+
+    if (eeprom->state != EEPROM_STATE_READY || len < 2 || !bits[0]) {
+        goto slow;
+    }
+
+    // Start bit, command, address, data (for writes only) and the stop bit.
+    cmd = bits[1] ? EEPROM_CMD_READ : EEPROM_CMD_WRITE;
+    expected_len = 2 + eeprom->address_len + (cmd == EEPROM_CMD_WRITE ? 64 : 0) + 1;
+    if (len != expected_len) {
+        goto slow;
+    }
+
+    bits += 2;
+
+    address = 0;
+    for (i = 0; i < eeprom->address_len; ++i) {
+        address = (address << 1) | bits[i];
+    }
+    bits += eeprom->address_len;
+
+    eeprom->cmd = cmd;
+    eeprom->transfer_address = (address * 8) & eeprom->address_mask;
+    eeprom->transfer_len = 0;
+
+    if (cmd == EEPROM_CMD_READ) {
+        data = 0;
+        for (i = 0; i < 8; ++i) {
+            data = (data << 8) | gba->shared_data.backup_storage.data[eeprom->transfer_address + i];
+        }
+
+        // The stop bit is ignored while the junk bits are pending.
+        eeprom->transfer_data = data;
+        eeprom->state = EEPROM_STATE_TRANSFER_JUNK;
+    } else {
+        data = 0;
+        for (i = 0; i < 64; ++i) {
+            data = (data << 1) | bits[i];
+        }
+        bits += 64;
+
+        for (i = 0; i < 8; ++i) {
+            gba->shared_data.backup_storage.data[eeprom->transfer_address + i] = (data >> (56 - 8 * i)) & 0xFF;
+        }
+        mem_backup_storage_mark_dirty(gba, eeprom->transfer_address, 8);
+
+        eeprom->transfer_data = data;
+        eeprom->state = bits[0] ? EEPROM_STATE_END : EEPROM_STATE_READY;
+    }
+    return ;
+
+slow:
+    for (i = 0; i < len; ++i) {
+        mem_eeprom_write8(gba, bits[i]);
+    }
+}
+
+/*
+** Read the given amount of bits from the EEPROM, as if they were read one after the other.
+**
+** Like `mem_eeprom_write_bits()`, the 4 junk bits and the 64 bits of data of a read request
+** are sent all at once when they are all read together.
+*/
+void
+mem_eeprom_read_bits(
+    struct gba *gba,
+    uint8_t *bits,
+    size_t len
+) {
+    struct eeprom *eeprom;
+    size_t i;
+
+    eeprom = &gba->memory.backup_storage.chip.eeprom;
+
+    if (
+           eeprom->cmd == EEPROM_CMD_READ
+        && eeprom->state == EEPROM_STATE_TRANSFER_JUNK
+        && eeprom->transfer_len == 0
+        && len == 4 + 64
+    ) {
+        memset(bits, 0, 4);
+        for (i = 0; i < 64; ++i) {
+            bits[4 + i] = (eeprom->transfer_data >> (63 - i)) & 1;
+        }
+
+        eeprom->transfer_data = 0;
+        eeprom->transfer_len = 0;
+        eeprom->state = EEPROM_STATE_READY;
+        return ;
+    }
+
+    for (i = 0; i < len; ++i) {
+        bits[i] = mem_eeprom_read8(gba);
+    }
+}
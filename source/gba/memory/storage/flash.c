@@ -56,7 +56,7 @@ mem_flash_write8(
             case FLASH_CMD_ERASE_CHIP: {
                 if (flash->state == FLASH_STATE_ERASE) {
                     memset(gba->shared_data.backup_storage.data, 0xFF, gba->shared_data.backup_storage.size);
-                    gba->shared_data.backup_storage.dirty = true;
+                    mem_backup_storage_mark_dirty(gba, 0, gba->shared_data.backup_storage.size);
                 }
                 break;
             };
@@ -73,11 +73,11 @@ mem_flash_write8(
 
         addr &= 0xF000;
         memset(gba->shared_data.backup_storage.data + addr + flash->bank * FLASH64_SIZE, 0xFF, 0x1000);
-        gba->shared_data.backup_storage.dirty = true;
+        mem_backup_storage_mark_dirty(gba, addr + flash->bank * FLASH64_SIZE, 0x1000);
         flash->state = FLASH_STATE_READY;
     } else if (flash->state == FLASH_STATE_WRITE) {
         gba->shared_data.backup_storage.data[addr + flash->bank * FLASH64_SIZE] = val;
-        gba->shared_data.backup_storage.dirty = true;
+        mem_backup_storage_mark_dirty(gba, addr + flash->bank * FLASH64_SIZE, 1);
         flash->state = FLASH_STATE_READY;
     } else if (flash->state == FLASH_STATE_BANK && addr == 0x0) {
         flash->bank = val;
@@ -49,9 +49,30 @@ mem_backup_storage_write8(
             break;
         case BACKUP_SRAM:
             gba->shared_data.backup_storage.data[addr & SRAM_MASK] = val;
-            gba->shared_data.backup_storage.dirty = true;
+            mem_backup_storage_mark_dirty(gba, addr & SRAM_MASK, 1);
             break;
         default:
             break;
     }
 }
+
+/*
+** Mark the blocks of the backup storage covering the given range as modified.
+**
+** Must be called after the data is written.
+*/
+void
+mem_backup_storage_mark_dirty(
+    struct gba *gba,
+    size_t offset,
+    size_t len
+) {
+    size_t block;
+    size_t last;
+
+    block = offset / BACKUP_STORAGE_BLOCK_SIZE;
+    last = (offset + len - 1) / BACKUP_STORAGE_BLOCK_SIZE;
+    for (; block <= last; ++block) {
+        atomic_fetch_or(&gba->shared_data.backup_storage.dirty[block / 64], UINT64_C(1) << (block % 64));
+    }
+}
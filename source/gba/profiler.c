@@ -0,0 +1,417 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#ifdef WITH_PROFILER
+
+#include <inttypes.h>
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "gba/profiler.h"
+
+static inline
+uint32_t
+profiler_node_hash(
+    uint32_t parent,
+    uint32_t addr,
+    uint32_t bits
+) {
+    return (hs_fibonacci_hash(addr ^ (parent * 0x85EBCA6Bu), bits));
+}
+
+static
+void
+profiler_nodes_rehash(
+    struct profiler *profiler,
+    uint32_t bits
+) {
+    uint32_t mask;
+    size_t i;
+
+    free(profiler->nodes.slots);
+    profiler->nodes.slots = malloc(sizeof(uint32_t) << bits);
+    hs_assert(profiler->nodes.slots);
+    memset(profiler->nodes.slots, 0xFF, sizeof(uint32_t) << bits);
+    profiler->nodes.slots_bits = bits;
+
+    mask = (1u << bits) - 1;
+    for (i = 0; i < profiler->nodes.len; ++i) {
+        uint32_t slot;
+
+        slot = profiler_node_hash(profiler->nodes.list[i].parent, profiler->nodes.list[i].addr, bits);
+        while (profiler->nodes.slots[slot] != PROFILER_SLOT_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+        profiler->nodes.slots[slot] = i;
+    }
+}
+
+/*
+** Return the index of the node of the function at `addr` called from `parent`, creating it
+** if it doesn't exist yet.
+*/
+static
+uint32_t
+profiler_node_get(
+    struct profiler *profiler,
+    uint32_t parent,
+    uint32_t addr
+) {
+    struct profiler_node *node;
+    uint32_t mask;
+    uint32_t slot;
+
+    mask = (1u << profiler->nodes.slots_bits) - 1;
+    slot = profiler_node_hash(parent, addr, profiler->nodes.slots_bits);
+    while (profiler->nodes.slots[slot] != PROFILER_SLOT_EMPTY) {
+        node = profiler->nodes.list + profiler->nodes.slots[slot];
+        if (node->parent == parent && node->addr == addr) {
+            return (profiler->nodes.slots[slot]);
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    if (profiler->nodes.len == profiler->nodes.size) {
+        profiler->nodes.size *= 2;
+        profiler->nodes.list = realloc(profiler->nodes.list, sizeof(struct profiler_node) * profiler->nodes.size);
+        hs_assert(profiler->nodes.list);
+    }
+
+    node = profiler->nodes.list + profiler->nodes.len;
+    node->parent = parent;
+    node->addr = addr;
+    node->samples = 0;
+    profiler->nodes.slots[slot] = profiler->nodes.len;
+    ++profiler->nodes.len;
+
+    if (profiler->nodes.len * 2 > ((size_t)1 << profiler->nodes.slots_bits)) {
+        profiler_nodes_rehash(profiler, profiler->nodes.slots_bits + 1);
+    }
+
+    return (profiler->nodes.len - 1);
+}
+
+static
+void
+profiler_histogram_rehash(
+    struct profiler *profiler,
+    uint32_t bits
+) {
+    uint32_t *old_addrs;
+    uint64_t *old_samples;
+    uint32_t old_bits;
+    uint32_t mask;
+    size_t i;
+
+    old_addrs = profiler->histogram.addrs;
+    old_samples = profiler->histogram.samples;
+    old_bits = profiler->histogram.bits;
+
+    profiler->histogram.addrs = malloc(sizeof(uint32_t) << bits);
+    profiler->histogram.samples = malloc(sizeof(uint64_t) << bits);
+    hs_assert(profiler->histogram.addrs);
+    hs_assert(profiler->histogram.samples);
+    memset(profiler->histogram.addrs, 0xFF, sizeof(uint32_t) << bits);
+    profiler->histogram.bits = bits;
+
+    if (!old_addrs) {
+        return ;
+    }
+
+    mask = (1u << bits) - 1;
+    for (i = 0; i < ((size_t)1 << old_bits); ++i) {
+        uint32_t slot;
+
+        if (old_addrs[i] == PROFILER_SLOT_EMPTY) {
+            continue;
+        }
+
+        slot = hs_fibonacci_hash(old_addrs[i], bits);
+        while (profiler->histogram.addrs[slot] != PROFILER_SLOT_EMPTY) {
+            slot = (slot + 1) & mask;
+        }
+        profiler->histogram.addrs[slot] = old_addrs[i];
+        profiler->histogram.samples[slot] = old_samples[i];
+    }
+
+    free(old_addrs);
+    free(old_samples);
+}
+
+void
+profiler_cleanup(
+    struct gba *gba
+) {
+    struct profiler *profiler;
+
+    profiler = &gba->profiler;
+    free(profiler->nodes.list);
+    free(profiler->nodes.slots);
+    free(profiler->histogram.addrs);
+    free(profiler->histogram.samples);
+    memset(profiler, 0, sizeof(*profiler));
+}
+
+/*
+** Discard all the samples and start profiling every `period` cycles, or disable the profiler
+** if `period` is 0.
+**
+** Must be called after the scheduler was reset.
+*/
+void
+profiler_reset(
+    struct gba *gba,
+    uint64_t period
+) {
+    struct profiler *profiler;
+
+    profiler_cleanup(gba);
+
+    if (!period) {
+        return ;
+    }
+
+    profiler = &gba->profiler;
+    profiler->period = period;
+
+    profiler->nodes.size = 256;
+    profiler->nodes.list = malloc(sizeof(struct profiler_node) * profiler->nodes.size);
+    hs_assert(profiler->nodes.list);
+
+    // The root of the call tree
+    profiler->nodes.len = 1;
+    profiler->nodes.list[0].parent = 0;
+    profiler->nodes.list[0].addr = 0;
+    profiler->nodes.list[0].samples = 0;
+    profiler_nodes_rehash(profiler, 9);
+
+    profiler_histogram_rehash(profiler, 12);
+
+    profiler_resume(gba);
+}
+
+/*
+** Resume the sampling after the state of the emulator was replaced (eg. by a quickload).
+**
+** The samples are kept, but the shadow call stack doesn't match the game's anymore and
+** is emptied.
+*/
+void
+profiler_resume(
+    struct gba *gba
+) {
+    struct profiler *profiler;
+
+    profiler = &gba->profiler;
+    profiler->stack.len = 0;
+
+    if (!profiler->period) {
+        return ;
+    }
+
+    sched_add_event(
+        gba,
+        NEW_REPEAT_EVENT(
+            SCHED_EVENT_PROFILER_SAMPLE,
+            gba->scheduler.cycles + profiler->period,   // Timing of first trigger
+            profiler->period                            // Period
+        )
+    );
+}
+
+void
+profiler_sample(
+    struct gba *gba,
+    struct event_args args __unused
+) {
+    struct profiler *profiler;
+    uint32_t mask;
+    uint32_t slot;
+    uint32_t node;
+    uint32_t pc;
+
+    profiler = &gba->profiler;
+    pc = profiler->pc;
+
+    node = profiler->stack.len ? profiler->stack.list[profiler->stack.len - 1].node : 0;
+    ++profiler->nodes.list[node].samples;
+    ++profiler->total;
+
+    mask = (1u << profiler->histogram.bits) - 1;
+    slot = hs_fibonacci_hash(pc, profiler->histogram.bits);
+    while (profiler->histogram.addrs[slot] != PROFILER_SLOT_EMPTY) {
+        if (profiler->histogram.addrs[slot] == pc) {
+            ++profiler->histogram.samples[slot];
+            return ;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    profiler->histogram.addrs[slot] = pc;
+    profiler->histogram.samples[slot] = 1;
+    ++profiler->histogram.len;
+
+    if (profiler->histogram.len * 2 > ((size_t)1 << profiler->histogram.bits)) {
+        profiler_histogram_rehash(profiler, profiler->histogram.bits + 1);
+    }
+}
+
+/*
+** Push a frame for a call to the function at `addr` that should return to `ret`.
+**
+** When the stack is full, the call is ignored and its samples are given to the caller.
+*/
+void
+profiler_call(
+    struct gba *gba,
+    uint32_t addr,
+    uint32_t ret
+) {
+    struct profiler *profiler;
+    struct profiler_frame *frame;
+    uint32_t parent;
+
+    profiler = &gba->profiler;
+
+    if (!profiler->period || profiler->stack.len >= PROFILER_STACK_LEN) {
+        return ;
+    }
+
+    parent = profiler->stack.len ? profiler->stack.list[profiler->stack.len - 1].node : 0;
+
+    frame = profiler->stack.list + profiler->stack.len;
+    frame->node = profiler_node_get(profiler, parent, addr);
+    frame->ret = ret;
+    ++profiler->stack.len;
+}
+
+/*
+** Called each time the PC is reloaded: pop the frames up to the one returning to `addr`, if any.
+**
+** All the frames are searched and not only the top one, so the stack recovers from the
+** functions that don't return to their caller (eg. `longjmp()`).
+*/
+void
+profiler_return(
+    struct gba *gba,
+    uint32_t addr
+) {
+    struct profiler *profiler;
+    size_t i;
+
+    profiler = &gba->profiler;
+
+    i = profiler->stack.len;
+    while (i) {
+        --i;
+        if (profiler->stack.list[i].ret == addr) {
+            profiler->stack.len = i;
+            return ;
+        }
+    }
+}
+
+/*
+** Write the samples as folded stacks, one line per path of the call tree followed by the
+** number of cycles spent in it, ready to be turned into a flame graph.
+*/
+void
+profiler_write_folded(
+    struct gba const *gba,
+    FILE *file
+) {
+    struct profiler const *profiler;
+    size_t i;
+
+    profiler = &gba->profiler;
+    for (i = 0; i < profiler->nodes.len; ++i) {
+        uint32_t path[PROFILER_STACK_LEN];
+        size_t depth;
+        uint32_t node;
+
+        if (!profiler->nodes.list[i].samples) {
+            continue;
+        }
+
+        depth = 0;
+        for (node = i; node; node = profiler->nodes.list[node].parent) {
+            path[depth++] = profiler->nodes.list[node].addr;
+        }
+
+        fprintf(file, "gba");
+        while (depth) {
+            fprintf(file, ";0x%08x", path[--depth]);
+        }
+        fprintf(file, " %" PRIu64 "\n", profiler->nodes.list[i].samples * profiler->period);
+    }
+}
+
+static
+int
+profiler_histogram_cmp(
+    void const *a,
+    void const *b
+) {
+    uint64_t samples_a;
+    uint64_t samples_b;
+
+    samples_a = ((uint64_t const *)a)[1];
+    samples_b = ((uint64_t const *)b)[1];
+    if (samples_a != samples_b) {
+        return ((samples_a < samples_b) - (samples_a > samples_b));
+    }
+    return ((((uint64_t const *)a)[0] > ((uint64_t const *)b)[0]) - (((uint64_t const *)a)[0] < ((uint64_t const *)b)[0]));
+}
+
+/*
+** Write the number of cycles spent at each sampled address, from the hottest to the coldest.
+*/
+void
+profiler_write_histogram(
+    struct gba const *gba,
+    FILE *file
+) {
+    struct profiler const *profiler;
+    uint64_t (*entries)[2];
+    size_t len;
+    size_t i;
+
+    profiler = &gba->profiler;
+    if (!profiler->total) {
+        return ;
+    }
+
+    entries = malloc(sizeof(*entries) * profiler->histogram.len);
+    hs_assert(entries);
+
+    len = 0;
+    for (i = 0; i < ((size_t)1 << profiler->histogram.bits); ++i) {
+        if (profiler->histogram.addrs[i] != PROFILER_SLOT_EMPTY) {
+            entries[len][0] = profiler->histogram.addrs[i];
+            entries[len][1] = profiler->histogram.samples[i];
+            ++len;
+        }
+    }
+
+    qsort(entries, len, sizeof(*entries), profiler_histogram_cmp);
+
+    for (i = 0; i < len; ++i) {
+        fprintf(
+            file,
+            "0x%08" PRIx64 " %" PRIu64 " %6.2f%%\n",
+            entries[i][0],
+            entries[i][1] * profiler->period,
+            100.0 * entries[i][1] / profiler->total
+        );
+    }
+
+    free(entries);
+}
+
+#endif /* WITH_PROFILER */
@@ -152,7 +152,16 @@ quickload(
         ) {
             return (true);
         }
+
+        // The profiler isn't part of the game's state, it resumes its own sampling below.
+        if (event->kind == SCHED_EVENT_PROFILER_SAMPLE) {
+            event->active = false;
+        }
     }
 
+#ifdef WITH_PROFILER
+    profiler_resume(gba);
+#endif
+
     return (false);
 }
@@ -26,6 +26,11 @@ void (*sched_event_callbacks[])(struct gba *gba, struct event_args args) = {
     [SCHED_EVENT_APU_WAVE_STEP] = apu_wave_step,
     [SCHED_EVENT_APU_NOISE_STEP] = apu_noise_step,
     [SCHED_EVENT_DMA_ADD_PENDING] = mem_dma_add_to_pending,
+#ifdef WITH_PROFILER
+    [SCHED_EVENT_PROFILER_SAMPLE] = profiler_sample,
+#endif
+    [SCHED_EVENT_LINK_SYNC] = link_sync,
+    [SCHED_EVENT_LINK_TRANSFER_END] = link_transfer_end,
 };
 
 void
@@ -82,7 +87,25 @@ sched_process_events(
             event->active = false;
         }
 
+#ifdef WITH_COUNTERS
+        {
+            struct sched_counter *counter;
+            uint64_t start;
+
+            counter = &gba->counters.events[event->kind];
+            ++counter->fired;
+            counter->lateness += delay;
+            counter->lateness_max = max(counter->lateness_max, delay);
+
+            // `event` may be moved by the callback if it adds new events.
+            start = hs_time_ns();
+            sched_event_callbacks[event->kind](gba, event->args);
+            counter->time_ns += hs_time_ns() - start;
+        }
+#else
         sched_event_callbacks[event->kind](gba, event->args);
+#endif
+
         scheduler->cycles += delay;
     }
 }
@@ -99,6 +122,10 @@ sched_add_event(
 
     hs_assert(!event.repeat || event.period);
 
+#ifdef WITH_COUNTERS
+    ++gba->counters.events[event.kind].added;
+#endif
+
     // Try and reuse an inactive event
     for (i = 0; i < scheduler->events_size; ++i) {
         if (!scheduler->events[i].active) {
@@ -135,15 +162,27 @@ sched_cancel_event(
 
     if (scheduler->events[handler].active) {
         scheduler->events[handler].active = false;
+
+#ifdef WITH_COUNTERS
+        ++gba->counters.events[scheduler->events[handler].kind].cancelled;
+#endif
     }
 
     // TODO: update `scheduler->next_event`? Is it worth it?
 }
 
+/*
+** Run the emulator until `cycles` cycles have elapsed.
+**
+** If `interruptible` is true, the loop is also left as soon as the frontend pushes a
+** new message, as long as at least one instruction was executed.
+*/
+static inline
 void
-sched_run_for(
+sched_run(
     struct gba *gba,
-    uint64_t cycles
+    uint64_t cycles,
+    bool interruptible
 ) {
     struct scheduler *scheduler;
     uint64_t target;
@@ -171,45 +210,268 @@ sched_run_for(
             }
             break;
         }
+
+        if (interruptible && unlikely(channel_pending(&gba->channels.messages))) {
+            break;
+        }
     }
 }
 
+void
+sched_run_for(
+    struct gba *gba,
+    uint64_t cycles
+) {
+    sched_run(gba, cycles, false);
+}
+
+/*
+** Run the emulator for an adaptive amount of cycles.
+**
+** The slice starts short (a scanline) after the frontend interacted with the emulator and
+** doubles every time it completes, up to a whole frame, so that the message channel is
+** checked as rarely as possible when nothing happens.
+**
+** Any new message interrupts the slice early.
+*/
+void
+sched_run_slice(
+    struct gba *gba
+) {
+    struct scheduler *scheduler;
+
+    scheduler = &gba->scheduler;
+    sched_run(gba, scheduler->slice, true);
+    scheduler->slice = min(scheduler->slice * 2, SCHED_SLICE_MAX);
+}
+
+/*
+** Shrink the next slice back to its minimum length.
+**
+** Called every time the frontend sends messages to the emulator.
+*/
+void
+sched_reset_slice(
+    struct gba *gba
+) {
+    gba->scheduler.slice = SCHED_SLICE_MIN;
+}
+
 void
 sched_reset_frame_limiter(
     struct gba *gba
 ) {
-    gba->scheduler.accumulated_time = 0;
-    gba->scheduler.time_last_frame = hs_time();
+    uint64_t now;
+
+    now = hs_time_ns();
+    gba->scheduler.next_frame_deadline = now;
+    gba->scheduler.time_last_frame = now;
+}
+
+static
+int
+sched_frame_time_cmp(
+    void const *a,
+    void const *b
+) {
+    return ((int)(*(uint32_t const *)a > *(uint32_t const *)b) - (int)(*(uint32_t const *)a < *(uint32_t const *)b));
 }
 
+/*
+** Publish the health metrics computed over the last recorded frames to `shared_data.stats`.
+**
+** Called by the frame limiter every `SCHED_FRAME_TIMES_LEN` frames, but can also be called
+** by a frontend running the emulation in its own thread to get up-to-date metrics.
+*/
+void
+sched_publish_stats(
+    struct gba *gba
+) {
+    struct scheduler *scheduler;
+    struct emulation_stats *stats;
+    uint32_t sorted[SCHED_FRAME_TIMES_LEN];
+    uint64_t total;
+    uint64_t busy;
+    size_t len;
+    size_t i;
+
+    scheduler = &gba->scheduler;
+    stats = &gba->shared_data.stats;
+    len = scheduler->frame_times_len;
+
+    if (!len) {
+        return ;
+    }
+
+    total = 0;
+    busy = 0;
+    for (i = 0; i < len; ++i) {
+        total += scheduler->frame_times[i];
+        busy += scheduler->busy_times[i];
+    }
+
+    memcpy(sorted, scheduler->frame_times, len * sizeof(sorted[0]));
+    qsort(sorted, len, sizeof(sorted[0]), sched_frame_time_cmp);
+
+    atomic_store_explicit(&stats->frame_time_mean, total / len, memory_order_relaxed);
+    atomic_store_explicit(&stats->frame_time_p50, sorted[len / 2], memory_order_relaxed);
+    atomic_store_explicit(&stats->frame_time_p99, sorted[len * 99 / 100], memory_order_relaxed);
+    atomic_store_explicit(&stats->frame_time_max, sorted[len - 1], memory_order_relaxed);
+    atomic_store_explicit(&stats->busy_time_mean, busy / len, memory_order_relaxed);
+
+    // A real GBA takes GBA_CYCLES_PER_FRAME / GBA_CYCLES_PER_SECOND seconds per frame.
+    atomic_store_explicit(
+        &stats->speed,
+        total ? len * GBA_CYCLES_PER_FRAME * UINT64_C(100000000) / (GBA_CYCLES_PER_SECOND * total) : 0,
+        memory_order_relaxed
+    );
+
+    gba_shared_audio_rbuffer_lock(gba);
+    atomic_store_explicit(&stats->audio_fill, gba->shared_data.audio_rbuffer.size * 100 / APU_RBUFFER_CAPACITY, memory_order_relaxed);
+    atomic_store_explicit(&stats->audio_underruns, gba->shared_data.audio_rbuffer.underruns, memory_order_relaxed);
+    atomic_store_explicit(&stats->audio_overruns, gba->shared_data.audio_rbuffer.overruns, memory_order_relaxed);
+    gba_shared_audio_rbuffer_release(gba);
+}
+
+/*
+** Record the time the last frame took, and the part of it spent emulating (until `busy_end`).
+** Every `SCHED_FRAME_TIMES_LEN` frames, publish the health metrics to the frontend.
+*/
+static
+void
+sched_record_frame_time(
+    struct gba *gba,
+    uint64_t busy_end,
+    uint64_t now
+) {
+    struct scheduler *scheduler;
+
+    scheduler = &gba->scheduler;
+    scheduler->frame_times[scheduler->frame_times_idx] = min(now - scheduler->time_last_frame, UINT64_C(1000000000)) / 1000;
+    scheduler->busy_times[scheduler->frame_times_idx] = min(busy_end - scheduler->time_last_frame, UINT64_C(1000000000)) / 1000;
+    scheduler->time_last_frame = now;
+    scheduler->frame_times_len = max(scheduler->frame_times_len, scheduler->frame_times_idx + 1);
+    ++scheduler->frame_times_idx;
+
+    atomic_fetch_add_explicit(&gba->shared_data.stats.frames, 1, memory_order_relaxed);
+
+    if (scheduler->frame_times_idx < SCHED_FRAME_TIMES_LEN) {
+        return ;
+    }
+
+    scheduler->frame_times_idx = 0;
+    sched_publish_stats(gba);
+}
+
+/*
+** Wait until the audio device consumed enough samples that only half of the audio buffer remains.
+**
+** The wait is bounded to a couple of frames so a stalled audio device can't freeze the emulation.
+*/
+static
+void
+sched_wait_for_audio(
+    struct gba *gba
+) {
+    struct scheduler *scheduler;
+    uint64_t timeout;
+
+    scheduler = &gba->scheduler;
+    timeout = hs_time_ns() + scheduler->time_per_frame * 2;
+
+    while (true) {
+        uint64_t ns_per_sample;
+        uint64_t now;
+        size_t size;
+
+        gba_shared_audio_rbuffer_lock(gba);
+        size = gba->shared_data.audio_rbuffer.size;
+        gba_shared_audio_rbuffer_release(gba);
+
+        now = hs_time_ns();
+        if (size <= APU_RBUFFER_CAPACITY / 2 || now >= timeout) {
+            break;
+        }
+
+        ns_per_sample = scheduler->audio_frequency * UINT64_C(1000000000) / GBA_CYCLES_PER_SECOND;
+        hs_sleep_until_ns(min(now + (size - APU_RBUFFER_CAPACITY / 2) * ns_per_sample, timeout));
+    }
+
+    // Don't try to catch up if we switch back to the clock.
+    scheduler->next_frame_deadline = hs_time_ns();
+}
+
+/*
+** Called at the end of each frame to slow the emulation down to the expected speed.
+**
+** Each frame has an absolute deadline, `time_per_frame` after the previous one, so the
+** wake-up latency of one frame is compensated by the next one instead of accumulating.
+** We sleep until shortly before the deadline and spin for the remaining time since
+** the OS scheduler can't be trusted to wake us up precisely on time.
+*/
 void
 sched_frame_limiter(
     struct gba *gba,
     struct event_args args __unused
 ) {
-    if (gba->scheduler.speed) {
+    struct scheduler *scheduler;
+    uint64_t busy_end;
+
+    scheduler = &gba->scheduler;
+    busy_end = hs_time_ns();
+
+    if (scheduler->speed == 1 && scheduler->audio_sync && scheduler->audio_frequency) {
+        sched_wait_for_audio(gba);
+    } else if (scheduler->speed) {
+        uint64_t deadline;
         uint64_t now;
 
-        now = hs_time();
-        gba->scheduler.accumulated_time += now - gba->scheduler.time_last_frame;
-        gba->scheduler.time_last_frame = now;
+        deadline = scheduler->next_frame_deadline + scheduler->time_per_frame;
+        now = hs_time_ns();
+
+        if (now + SCHED_LIMITER_SPIN_NS < deadline) {
+            hs_sleep_until_ns(deadline - SCHED_LIMITER_SPIN_NS);
+        }
+
+        while (now < deadline) {
+            now = hs_time_ns();
+        }
 
-        if (gba->scheduler.accumulated_time < gba->scheduler.time_per_frame) {
-            hs_usleep(gba->scheduler.time_per_frame - gba->scheduler.accumulated_time);
+        // If we are too far behind (the host is too slow, or was suspended), skip the frames we missed.
+        if (now - deadline > scheduler->time_per_frame * SCHED_LIMITER_MAX_LAG) {
+            atomic_fetch_add_explicit(&gba->shared_data.stats.dropped_frames, (now - deadline) / scheduler->time_per_frame, memory_order_relaxed);
+            deadline = now;
         }
-        gba->scheduler.accumulated_time -= gba->scheduler.time_per_frame;
+
+        scheduler->next_frame_deadline = deadline;
+    }
+
+    sched_record_frame_time(gba, busy_end, hs_time_ns());
+
+#ifdef WITH_COUNTERS
+    if (gba->counters.frame_cb) {
+        gba->counters.frame_cb(gba, gba->counters.frame_arg);
     }
+#endif
 }
 
+/*
+** Update the speed of the emulation.
+**
+** The duration of a frame is derived from the GBA's clock instead of the usual ~59.73fps
+** approximation so the audio samples are produced at the exact rate the audio device consumes them.
+*/
 void
 sched_update_speed(
     struct gba *gba,
-    uint32_t speed
+    uint32_t speed,
+    bool audio_sync
 ) {
     struct scheduler *scheduler;
 
     scheduler = &gba->scheduler;
     scheduler->speed = speed;
-    scheduler->time_per_frame = speed ? (1.f / 59.737f * 1000.f * 1000.f / (float)speed) : 0;
+    scheduler->audio_sync = audio_sync;
+    scheduler->time_per_frame = speed ? (GBA_CYCLES_PER_FRAME * UINT64_C(1000000000) / GBA_CYCLES_PER_SECOND / speed) : 0;
     sched_reset_frame_limiter(gba);
 }
@@ -40,7 +40,7 @@ timer_schedule_start(
     timer = &gba->io.timers[timer_idx];
     timer->counter.raw = timer->reload.raw;
 
-    logln(HS_TIMER, "Timer %u started with initial value %#04x", timer_idx, timer->reload.raw);
+    logev(HS_TIMER, "Timer %u started with initial value %#04x", timer_idx, timer->reload.raw);
 
     if (!timer->control.count_up) {
         timer->handler = sched_add_event(
@@ -83,7 +83,7 @@ timer_overflow(
     timer_idx = args.a1.u32;
     timer = &gba->io.timers[timer_idx];
 
-    logln(HS_TIMER, "Timer %u overflowed.", timer_idx);
+    logev(HS_TIMER, "Timer %u overflowed.", timer_idx);
 
     timer->counter.raw = timer->reload.raw;
 
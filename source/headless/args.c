@@ -0,0 +1,379 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <getopt.h>
+#include <stdio.h>
+#include "hades.h"
+#include "headless/headless.h"
+#include "compat.h"
+
+/*
+** Print the program's usage.
+*/
+static
+void
+print_usage(
+    FILE *file,
+    char const *name
+) {
+    fprintf(
+        file,
+        "Usage: %s [OPTION]... ROM\n"
+        "\n"
+        "Options:\n"
+        "    -b, --bios=PATH                    Path pointing to the bios dump (default: \"bios.bin\")\n"
+        "    -c, --config=PATH                  Path pointing to a configuration file (default: none)\n"
+        "        --color=[always|never|auto]    Adjust color settings (default: auto)\n"
+        "    -f, --frames=N                     Number of frames to run before exiting (default: 60)\n"
+        "    -i, --input=PATH                   Path pointing to an input script\n"
+        "    -s, --screenshot=PATH              Write a screenshot of the last frame to PATH\n"
+        "        --hash                         Print a hash of the last frame\n"
+        "        --load-state=PATH              Load the given save state before running\n"
+        "        --save-state=PATH              Write a save state to PATH after the last frame\n"
+        "        --skip-bios=[true|false]       Skip the BIOS intro (default: taken from the configuration)\n"
+        "        --hle-bios=[on|off|check]      Run the hottest BIOS calls natively, or compare them with the BIOS (default: taken from the configuration)\n"
+        "        --hle-report=PATH              With --hle-bios=check, write the calls that differ from the BIOS to PATH, as CSV\n"
+        "        --cache-dir=PATH               Cache the ROMs extracted from archives in PATH\n"
+        "        --stats=PATH                   Write the health metrics of the emulation to PATH, as JSON\n"
+        "        --link=N                       Connect N (2 to 4) emulators running the game with a link cable (not with --load-state)\n"
+        "        --link-quantum=N               Number of cycles a linked emulator can run ahead of the others (default: 2048)\n"
+#ifdef WITH_COVERAGE
+        "        --coverage=PATH                Merge the code executed by the game into the coverage file at PATH\n"
+#endif
+#ifdef WITH_COUNTERS
+        "        --counters=PATH                Write the counters of the interpreter to PATH, as CSV\n"
+        "        --counters-frames=PATH         Write the events fired by the scheduler each frame to PATH, as CSV\n"
+#endif
+#ifdef WITH_PROFILER
+        "        --profile=PREFIX               Profile the game and write PREFIX.folded and PREFIX.hist\n"
+        "        --profile-period=N             Number of cycles between two samples (default: 1024)\n"
+#endif
+        "\n"
+        "    -h, --help                         Print this help and exit\n"
+        "    -v, --version                      Print the version information and exit\n"
+        "\n"
+        "Each line of the input script has the form \"FRAME KEY press|release\", where KEY is one of\n"
+        "a, b, l, r, up, down, left, right, start or select. Lines starting with '#' are ignored.\n"
+        "",
+        name
+    );
+}
+
+/*
+** Parse the given command line arguments.
+*/
+void
+headless_args_parse(
+    struct headless *headless,
+    int argc,
+    char * const argv[]
+) {
+    char const *name;
+    uint32_t color;
+
+    color = 0;
+    name = argv[0];
+    while (true) {
+        int c;
+        int option_index;
+
+        enum cli_options {
+            CLI_HELP = 0,
+            CLI_VERSION,
+            CLI_BIOS,
+            CLI_CONFIG,
+            CLI_COLOR,
+            CLI_FRAMES,
+            CLI_INPUT,
+            CLI_SCREENSHOT,
+            CLI_HASH,
+            CLI_LOAD_STATE,
+            CLI_SAVE_STATE,
+            CLI_SKIP_BIOS,
+            CLI_HLE_BIOS,
+            CLI_HLE_REPORT,
+            CLI_CACHE_DIR,
+            CLI_STATS,
+            CLI_LINK,
+            CLI_LINK_QUANTUM,
+#ifdef WITH_PROFILER
+            CLI_PROFILE,
+            CLI_PROFILE_PERIOD,
+#endif
+#ifdef WITH_COVERAGE
+            CLI_COVERAGE,
+#endif
+#ifdef WITH_COUNTERS
+            CLI_COUNTERS,
+            CLI_COUNTERS_FRAMES,
+#endif
+        };
+
+        static struct option long_options[] = {
+            [CLI_HELP]          = { "help",         no_argument,        0,  0 },
+            [CLI_VERSION]       = { "version",      no_argument,        0,  0 },
+            [CLI_BIOS]          = { "bios",         required_argument,  0,  0 },
+            [CLI_CONFIG]        = { "config",       required_argument,  0,  0 },
+            [CLI_COLOR]         = { "color",        optional_argument,  0,  0 },
+            [CLI_FRAMES]        = { "frames",       required_argument,  0,  0 },
+            [CLI_INPUT]         = { "input",        required_argument,  0,  0 },
+            [CLI_SCREENSHOT]    = { "screenshot",   required_argument,  0,  0 },
+            [CLI_HASH]          = { "hash",         no_argument,        0,  0 },
+            [CLI_LOAD_STATE]    = { "load-state",   required_argument,  0,  0 },
+            [CLI_SAVE_STATE]    = { "save-state",   required_argument,  0,  0 },
+            [CLI_SKIP_BIOS]     = { "skip-bios",    optional_argument,  0,  0 },
+            [CLI_HLE_BIOS]      = { "hle-bios",     optional_argument,  0,  0 },
+            [CLI_HLE_REPORT]    = { "hle-report",   required_argument,  0,  0 },
+            [CLI_CACHE_DIR]     = { "cache-dir",    required_argument,  0,  0 },
+            [CLI_STATS]         = { "stats",        required_argument,  0,  0 },
+            [CLI_LINK]          = { "link",         required_argument,  0,  0 },
+            [CLI_LINK_QUANTUM]  = { "link-quantum", required_argument,  0,  0 },
+#ifdef WITH_PROFILER
+            [CLI_PROFILE]       = { "profile",      required_argument,  0,  0 },
+            [CLI_PROFILE_PERIOD] = { "profile-period", required_argument, 0, 0 },
+#endif
+#ifdef WITH_COVERAGE
+            [CLI_COVERAGE]      = { "coverage",     required_argument,  0,  0 },
+#endif
+#ifdef WITH_COUNTERS
+            [CLI_COUNTERS]      = { "counters",     required_argument,  0,  0 },
+            [CLI_COUNTERS_FRAMES] = { "counters-frames", required_argument, 0, 0 },
+#endif
+                                  { 0,              0,                  0,  0 }
+        };
+
+        c = getopt_long(
+            argc,
+            argv,
+            "hvb:c:f:i:s:",
+            long_options,
+            &option_index
+        );
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+            case 0: {
+                switch (option_index) {
+                    case CLI_HELP: { // --help
+                        print_usage(stdout, name);
+                        exit(EXIT_SUCCESS);
+                        break;
+                    };
+                    case CLI_VERSION: { // --version
+                        printf("Hades v" HADES_VERSION "\n");
+                        exit(EXIT_SUCCESS);
+                        break;
+                    };
+                    case CLI_BIOS: { // --bios
+                        headless->args.bios_path = optarg;
+                        break;
+                    };
+                    case CLI_CONFIG: { // --config
+                        headless->args.config_path = optarg;
+                        break;
+                    };
+                    case CLI_COLOR: { // --color
+                        if (optarg) {
+                            if (!strcmp(optarg, "auto")) {
+                                color = 0;
+                                break;
+                            } else if (!strcmp(optarg, "never")) {
+                                color = 1;
+                                break;
+                            } else if (!strcmp(optarg, "always")) {
+                                color = 2;
+                                break;
+                            } else {
+                                print_usage(stderr, name);
+                                exit(EXIT_FAILURE);
+                            }
+                        } else {
+                            color = 0;
+                        }
+                        break;
+                    };
+                    case CLI_FRAMES: { // --frames
+                        headless->args.frames = strtoull(optarg, NULL, 0);
+                        break;
+                    };
+                    case CLI_INPUT: { // --input
+                        headless->args.input_path = optarg;
+                        break;
+                    };
+                    case CLI_SCREENSHOT: { // --screenshot
+                        headless->args.screenshot_path = optarg;
+                        break;
+                    };
+                    case CLI_HASH: { // --hash
+                        headless->args.hash = true;
+                        break;
+                    };
+                    case CLI_LOAD_STATE: { // --load-state
+                        headless->args.load_state_path = optarg;
+                        break;
+                    };
+                    case CLI_SAVE_STATE: { // --save-state
+                        headless->args.save_state_path = optarg;
+                        break;
+                    };
+                    case CLI_SKIP_BIOS: { // --skip-bios
+                        if (!optarg || !strcmp(optarg, "true")) {
+                            headless->args.skip_bios = true;
+                        } else if (!strcmp(optarg, "false")) {
+                            headless->args.skip_bios = false;
+                        } else {
+                            print_usage(stderr, name);
+                            exit(EXIT_FAILURE);
+                        }
+                        break;
+                    };
+                    case CLI_HLE_BIOS: { // --hle-bios
+                        if (!optarg || !strcmp(optarg, "on")) {
+                            headless->args.hle = HLE_ON;
+                        } else if (!strcmp(optarg, "off")) {
+                            headless->args.hle = HLE_OFF;
+                        } else if (!strcmp(optarg, "check")) {
+                            headless->args.hle = HLE_CHECK;
+                        } else {
+                            print_usage(stderr, name);
+                            exit(EXIT_FAILURE);
+                        }
+                        break;
+                    };
+                    case CLI_HLE_REPORT: { // --hle-report
+                        headless->args.hle_report_path = optarg;
+                        break;
+                    };
+                    case CLI_CACHE_DIR: { // --cache-dir
+                        headless->args.cache_dir = optarg;
+                        break;
+                    };
+                    case CLI_STATS: { // --stats
+                        headless->args.stats_path = optarg;
+                        break;
+                    };
+                    case CLI_LINK: { // --link
+                        headless->args.link_players = strtoull(optarg, NULL, 0);
+                        if (headless->args.link_players < 2 || headless->args.link_players > LINK_MAX_PLAYERS) {
+                            print_usage(stderr, name);
+                            exit(EXIT_FAILURE);
+                        }
+                        break;
+                    };
+                    case CLI_LINK_QUANTUM: { // --link-quantum
+                        headless->args.link_quantum = strtoull(optarg, NULL, 0);
+                        if (!headless->args.link_quantum) {
+                            print_usage(stderr, name);
+                            exit(EXIT_FAILURE);
+                        }
+                        break;
+                    };
+#ifdef WITH_PROFILER
+                    case CLI_PROFILE: { // --profile
+                        headless->args.profile_prefix = optarg;
+                        break;
+                    };
+                    case CLI_PROFILE_PERIOD: { // --profile-period
+                        headless->args.profile_period = strtoull(optarg, NULL, 0);
+                        if (!headless->args.profile_period) {
+                            print_usage(stderr, name);
+                            exit(EXIT_FAILURE);
+                        }
+                        break;
+                    };
+#endif
+#ifdef WITH_COVERAGE
+                    case CLI_COVERAGE: { // --coverage
+                        headless->args.coverage_path = optarg;
+                        break;
+                    };
+#endif
+#ifdef WITH_COUNTERS
+                    case CLI_COUNTERS: { // --counters
+                        headless->args.counters_path = optarg;
+                        break;
+                    };
+                    case CLI_COUNTERS_FRAMES: { // --counters-frames
+                        headless->args.counters_frames_path = optarg;
+                        break;
+                    };
+#endif
+                    default: {
+                        print_usage(stderr, name);
+                        exit(EXIT_FAILURE);
+                        break;
+                    };
+                }
+                break;
+            };
+            case 'b': {
+                headless->args.bios_path = optarg;
+                break;
+            };
+            case 'c': {
+                headless->args.config_path = optarg;
+                break;
+            };
+            case 'f': {
+                headless->args.frames = strtoull(optarg, NULL, 0);
+                break;
+            };
+            case 'i': {
+                headless->args.input_path = optarg;
+                break;
+            };
+            case 's': {
+                headless->args.screenshot_path = optarg;
+                break;
+            };
+            case 'h': {
+                print_usage(stdout, name);
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            case 'v': {
+                printf("Hades v" HADES_VERSION "\n");
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            default: {
+                print_usage(stderr, name);
+                exit(EXIT_FAILURE);
+                break;
+            };
+        }
+    }
+
+    if (argc - optind != 1) {
+        print_usage(stderr, name);
+        exit(EXIT_FAILURE);
+    }
+
+    // The other emulators would have to load the same state, and be in sync with it.
+    if (headless->args.link_players && headless->args.load_state_path) {
+        fprintf(stderr, "%s: --load-state can't be used with --link.\n", name);
+        exit(EXIT_FAILURE);
+    }
+
+    headless->args.rom_path = argv[optind];
+
+    switch (color) {
+        case 0:
+            if (!hs_isatty(1)) {
+                disable_colors();
+            }
+            break;
+        case 1:
+            disable_colors();
+            break;
+    }
+}
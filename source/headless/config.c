@@ -0,0 +1,92 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <errno.h>
+#include <mjson.h>
+#include "hades.h"
+#include "headless/headless.h"
+#include "compat.h"
+
+/*
+** Load the emulation settings of the given configuration file.
+**
+** The file uses the same format than the one of the graphical frontend, but only
+** the keys that make sense without a GUI are read.
+*/
+bool
+headless_config_load(
+    struct headless *headless
+) {
+    char const *path;
+    char data[4096];
+    FILE *config_file;
+    size_t data_len;
+    bool err;
+
+    path = headless->args.config_path;
+    config_file = hs_fopen(path, "r");
+    if (!config_file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s", path, strerror(errno));
+        return (true);
+    }
+
+    err = false;
+    data_len = fread(data, 1, sizeof(data) - 1, config_file);
+
+    if (data_len == 0 && ferror(config_file)) {
+        logln(HS_ERROR, "Failed to read \"%s\": %s", path, strerror(errno));
+        err = true;
+        goto end;
+    }
+
+    data[data_len] = '\0';
+
+    // File
+    {
+        char str[4096];
+
+        if (!headless->args.bios_path && mjson_get_string(data, data_len, "$.file.bios", str, sizeof(str)) > 0) {
+            headless->args.bios_path = strdup(str);
+        }
+    }
+
+    // Emulation
+    {
+        int b;
+        double d;
+
+        if (mjson_get_bool(data, data_len, "$.emulation.backup_storage.autodetect", &b)) {
+            headless->settings.backup_storage.autodetect = b;
+        }
+
+        if (mjson_get_number(data, data_len, "$.emulation.backup_storage.type", &d)) {
+            headless->settings.backup_storage.type = max(BACKUP_MIN, min((int)d, BACKUP_MAX));
+        }
+
+        if (mjson_get_bool(data, data_len, "$.emulation.rtc.autodetect", &b)) {
+            headless->settings.rtc.autodetect = b;
+        }
+
+        if (mjson_get_bool(data, data_len, "$.emulation.rtc.enabled", &b)) {
+            headless->settings.rtc.enabled = b;
+        }
+
+        if (mjson_get_bool(data, data_len, "$.emulation.skip_bios", &b)) {
+            headless->settings.skip_bios = b;
+        }
+
+        if (mjson_get_bool(data, data_len, "$.emulation.hle_bios", &b)) {
+            headless->settings.hle = b ? HLE_ON : HLE_OFF;
+        }
+    }
+
+end:
+    fclose(config_file);
+    return (err);
+}
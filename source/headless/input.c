@@ -0,0 +1,152 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <errno.h>
+#include <ctype.h>
+#include "hades.h"
+#include "headless/headless.h"
+#include "gba/event.h"
+#include "compat.h"
+
+static char const * const keys_name[] = {
+    [KEY_A] = "a",
+    [KEY_B] = "b",
+    [KEY_L] = "l",
+    [KEY_R] = "r",
+    [KEY_UP] = "up",
+    [KEY_DOWN] = "down",
+    [KEY_LEFT] = "left",
+    [KEY_RIGHT] = "right",
+    [KEY_START] = "start",
+    [KEY_SELECT] = "select",
+};
+
+/*
+** Load the input script.
+**
+** Each line has the form `FRAME KEY press|release`. Empty lines and lines starting
+** with `#` are ignored. The frames must be given in increasing order.
+*/
+bool
+headless_input_load(
+    struct headless *headless
+) {
+    FILE *file;
+    char line[256];
+    size_t line_nb;
+    uint64_t last_frame;
+    bool err;
+
+    file = hs_fopen(headless->args.input_path, "r");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s", headless->args.input_path, strerror(errno));
+        return (true);
+    }
+
+    err = false;
+    line_nb = 0;
+    last_frame = 0;
+
+    while (fgets(line, sizeof(line), file)) {
+        struct input_event *event;
+        unsigned long long frame;
+        char key[16];
+        char action[16];
+        char *start;
+        size_t i;
+
+        ++line_nb;
+
+        start = line;
+        while (isspace(*start)) {
+            ++start;
+        }
+
+        if (*start == '\0' || *start == '#') {
+            continue;
+        }
+
+        if (sscanf(start, "%llu %15s %15s", &frame, key, action) != 3) {
+            logln(HS_ERROR, "%s:%zu: Syntax error, expected \"FRAME KEY press|release\".", headless->args.input_path, line_nb);
+            err = true;
+            break;
+        }
+
+        if (frame < last_frame) {
+            logln(HS_ERROR, "%s:%zu: Frames must be given in increasing order.", headless->args.input_path, line_nb);
+            err = true;
+            break;
+        }
+
+        headless->input.events = realloc(headless->input.events, sizeof(struct input_event) * (headless->input.len + 1));
+        hs_assert(headless->input.events);
+
+        event = &headless->input.events[headless->input.len];
+        event->frame = frame;
+
+        for (i = KEY_MIN; i < KEY_MAX; ++i) {
+            if (!strcmp(key, keys_name[i])) {
+                break;
+            }
+        }
+
+        if (i == KEY_MAX) {
+            logln(HS_ERROR, "%s:%zu: Unknown key \"%s\".", headless->args.input_path, line_nb, key);
+            err = true;
+            break;
+        }
+
+        event->key = i;
+
+        if (!strcmp(action, "press")) {
+            event->pressed = true;
+        } else if (!strcmp(action, "release")) {
+            event->pressed = false;
+        } else {
+            logln(HS_ERROR, "%s:%zu: Unknown action \"%s\", expected \"press\" or \"release\".", headless->args.input_path, line_nb, action);
+            err = true;
+            break;
+        }
+
+        last_frame = frame;
+        ++headless->input.len;
+    }
+
+    fclose(file);
+    return (err);
+}
+
+/*
+** Send to the emulator all the key events that must be applied at the beginning of the given frame.
+*/
+void
+headless_input_send(
+    struct headless *headless,
+    uint64_t frame
+) {
+    while (headless->input.next < headless->input.len && headless->input.events[headless->input.next].frame <= frame) {
+        struct input_event *input;
+        struct message_key event;
+
+        input = &headless->input.events[headless->input.next];
+
+        // The emulator runs on this thread, so it must catch up before the channel is full.
+        if (channel_pending(&headless->gba->channels.messages) == CHANNEL_SLOTS) {
+            gba_process_all_messages(headless->gba);
+        }
+
+        event.header.kind = MESSAGE_KEY;
+        event.header.size = sizeof(event);
+        event.key = input->key;
+        event.pressed = input->pressed;
+        channel_push(&headless->gba->channels.messages, &event.header);
+
+        ++headless->input.next;
+    }
+}
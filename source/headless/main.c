@@ -0,0 +1,723 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** A minimal frontend without SDL, OpenGL or ImGui, meant to run games from scripts.
+**
+** Unlike the graphical frontend, the emulator isn't run in its own thread: messages are
+** processed synchronously and the emulation advances one frame at a time.
+**
+** With `--link`, the other emulators connected to the link cable each run in their own
+** thread, as they have to progress in parallel with the main one.
+*/
+
+#define _GNU_SOURCE
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+
+#include <stb_image_write.h>
+#include <inttypes.h>
+#include <errno.h>
+#include "hades.h"
+#include "headless/headless.h"
+#include "app/loader.h"
+#include "gba/gba.h"
+#include "gba/event.h"
+#include "compat.h"
+
+/*
+** Process and delete all the notifications sent by the emulator.
+*/
+static
+bool
+headless_process_all_notifs(
+    struct headless *headless
+) {
+    struct channel *channel;
+    struct event_header const *event;
+    bool err;
+
+    err = false;
+    channel = &headless->gba->channels.notifications;
+
+    channel_lock(channel);
+
+    event = channel_peek(channel);
+    while (event) {
+        if (event->kind == NOTIFICATION_QUICKSAVE) {
+            struct notification_quicksave const *qsave;
+            FILE *file;
+
+            qsave = (struct notification_quicksave const *)event;
+            file = hs_fopen(headless->args.save_state_path, "wb");
+            if (!file || fwrite(qsave->data, qsave->size, 1, file) != 1) {
+                logln(HS_ERROR, "Failed to write the save state to \"%s\": %s.", headless->args.save_state_path, strerror(errno));
+                err = true;
+            }
+
+            if (file) {
+                fclose(file);
+            }
+        }
+
+        gba_delete_notification((struct notification const *)event);
+        channel_pop(channel);
+        event = channel_peek(channel);
+    }
+
+    channel_release(channel);
+    return (err);
+}
+
+/*
+** Read the whole content of the file at the given path.
+*/
+static
+bool
+headless_read_file(
+    char const *path,
+    uint8_t **data,
+    size_t *size
+) {
+    FILE *file;
+    size_t file_len;
+    uint8_t *buffer;
+
+    file = hs_fopen(path, "rb");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", path, strerror(errno));
+        return (true);
+    }
+
+    fseek(file, 0, SEEK_END);
+    file_len = ftell(file);
+    rewind(file);
+
+    buffer = calloc(1, file_len);
+    hs_assert(buffer);
+
+    if (fread(buffer, 1, file_len, file) != file_len) {
+        logln(HS_ERROR, "Failed to read \"%s\": %s.", path, strerror(errno));
+        free(buffer);
+        fclose(file);
+        return (true);
+    }
+
+    fclose(file);
+
+    *data = buffer;
+    *size = file_len;
+    return (false);
+}
+
+/*
+** Build the launch configuration and reset the emulator with it.
+*/
+static
+bool
+headless_reset(
+    struct headless *headless,
+    struct launch_config *config
+) {
+    struct message_reset event;
+    struct game_entry *game_entry;
+    uint8_t const *code;
+    char *err;
+
+    err = app_load_bios(headless->args.bios_path, &config->bios.data, &config->bios.size);
+
+    // The HLE can run without a BIOS, using its stub instead.
+    if (err && headless->settings.hle == HLE_ON) {
+        free(err);
+        err = NULL;
+        config->bios.data = NULL;
+        config->bios.size = 0;
+    }
+
+    if (!err) {
+        err = app_load_rom(headless->args.rom_path, headless->args.cache_dir, &config->rom.data, &config->rom.size);
+    }
+
+    if (err) {
+        logln(HS_ERROR, "%s", err);
+        free(err);
+        return (true);
+    }
+
+    code = config->rom.data + 0xAC;
+    game_entry = db_lookup_game(code, db_rom_crc32(config->rom.data, config->rom.size));
+
+    if (!game_entry) {
+        game_entry = db_autodetect_game_features(config->rom.data, config->rom.size);
+    }
+
+    config->skip_bios = headless->settings.skip_bios;
+    config->hle = headless->settings.hle;
+    config->speed = 0;
+    config->audio_frequency = 0;
+    config->rtc = headless->settings.rtc.autodetect ? (bool)(game_entry->flags & GAME_ENTRY_FLAGS_RTC) : headless->settings.rtc.enabled;
+    config->backup_storage.type = headless->settings.backup_storage.autodetect ? game_entry->storage : headless->settings.backup_storage.type;
+
+    free(game_entry);
+
+#ifdef WITH_PROFILER
+    config->profiler_period = headless->args.profile_prefix ? headless->args.profile_period : 0;
+#endif
+
+    event.header.kind = MESSAGE_RESET;
+    event.header.size = sizeof(event);
+    memcpy(&event.config, config, sizeof(event.config));
+    channel_push(&headless->gba->channels.messages, &event.header);
+
+    if (headless->args.load_state_path) {
+        struct message_quickload qload;
+
+        if (headless_read_file(headless->args.load_state_path, &qload.data, &qload.size)) {
+            return (true);
+        }
+
+        qload.header.kind = MESSAGE_QUICKLOAD;
+        qload.header.size = sizeof(qload);
+        channel_push(&headless->gba->channels.messages, &qload.header);
+        gba_process_all_messages(headless->gba);
+        free(qload.data);
+    } else {
+        gba_process_all_messages(headless->gba);
+    }
+
+    return (headless_process_all_notifs(headless));
+}
+
+/*
+** The thread of an emulator linked to the main one.
+*/
+static
+void *
+headless_peer_run(
+    void *raw_peer
+) {
+    struct headless_peer *peer;
+    uint64_t frame;
+
+    peer = raw_peer;
+    for (frame = 0; frame < peer->frames; ++frame) {
+        sched_run_for(peer->gba, GBA_CYCLES_PER_FRAME);
+        gba_delete_all_notifications(peer->gba);
+    }
+
+    // The others mustn't wait for this emulator anymore.
+    link_disconnect(peer->gba);
+    return (NULL);
+}
+
+/*
+** Reset the emulators linked to the main one with the same configuration and start
+** their threads.
+*/
+static
+bool
+headless_link_start(
+    struct headless *headless,
+    struct launch_config const *config
+) {
+    size_t i;
+
+    for (i = 0; i < headless->peers_len; ++i) {
+        struct headless_peer *peer;
+        struct message_reset event;
+
+        peer = headless->peers + i;
+
+        event.header.kind = MESSAGE_RESET;
+        event.header.size = sizeof(event);
+        memcpy(&event.config, config, sizeof(event.config));
+#ifdef WITH_PROFILER
+        event.config.profiler_period = 0;
+#endif
+        channel_push(&peer->gba->channels.messages, &event.header);
+        gba_process_all_messages(peer->gba);
+        gba_delete_all_notifications(peer->gba);
+    }
+
+    for (i = 0; i < headless->peers_len; ++i) {
+        struct headless_peer *peer;
+
+        peer = headless->peers + i;
+        peer->frames = headless->args.frames;
+        if (pthread_create(&peer->thread, NULL, headless_peer_run, peer)) {
+            logln(HS_ERROR, "Failed to create the thread of the linked emulator #%zu.", i + 1);
+
+            // The emulators already running mustn't wait for the ones that won't.
+            for (; i < headless->peers_len; ++i) {
+                link_disconnect(headless->peers[i].gba);
+            }
+            return (true);
+        }
+        peer->running = true;
+    }
+    return (false);
+}
+
+/*
+** Unplug the main emulator from the link cable and wait for the others to finish.
+*/
+static
+void
+headless_link_stop(
+    struct headless *headless
+) {
+    size_t i;
+
+    if (!headless->gba) {
+        return ;
+    }
+
+    link_disconnect(headless->gba);
+
+    for (i = 0; i < headless->peers_len; ++i) {
+        if (headless->peers[i].running) {
+            pthread_join(headless->peers[i].thread, NULL);
+            headless->peers[i].running = false;
+        }
+    }
+}
+
+/*
+** Write the health metrics of the emulation as JSON.
+*/
+static
+bool
+headless_write_stats(
+    struct headless *headless
+) {
+    struct emulation_stats const *stats;
+    FILE *file;
+
+    sched_publish_stats(headless->gba);
+    stats = &headless->gba->shared_data.stats;
+
+    file = hs_fopen(headless->args.stats_path, "w");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", headless->args.stats_path, strerror(errno));
+        return (true);
+    }
+
+    fprintf(
+        file,
+        "{\n"
+        "    \"frames\": %" PRIu64 ",\n"
+        "    \"dropped_frames\": %" PRIu64 ",\n"
+        "    \"frame_time_us\": { \"mean\": %u, \"p50\": %u, \"p99\": %u, \"max\": %u },\n"
+        "    \"busy_time_us\": %u,\n"
+        "    \"speed_percent\": %u,\n"
+        "    \"audio\": { \"fill_percent\": %u, \"underruns\": %" PRIu64 ", \"overruns\": %" PRIu64 " }\n"
+        "}\n",
+        (uint64_t)atomic_load(&stats->frames),
+        (uint64_t)atomic_load(&stats->dropped_frames),
+        atomic_load(&stats->frame_time_mean),
+        atomic_load(&stats->frame_time_p50),
+        atomic_load(&stats->frame_time_p99),
+        atomic_load(&stats->frame_time_max),
+        atomic_load(&stats->busy_time_mean),
+        atomic_load(&stats->speed),
+        atomic_load(&stats->audio_fill),
+        (uint64_t)atomic_load(&stats->audio_underruns),
+        (uint64_t)atomic_load(&stats->audio_overruns)
+    );
+
+    if (fclose(file)) {
+        logln(HS_ERROR, "Failed to write \"%s\": %s.", headless->args.stats_path, strerror(errno));
+        return (true);
+    }
+    return (false);
+}
+
+/*
+** Write the report of the differences between the HLE and the BIOS.
+*/
+static
+bool
+headless_write_hle_report(
+    struct headless *headless
+) {
+    FILE *file;
+    bool err;
+
+    file = hs_fopen(headless->args.hle_report_path, "w");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", headless->args.hle_report_path, strerror(errno));
+        return (true);
+    }
+
+    err = hle_write_report(headless->gba, file);
+    err = fclose(file) || err;
+
+    if (err) {
+        logln(HS_ERROR, "Failed to write \"%s\": %s.", headless->args.hle_report_path, strerror(errno));
+    }
+    return (err);
+}
+
+#ifdef WITH_PROFILER
+
+/*
+** Write the folded stacks and the histogram of the profiler to PREFIX.folded and PREFIX.hist.
+*/
+static
+bool
+headless_write_profile(
+    struct headless *headless
+) {
+    char const *exts[] = { "folded", "hist" };
+    size_t i;
+
+    for (i = 0; i < array_length(exts); ++i) {
+        FILE *file;
+        char *path;
+
+        path = hs_format("%s.%s", headless->args.profile_prefix, exts[i]);
+        file = hs_fopen(path, "w");
+        if (!file) {
+            logln(HS_ERROR, "Failed to open \"%s\": %s.", path, strerror(errno));
+            free(path);
+            return (true);
+        }
+
+        if (i == 0) {
+            profiler_write_folded(headless->gba, file);
+        } else {
+            profiler_write_histogram(headless->gba, file);
+        }
+
+        if (fclose(file)) {
+            logln(HS_ERROR, "Failed to write \"%s\": %s.", path, strerror(errno));
+            free(path);
+            return (true);
+        }
+
+        free(path);
+    }
+    return (false);
+}
+
+#endif /* WITH_PROFILER */
+
+#ifdef WITH_COVERAGE
+
+/*
+** Merge the coverage file of the previous runs, if any, into the current coverage.
+*/
+static
+bool
+headless_load_coverage(
+    struct headless *headless
+) {
+    FILE *file;
+    uint8_t *data;
+    size_t size;
+
+    file = hs_fopen(headless->args.coverage_path, "rb");
+    if (!file) {
+        if (errno == ENOENT) {
+            return (false);
+        }
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", headless->args.coverage_path, strerror(errno));
+        return (true);
+    }
+    fclose(file);
+
+    if (headless_read_file(headless->args.coverage_path, &data, &size)) {
+        return (true);
+    }
+
+    if (coverage_merge(headless->gba, data, size)) {
+        logln(HS_ERROR, "\"%s\" isn't a coverage file of this game.", headless->args.coverage_path);
+        free(data);
+        return (true);
+    }
+
+    free(data);
+    return (false);
+}
+
+/*
+** Write the coverage, merged with the one of the previous runs.
+*/
+static
+bool
+headless_write_coverage(
+    struct headless *headless
+) {
+    FILE *file;
+    bool err;
+
+    file = hs_fopen(headless->args.coverage_path, "wb");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", headless->args.coverage_path, strerror(errno));
+        return (true);
+    }
+
+    err = coverage_write(headless->gba, file);
+    err = fclose(file) || err;
+
+    if (err) {
+        logln(HS_ERROR, "Failed to write \"%s\": %s.", headless->args.coverage_path, strerror(errno));
+    }
+    return (err);
+}
+
+#endif /* WITH_COVERAGE */
+
+#ifdef WITH_COUNTERS
+
+/*
+** Write the counters of the interpreter.
+*/
+static
+bool
+headless_write_counters(
+    struct headless *headless
+) {
+    FILE *file;
+    bool err;
+
+    file = hs_fopen(headless->args.counters_path, "w");
+    if (!file) {
+        logln(HS_ERROR, "Failed to open \"%s\": %s.", headless->args.counters_path, strerror(errno));
+        return (true);
+    }
+
+    err = counters_write_csv(headless->gba, file);
+    err = fclose(file) || err;
+
+    if (err) {
+        logln(HS_ERROR, "Failed to write \"%s\": %s.", headless->args.counters_path, strerror(errno));
+    }
+    return (err);
+}
+
+/*
+** Called by the emulator at the end of each frame: write how many events of each kind were
+** fired during that frame and the time their callbacks took.
+*/
+static
+void
+headless_counters_frame(
+    struct gba const *gba,
+    void *raw_headless
+) {
+    struct headless *headless;
+    size_t i;
+
+    headless = raw_headless;
+    for (i = 0; i < SCHED_EVENT_MAX; ++i) {
+        struct sched_counter const *event;
+        struct sched_counter *last;
+
+        event = gba->counters.events + i;
+        last = headless->counters_frames.last + i;
+        if (event->fired != last->fired) {
+            fprintf(
+                headless->counters_frames.file,
+                "%" PRIu64 ",%s,%" PRIu64 ",%" PRIu64 "\n",
+                headless->counters_frames.frame,
+                sched_event_names[i],
+                event->fired - last->fired,
+                event->time_ns - last->time_ns
+            );
+        }
+        *last = *event;
+    }
+    ++headless->counters_frames.frame;
+}
+
+#endif /* WITH_COUNTERS */
+
+int
+main(
+    int argc,
+    char *argv[]
+) {
+    struct headless headless;
+    struct launch_config config;
+    uint64_t frame;
+    size_t i;
+    int ret;
+
+    memset(&headless, 0, sizeof(headless));
+    memset(&config, 0, sizeof(config));
+
+    headless.args.frames = 60;
+    headless.args.skip_bios = -1;
+    headless.args.hle = -1;
+    headless.args.profile_period = 1024;
+    headless.args.link_quantum = LINK_DEFAULT_QUANTUM;
+    headless.settings.backup_storage.autodetect = true;
+    headless.settings.rtc.autodetect = true;
+
+    // Only errors are printed, so the output can be parsed by scripts.
+    g_verbose[HS_INFO] = false;
+    g_verbose[HS_WARNING] = false;
+
+    headless_args_parse(&headless, argc, argv);
+
+    ret = EXIT_FAILURE;
+
+    if (headless.args.config_path && headless_config_load(&headless)) {
+        goto end;
+    }
+
+    if (headless.args.input_path && headless_input_load(&headless)) {
+        goto end;
+    }
+
+    if (!headless.args.bios_path) {
+        headless.args.bios_path = "bios.bin";
+    }
+
+    if (headless.args.skip_bios != -1) {
+        headless.settings.skip_bios = headless.args.skip_bios;
+    }
+
+    if (headless.args.hle != -1) {
+        headless.settings.hle = headless.args.hle;
+    }
+
+    headless.gba = gba_create();
+
+    if (headless.args.link_players) {
+        link_init(&headless.link, headless.args.link_quantum);
+        link_connect(&headless.link, headless.gba);
+
+        for (; headless.peers_len < headless.args.link_players - 1; ++headless.peers_len) {
+            headless.peers[headless.peers_len].gba = gba_create();
+            link_connect(&headless.link, headless.peers[headless.peers_len].gba);
+        }
+    }
+
+#ifdef WITH_COUNTERS
+    if (headless.args.counters_frames_path) {
+        headless.counters_frames.file = hs_fopen(headless.args.counters_frames_path, "w");
+        if (!headless.counters_frames.file) {
+            logln(HS_ERROR, "Failed to open \"%s\": %s.", headless.args.counters_frames_path, strerror(errno));
+            goto end;
+        }
+
+        fprintf(headless.counters_frames.file, "frame,event,fired,time_ns\n");
+        headless.gba->counters.frame_cb = headless_counters_frame;
+        headless.gba->counters.frame_arg = &headless;
+    }
+#endif
+
+    if (headless_reset(&headless, &config)) {
+        goto end;
+    }
+
+#ifdef WITH_COVERAGE
+    if (headless.args.coverage_path && headless_load_coverage(&headless)) {
+        goto end;
+    }
+#endif
+
+    if (headless_link_start(&headless, &config)) {
+        goto end;
+    }
+
+    // The frame times are measured from here, not from the creation of the emulator.
+    sched_reset_frame_limiter(headless.gba);
+
+    for (frame = 0; frame < headless.args.frames; ++frame) {
+        headless_input_send(&headless, frame);
+        gba_process_all_messages(headless.gba);
+        sched_run_for(headless.gba, GBA_CYCLES_PER_FRAME);
+        headless_process_all_notifs(&headless);
+    }
+
+    headless_link_stop(&headless);
+
+    if (headless.args.save_state_path) {
+        struct message event;
+
+        event.header.kind = MESSAGE_QUICKSAVE;
+        event.header.size = sizeof(event);
+        channel_push(&headless.gba->channels.messages, &event.header);
+        gba_process_all_messages(headless.gba);
+
+        if (headless_process_all_notifs(&headless)) {
+            goto end;
+        }
+    }
+
+    if (headless.args.screenshot_path) {
+        if (!stbi_write_png(
+            headless.args.screenshot_path,
+            GBA_SCREEN_WIDTH,
+            GBA_SCREEN_HEIGHT,
+            4,
+            headless.gba->shared_data.framebuffer.data,
+            GBA_SCREEN_WIDTH * sizeof(uint32_t)
+        )) {
+            logln(HS_ERROR, "Failed to write the screenshot to \"%s\".", headless.args.screenshot_path);
+            goto end;
+        }
+    }
+
+    if (headless.args.hash) {
+        printf("%016" PRIx64 "\n", hs_fnv1a(HS_FNV1A_BASIS, headless.gba->shared_data.framebuffer.data, sizeof(headless.gba->shared_data.framebuffer.data)));
+    }
+
+    if (headless.args.stats_path && headless_write_stats(&headless)) {
+        goto end;
+    }
+
+#ifdef WITH_PROFILER
+    if (headless.args.profile_prefix && headless_write_profile(&headless)) {
+        goto end;
+    }
+#endif
+
+#ifdef WITH_COVERAGE
+    if (headless.args.coverage_path && headless_write_coverage(&headless)) {
+        goto end;
+    }
+#endif
+
+#ifdef WITH_COUNTERS
+    if (headless.args.counters_path && headless_write_counters(&headless)) {
+        goto end;
+    }
+#endif
+
+    if (headless.args.hle_report_path && headless_write_hle_report(&headless)) {
+        goto end;
+    }
+
+    ret = EXIT_SUCCESS;
+
+end:
+    headless_link_stop(&headless);
+
+#ifdef WITH_COUNTERS
+    if (headless.counters_frames.file && fclose(headless.counters_frames.file)) {
+        logln(HS_ERROR, "Failed to write \"%s\": %s.", headless.args.counters_frames_path, strerror(errno));
+        ret = EXIT_FAILURE;
+    }
+#endif
+
+    for (i = 0; i < headless.peers_len; ++i) {
+        gba_delete(headless.peers[i].gba);
+    }
+
+    if (headless.gba) {
+        gba_delete(headless.gba);
+    }
+    free(config.bios.data);
+    free(config.rom.data);
+    free(headless.input.events);
+    return (ret);
+}
@@ -21,6 +21,13 @@ bool g_verbose[HS_END] = {
     [HS_ERROR] = true,
 };
 
+/*
+** The log ring and whether events are recorded in it.
+*/
+bool g_log_ring_enabled = false;
+struct log_ring_entry g_log_ring[LOG_RING_LEN];
+atomic_uint_fast64_t g_log_ring_idx = 0;
+
 /*
 ** A set of global strings pointing to ANSI control sequences to format the terminal.
 ** They can also be set to the empty string if coloration is disabled.
@@ -68,37 +75,161 @@ disable_colors(void)
 }
 
 /*
-** Log the given formatted string, followed by a `\n`.
+** Print the given formatted string, followed by a `\n`.
+**
+** Use `logln()` instead, which checks the verbosity of the module first.
 */
 void
-logln(
+log_print(
     enum modules module,
     char const *fmt,
     ...
 ) {
     va_list va;
 
-    if (g_verbose_global && g_verbose[module]) {
-        va_start(va, fmt);
+    va_start(va, fmt);
+
+    printf("[%s] ", modules_str[module]);
 
-        printf("[%s] ", modules_str[module]);
+    if (module == HS_ERROR) {
+        printf("%s%s", g_bold, g_light_red);
+    }
+
+    vprintf(fmt, va);
+
+    if (module == HS_ERROR) {
+        printf("%s", g_reset);
+    }
 
-        if (module == HS_ERROR) {
-            printf("%s%s", g_bold, g_light_red);
+    printf("\n");
+
+    va_end(va);
+}
+
+/*
+** Format and print an entry of the log ring.
+**
+** The arguments were all stored as 64-bit integers, so each conversion of the format is
+** printed on its own, with its length modifier replaced by one matching that type.
+*/
+static
+void
+log_ring_print_entry(
+    FILE *file,
+    struct log_ring_entry const *entry
+) {
+    char const *fmt;
+    size_t arg;
+
+    fprintf(file, "[%s] ", modules_str[entry->module]);
+
+    arg = 0;
+    fmt = entry->fmt;
+    while (*fmt) {
+        char spec[32];
+        char const *start;
+        size_t spec_len;
+        bool is_int;
+        uint64_t value;
+        char conv;
+
+        if (*fmt != '%') {
+            fputc(*fmt++, file);
+            continue;
+        } else if (fmt[1] == '%') {
+            fputc('%', file);
+            fmt += 2;
+            continue;
+        }
+
+        // Flags, width and precision
+        start = fmt++;
+        fmt += strspn(fmt, "#0- +.123456789");
+        spec_len = fmt - start;
+
+        // Length modifier (`is_int` is true if the argument is an `int` or smaller)
+        is_int = !strspn(fmt, "lzjt");
+        fmt += strspn(fmt, "hlzjt");
+
+        conv = *fmt;
+        if (!conv || spec_len + 4 > sizeof(spec)) {
+            break;
         }
+        ++fmt;
 
-        vprintf(fmt, va);
+        memcpy(spec, start, spec_len);
+        value = arg < LOG_RING_MAX_ARGS ? entry->args[arg++] : 0;
 
-        if (module == HS_ERROR) {
-            printf("%s", g_reset);
+        switch (conv) {
+            case 'd':
+            case 'i': {
+                memcpy(spec + spec_len, "ll", 2);
+                spec[spec_len + 2] = conv;
+                spec[spec_len + 3] = '\0';
+                fprintf(file, spec, is_int ? (long long)(int)value : (long long)value);
+                break;
+            };
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o': {
+                memcpy(spec + spec_len, "ll", 2);
+                spec[spec_len + 2] = conv;
+                spec[spec_len + 3] = '\0';
+                fprintf(file, spec, is_int ? (unsigned long long)(unsigned)value : (unsigned long long)value);
+                break;
+            };
+            case 'c': {
+                spec[spec_len] = conv;
+                spec[spec_len + 1] = '\0';
+                fprintf(file, spec, (int)value);
+                break;
+            };
+            case 's': {
+                spec[spec_len] = conv;
+                spec[spec_len + 1] = '\0';
+                fprintf(file, spec, (char const *)(uintptr_t)value);
+                break;
+            };
+            case 'p': {
+                spec[spec_len] = conv;
+                spec[spec_len + 1] = '\0';
+                fprintf(file, spec, (void *)(uintptr_t)value);
+                break;
+            };
+            default: {
+                fprintf(file, "<%%%c?>", conv);
+                break;
+            };
         }
+    }
+
+    fputc('\n', file);
+}
 
-        printf("\n");
+/*
+** Print the content of the log ring, from the oldest event to the most recent one.
+*/
+void
+log_ring_dump(
+    FILE *file
+) {
+    uint64_t idx;
+    uint64_t i;
 
-        va_end(va);
+    idx = atomic_load(&g_log_ring_idx);
+    i = idx > LOG_RING_LEN ? idx - LOG_RING_LEN : 0;
+    for (; i < idx; ++i) {
+        log_ring_print_entry(file, &g_log_ring[i % LOG_RING_LEN]);
     }
 }
 
+void
+log_ring_clear(void)
+{
+    atomic_store(&g_log_ring_idx, 0);
+}
+
 /*
 ** Print the given formatted string to stderr and finally exit(1).
 */
@@ -111,6 +242,12 @@ panic(
 ) {
     va_list va;
 
+    // The last events are usually the best clue to understand what went wrong.
+    if (g_log_ring_enabled && g_log_ring_idx) {
+        printf("[%s] Last recorded events:\n", modules_str[module]);
+        log_ring_dump(stdout);
+    }
+
     va_start(va, fmt);
     printf("[%s] Abort: ", modules_str[module]);
     vprintf(fmt, va);
@@ -0,0 +1,214 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+#include <getopt.h>
+#include <stdio.h>
+#include "hades.h"
+#include "microbench/microbench.h"
+#include "compat.h"
+
+/*
+** Print the program's usage.
+*/
+static
+void
+print_usage(
+    FILE *file,
+    char const *name
+) {
+    fprintf(
+        file,
+        "Usage: %s [OPTION]... [FILTER]...\n"
+        "\n"
+        "Options:\n"
+        "    -l, --list                         List the benchmarks and exit\n"
+        "    -w, --warmup=N                     Number of repetitions run before the measures (default: 3)\n"
+        "    -r, --reps=N                       Number of repetitions measured (default: 10)\n"
+        "    -t, --time=MS                      Target duration of a repetition, in milliseconds (default: 50)\n"
+        "        --csv                          Print the results as CSV\n"
+        "        --color=[always|never|auto]    Adjust color settings (default: auto)\n"
+        "\n"
+        "    -h, --help                         Print this help and exit\n"
+        "    -v, --version                      Print the version information and exit\n"
+        "\n"
+        "Only the benchmarks whose name contains one of the filters are run, or all of them if\n"
+        "none is given (eg. \"%s core/ mem/read\").\n"
+        "",
+        name,
+        name
+    );
+}
+
+/*
+** Parse the given command line arguments.
+*/
+void
+microbench_args_parse(
+    struct microbench *microbench,
+    int argc,
+    char * const argv[]
+) {
+    char const *name;
+    uint32_t color;
+
+    color = 0;
+    name = argv[0];
+    while (true) {
+        int c;
+        int option_index;
+
+        enum cli_options {
+            CLI_HELP = 0,
+            CLI_VERSION,
+            CLI_LIST,
+            CLI_WARMUP,
+            CLI_REPS,
+            CLI_TIME,
+            CLI_CSV,
+            CLI_COLOR,
+        };
+
+        static struct option long_options[] = {
+            [CLI_HELP]          = { "help",         no_argument,        0,  0 },
+            [CLI_VERSION]       = { "version",      no_argument,        0,  0 },
+            [CLI_LIST]          = { "list",         no_argument,        0,  0 },
+            [CLI_WARMUP]        = { "warmup",       required_argument,  0,  0 },
+            [CLI_REPS]          = { "reps",         required_argument,  0,  0 },
+            [CLI_TIME]          = { "time",         required_argument,  0,  0 },
+            [CLI_CSV]           = { "csv",          no_argument,        0,  0 },
+            [CLI_COLOR]         = { "color",        optional_argument,  0,  0 },
+                                  { 0,              0,                  0,  0 }
+        };
+
+        c = getopt_long(
+            argc,
+            argv,
+            "hvlw:r:t:",
+            long_options,
+            &option_index
+        );
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+            case 0: {
+                switch (option_index) {
+                    case CLI_HELP: { // --help
+                        print_usage(stdout, name);
+                        exit(EXIT_SUCCESS);
+                        break;
+                    };
+                    case CLI_VERSION: { // --version
+                        printf("Hades v" HADES_VERSION "\n");
+                        exit(EXIT_SUCCESS);
+                        break;
+                    };
+                    case CLI_LIST: { // --list
+                        microbench->args.list = true;
+                        break;
+                    };
+                    case CLI_WARMUP: { // --warmup
+                        microbench->args.warmup = strtoull(optarg, NULL, 0);
+                        break;
+                    };
+                    case CLI_REPS: { // --reps
+                        microbench->args.reps = strtoull(optarg, NULL, 0);
+                        break;
+                    };
+                    case CLI_TIME: { // --time
+                        microbench->args.time_ms = strtoull(optarg, NULL, 0);
+                        break;
+                    };
+                    case CLI_CSV: { // --csv
+                        microbench->args.csv = true;
+                        break;
+                    };
+                    case CLI_COLOR: { // --color
+                        if (optarg) {
+                            if (!strcmp(optarg, "auto")) {
+                                color = 0;
+                                break;
+                            } else if (!strcmp(optarg, "never")) {
+                                color = 1;
+                                break;
+                            } else if (!strcmp(optarg, "always")) {
+                                color = 2;
+                                break;
+                            } else {
+                                print_usage(stderr, name);
+                                exit(EXIT_FAILURE);
+                            }
+                        } else {
+                            color = 0;
+                        }
+                        break;
+                    };
+                    default: {
+                        print_usage(stderr, name);
+                        exit(EXIT_FAILURE);
+                        break;
+                    };
+                }
+                break;
+            };
+            case 'l': {
+                microbench->args.list = true;
+                break;
+            };
+            case 'w': {
+                microbench->args.warmup = strtoull(optarg, NULL, 0);
+                break;
+            };
+            case 'r': {
+                microbench->args.reps = strtoull(optarg, NULL, 0);
+                break;
+            };
+            case 't': {
+                microbench->args.time_ms = strtoull(optarg, NULL, 0);
+                break;
+            };
+            case 'h': {
+                print_usage(stdout, name);
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            case 'v': {
+                printf("Hades v" HADES_VERSION "\n");
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            default: {
+                print_usage(stderr, name);
+                exit(EXIT_FAILURE);
+                break;
+            };
+        }
+    }
+
+    if (!microbench->args.reps || !microbench->args.time_ms) {
+        print_usage(stderr, name);
+        exit(EXIT_FAILURE);
+    }
+
+    microbench->args.filters = argv + optind;
+    microbench->args.filters_len = argc - optind;
+
+    switch (color) {
+        case 0:
+            if (!hs_isatty(1)) {
+                disable_colors();
+            }
+            break;
+        case 1:
+            disable_colors();
+            break;
+    }
+}
@@ -0,0 +1,746 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** The workloads of the micro-benchmarks.
+**
+** They are all synthetic and reproducible: the ROM, VRAM, OAM, etc. are filled from
+** a fixed seed, so two runs of the same benchmark always do the exact same work.
+*/
+
+#include <string.h>
+#include "hades.h"
+#include "microbench/microbench.h"
+#include "gba/gba.h"
+#include "gba/core.h"
+#include "gba/event.h"
+#include "gba/memory.h"
+#include "gba/ppu.h"
+#include "gba/apu.h"
+#include "gba/io.h"
+#include "gba/scheduler.h"
+
+#define BENCH_SEED              0x48616465u
+#define BENCH_ROM_SIZE          (64 * 1024)
+
+// Where the programs of the `core/` benchmarks are in the ROM, and where they store their data.
+#define BENCH_ARM_OFFSET        0x100
+#define BENCH_THUMB_OFFSET      0x200
+#define BENCH_DATA_ADDR         0x03000800
+
+#define BENCH_THUMB             0x1
+
+#define BENCH_DMA_32            (1u << 16)
+#define BENCH_DMA_ROM           (1u << 17)
+
+// Written by the benchmarks reading memory, so the reads aren't optimized away.
+static volatile uint32_t bench_sink;
+
+// The save state loaded by `quickload`, see `bench_quickload_setup()`.
+static uint8_t *bench_qsave_data;
+static size_t bench_qsave_size;
+
+/*
+** A loop mixing data processing, loads and stores, multiplications, block transfers,
+** conditional execution and a function call.
+*/
+static uint32_t const bench_arm_program[] = {
+    0xe2800001,     // loop: add r0, r0, #1
+    0xe0211180,     //       eor r1, r1, r0, lsl #3
+    0xe5942000,     //       ldr r2, [r4]
+    0xe5842004,     //       str r2, [r4, #4]
+    0xe0030091,     //       mul r3, r1, r0
+    0xe89401e0,     //       ldmia r4, {r5-r8}
+    0xe88401e0,     //       stmia r4, {r5-r8}
+    0xe31000ff,     //       tst r0, #0xFF
+    0x10899001,     //       addne r9, r9, r1
+    0xe1b0a3e1,     //       movs r10, r1, ror #7
+    0xe1d4b0b8,     //       ldrh r11, [r4, #8]
+    0xeb000000,     //       bl func
+    0xeafffff2,     //       b loop
+    0xe12fff1e,     // func: bx lr
+};
+
+/*
+** The same kind of loop, in Thumb.
+*/
+static uint16_t const bench_thumb_program[] = {
+    0x3001,         // loop: add r0, #1
+    0x00c1,         //       lsl r1, r0, #3
+    0x4041,         //       eor r1, r0
+    0x6822,         //       ldr r2, [r4]
+    0x6062,         //       str r2, [r4, #4]
+    0x434b,         //       mul r3, r1
+    0xb4e0,         //       push {r5-r7}
+    0xbce0,         //       pop {r5-r7}
+    0x4298,         //       cmp r0, r3
+    0xd100,         //       bne skip
+    0x1876,         //       add r6, r6, r1
+    0x8925,         // skip: ldrh r5, [r4, #8]
+    0xf000,         //       bl func
+    0xf801,
+    0xe7f0,         //       b loop
+    0x4770,         // func: bx lr
+};
+
+static inline
+uint32_t
+bench_rand(
+    uint32_t *state
+) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (*state);
+}
+
+static
+void
+bench_fill(
+    uint8_t *data,
+    size_t size,
+    uint32_t *state
+) {
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+        data[i] = bench_rand(state);
+    }
+}
+
+/*
+** Reset the emulator with the synthetic ROM of the benchmarks.
+**
+** There's no BIOS, the HLE and its stub are used instead.
+*/
+static
+void
+bench_reset(
+    struct gba *gba,
+    enum backup_storage_types backup
+) {
+    struct message_reset event;
+    struct launch_config *config;
+    uint32_t state;
+    uint8_t *rom;
+
+    rom = malloc(BENCH_ROM_SIZE);
+    hs_assert(rom);
+
+    state = BENCH_SEED;
+    bench_fill(rom, BENCH_ROM_SIZE, &state);
+    memcpy(rom + BENCH_ARM_OFFSET, bench_arm_program, sizeof(bench_arm_program));
+    memcpy(rom + BENCH_THUMB_OFFSET, bench_thumb_program, sizeof(bench_thumb_program));
+
+    config = &event.config;
+    memset(config, 0, sizeof(*config));
+    config->rom.data = rom;
+    config->rom.size = BENCH_ROM_SIZE;
+    config->skip_bios = true;
+    config->hle = HLE_ON;
+    config->speed = 0;
+    config->audio_frequency = GBA_CYCLES_PER_SECOND / 48000;
+    config->backup_storage.type = backup;
+
+    event.header.kind = MESSAGE_RESET;
+    event.header.size = sizeof(event);
+    channel_push(&gba->channels.messages, &event.header);
+    gba_process_all_messages(gba);
+    gba_delete_all_notifications(gba);
+
+    free(rom);
+}
+
+/*
+** Disable all the events, so the hot path measured isn't interrupted by the PPU, the APU, etc.
+*/
+static
+void
+bench_quiesce(
+    struct gba *gba
+) {
+    size_t i;
+
+    for (i = 0; i < gba->scheduler.events_size; ++i) {
+        gba->scheduler.events[i].active = false;
+    }
+    gba->scheduler.next_event = UINT64_MAX;
+}
+
+/*
+** Fill the VRAM, the palette and the OAM with a canned image and configure the PPU
+** to draw it in the given BG mode, with all the backgrounds valid in that mode,
+** 128 sprites and alpha blending.
+*/
+static
+void
+bench_load_canned_image(
+    struct gba *gba,
+    uint32_t mode
+) {
+    static uint16_t const bgs_per_mode[] = { 0xF, 0x7, 0xC, 0x4, 0x4, 0x4 };
+    uint32_t state;
+    size_t i;
+
+    state = BENCH_SEED ^ mode;
+    bench_fill(gba->memory.vram, sizeof(gba->memory.vram), &state);
+    bench_fill(gba->memory.palram, sizeof(gba->memory.palram), &state);
+
+    for (i = 0; i < 128; ++i) {
+        uint16_t attr[4];
+        bool affine;
+
+        affine = !(i % 4);
+        attr[0] = (bench_rand(&state) % GBA_SCREEN_HEIGHT) | (affine << 8) | ((bench_rand(&state) & 1) << 13) | ((bench_rand(&state) % 3) << 14);
+        attr[1] = (bench_rand(&state) % GBA_SCREEN_WIDTH) | ((bench_rand(&state) & 3) << 14);
+        attr[1] |= affine ? ((i / 4) << 9) : ((bench_rand(&state) & 3) << 12);
+        attr[2] = (bench_rand(&state) & 0x3FF) | ((bench_rand(&state) & 3) << 10) | ((bench_rand(&state) & 0xF) << 12);
+
+        // The fourth attribute of each group of 4 sprites is one of the affine matrices.
+        switch (i % 4) {
+            case 0: attr[3] = 0x100 + (bench_rand(&state) & 0x3F); break;      // PA
+            case 1: attr[3] = (bench_rand(&state) & 0x3F) - 0x20; break;        // PB
+            case 2: attr[3] = (bench_rand(&state) & 0x3F) - 0x20; break;        // PC
+            case 3: attr[3] = 0x100 + (bench_rand(&state) & 0x3F); break;      // PD
+        }
+
+        memcpy(gba->memory.oam + i * sizeof(attr), attr, sizeof(attr));
+    }
+
+    // BGxCNT: the char blocks are shared, each background has its own screen block.
+    for (i = 0; i < 4; ++i) {
+        mem_write16(gba, IO_REG_BG0CNT + i * 2, i | ((i == 1) << 7) | ((28 + i) << 8) | ((i >= 2) << 13), NON_SEQUENTIAL);
+    }
+
+    mem_write16(gba, IO_REG_BG2PA, 0x100, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_BG2PA + 2, 0x20, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_BG2PA + 4, -0x20, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_BG2PD, 0x100, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_BG3PA, 0xF0, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_BG3PD, 0x110, NON_SEQUENTIAL);
+
+    mem_write16(gba, IO_REG_BLDCNT, 0x3E41, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_BLDALPHA, 0x0808, NON_SEQUENTIAL);
+
+    // DISPCNT: the mode, 1D sprite mapping, the backgrounds and the sprites.
+    mem_write16(gba, IO_REG_DISPCNT, mode | (1 << 6) | (bgs_per_mode[mode] << 8) | (1 << 12), NON_SEQUENTIAL);
+
+    ppu_reload_affine_internal_registers(gba, 0);
+    ppu_reload_affine_internal_registers(gba, 1);
+}
+
+/*
+** core/: the dispatch loops of the interpreter.
+**
+** The parameter is the address of the program, with `BENCH_THUMB` set for the Thumb one.
+** One operation is one instruction.
+*/
+static
+void
+bench_core_setup(
+    struct gba *gba,
+    uint32_t param
+) {
+    struct core *core;
+    uint32_t addr;
+    bool thumb;
+
+    bench_reset(gba, BACKUP_SRAM);
+    bench_quiesce(gba);
+
+    thumb = param & BENCH_THUMB;
+    addr = param & ~BENCH_THUMB;
+
+    if ((addr >> 24) == IWRAM_REGION) {
+        if (thumb) {
+            memcpy(gba->memory.iwram + (addr & IWRAM_MASK), bench_thumb_program, sizeof(bench_thumb_program));
+        } else {
+            memcpy(gba->memory.iwram + (addr & IWRAM_MASK), bench_arm_program, sizeof(bench_arm_program));
+        }
+    }
+
+    core = &gba->core;
+    core->r4 = BENCH_DATA_ADDR;
+    core->pc = addr;
+    core->cpsr.thumb = thumb;
+    core_reload_pipeline(gba);
+}
+
+static
+void
+bench_core_run(
+    struct gba *gba,
+    uint32_t param __unused,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        core_next(gba);
+    }
+}
+
+/*
+** mem/: the memory accesses of the CPU, per region.
+**
+** The parameter is the first address accessed. One operation is one access, and the accesses
+** cycle through the first kilobyte of the region (16 bytes for the IO registers).
+*/
+static inline
+uint32_t
+bench_mem_addr(
+    uint32_t param,
+    uint64_t i,
+    uint32_t size
+) {
+    uint32_t mask;
+
+    mask = ((param >> 24) == IO_REGION) ? 0xF : 0x3FF;
+    return (param + ((i * size) & mask));
+}
+
+static
+void
+bench_mem_setup(
+    struct gba *gba,
+    uint32_t param __unused
+) {
+    bench_reset(gba, BACKUP_SRAM);
+    bench_quiesce(gba);
+}
+
+static
+void
+bench_mem_read8(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        bench_sink = mem_read8(gba, bench_mem_addr(param, i, 1), i ? SEQUENTIAL : NON_SEQUENTIAL);
+    }
+}
+
+static
+void
+bench_mem_read16(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        bench_sink = mem_read16(gba, bench_mem_addr(param, i, 2), i ? SEQUENTIAL : NON_SEQUENTIAL);
+    }
+}
+
+static
+void
+bench_mem_read32(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        bench_sink = mem_read32(gba, bench_mem_addr(param, i, 4), i ? SEQUENTIAL : NON_SEQUENTIAL);
+    }
+}
+
+static
+void
+bench_mem_write8(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        mem_write8(gba, bench_mem_addr(param, i, 1), i, i ? SEQUENTIAL : NON_SEQUENTIAL);
+    }
+}
+
+static
+void
+bench_mem_write16(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        mem_write16(gba, bench_mem_addr(param, i, 2), i, i ? SEQUENTIAL : NON_SEQUENTIAL);
+    }
+}
+
+static
+void
+bench_mem_write32(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        mem_write32(gba, bench_mem_addr(param, i, 4), i, i ? SEQUENTIAL : NON_SEQUENTIAL);
+    }
+}
+
+/*
+** sched/: the scheduler, with the events of a game displaying a frame and playing sound.
+**
+** The display is blanked so the cost of the rendering doesn't hide the one of the scheduler.
+** The parameter is the amount of additional events that never fire, to see how the
+** scheduler scales with the size of its event list.
+** One operation is one call to `sched_process_events()` at the time of the next event.
+*/
+static
+void
+bench_sched_setup(
+    struct gba *gba,
+    uint32_t param
+) {
+    uint32_t i;
+
+    bench_reset(gba, BACKUP_SRAM);
+
+    // Forced blank
+    mem_write16(gba, IO_REG_DISPCNT, 1 << 7, NON_SEQUENTIAL);
+
+    // Sound: master enable, the two tone channels on both sides, and a sweep
+    mem_write16(gba, IO_REG_SOUNDCNT_X, 1 << 7, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUNDCNT_L, 0x3377, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUNDCNT_H, 0x0002, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUND1CNT_L, 0x0027, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUND1CNT_H, 0xF780, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUND1CNT_X, 0x8400, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUND2CNT_L, 0xF7C0, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUND2CNT_H, 0x8600, NON_SEQUENTIAL);
+
+    // Timers: the one of a 16KHz Direct Sound channel and a slow one, used to measure time
+    mem_write16(gba, IO_REG_TM0CNT_LO, 0xFBE8, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_TM0CNT_HI, 0x0080, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_TM1CNT_LO, 0x0000, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_TM1CNT_HI, 0x0083, NON_SEQUENTIAL);
+
+    for (i = 0; i < param; ++i) {
+        sched_add_event(
+            gba,
+            NEW_FIX_EVENT_ARGS(
+                SCHED_EVENT_TIMER_STOP,
+                UINT64_MAX / 2,
+                EVENT_ARG(u32, 3)
+            )
+        );
+    }
+}
+
+static
+void
+bench_sched_run(
+    struct gba *gba,
+    uint32_t param __unused,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        gba->scheduler.cycles = gba->scheduler.next_event;
+        sched_process_events(gba);
+        gba->shared_data.audio_rbuffer.size = 0;
+    }
+}
+
+/*
+** ppu/: the rendering of a scanline, per BG mode, with a canned image.
+**
+** The parameter is the BG mode. One operation is one scanline.
+*/
+static
+void
+bench_ppu_setup(
+    struct gba *gba,
+    uint32_t param
+) {
+    bench_reset(gba, BACKUP_SRAM);
+    bench_quiesce(gba);
+    bench_load_canned_image(gba, param);
+}
+
+static
+void
+bench_ppu_run(
+    struct gba *gba,
+    uint32_t param __unused,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        gba->io.vcount.raw = i % GBA_SCREEN_HEIGHT;
+        if (!gba->io.vcount.raw) {
+            ppu_reload_affine_internal_registers(gba, 0);
+            ppu_reload_affine_internal_registers(gba, 1);
+        }
+        ppu_hblank(gba, (struct event_args){{ 0 }});
+    }
+}
+
+/*
+** dma/: a DMA transfer on channel 3.
+**
+** The parameter is the amount of units transferred, along with `BENCH_DMA_32` for 32-bit
+** transfers and `BENCH_DMA_ROM` to copy from the ROM instead of the EWRAM. The destination
+** is the VRAM, or the EWRAM for the copies from the ROM.
+** One operation is one whole transfer.
+*/
+static
+void
+bench_dma_setup(
+    struct gba *gba,
+    uint32_t param
+) {
+    bool rom;
+
+    bench_reset(gba, BACKUP_SRAM);
+    bench_quiesce(gba);
+
+    rom = param & BENCH_DMA_ROM;
+    mem_write32(gba, IO_REG_DMA3SAD, rom ? CART_0_START : EWRAM_START, NON_SEQUENTIAL);
+    mem_write32(gba, IO_REG_DMA3DAD, rom ? EWRAM_START : VRAM_START, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_DMA3CNT, param & 0xFFFF, NON_SEQUENTIAL);
+
+    // Enabled, timed on HBlank so it doesn't start by itself.
+    mem_write16(gba, IO_REG_DMA3CTL, (1 << 15) | (DMA_TIMING_HBLANK << 12) | (!!(param & BENCH_DMA_32) << 10), NON_SEQUENTIAL);
+}
+
+static
+void
+bench_dma_run(
+    struct gba *gba,
+    uint32_t param,
+    uint64_t ops
+) {
+    struct dma_channel *channel;
+    uint64_t i;
+
+    channel = &gba->io.dma[3];
+    for (i = 0; i < ops; ++i) {
+        channel->internal_src = channel->src.raw;
+        channel->internal_dst = channel->dst.raw;
+        channel->internal_count = param & 0xFFFF;
+        gba->core.pending_dma |= 1 << 3;
+        mem_dma_do_all_pending_transfers(gba);
+    }
+}
+
+/*
+** dma/eeprom/write: a write request sent to a 64K EEPROM on channel 3, one bit per half-word.
+**
+** The parameter is the amount of bits of the request. One operation is one whole request.
+*/
+static
+void
+bench_dma_eeprom_setup(
+    struct gba *gba,
+    uint32_t param
+) {
+    uint32_t state;
+    uint32_t i;
+
+    bench_reset(gba, BACKUP_EEPROM_64K);
+    bench_quiesce(gba);
+
+    // Start bit, write command, address, data and stop bit, garbage in the unused bits.
+    state = BENCH_SEED;
+    for (i = 0; i < param; ++i) {
+        uint16_t unit;
+
+        unit = bench_rand(&state) & 0xFFFE;
+        if (i == 0) {
+            unit |= 1;
+        } else if (i > 1 && i < param - 1) {
+            unit |= bench_rand(&state) & 1;
+        }
+        memcpy(gba->memory.ewram + i * sizeof(unit), &unit, sizeof(unit));
+    }
+
+    mem_write32(gba, IO_REG_DMA3SAD, EWRAM_START, NON_SEQUENTIAL);
+    mem_write32(gba, IO_REG_DMA3DAD, 0x0D000000, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_DMA3CNT, param, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_DMA3CTL, (1 << 15) | (DMA_TIMING_HBLANK << 12), NON_SEQUENTIAL);
+}
+
+/*
+** apu/resample: the mix of all the channels into one sample.
+**
+** One operation is one sample. The audio buffer is emptied after each sample, like a
+** frontend would.
+*/
+static
+void
+bench_apu_setup(
+    struct gba *gba,
+    uint32_t param __unused
+) {
+    bench_reset(gba, BACKUP_SRAM);
+    bench_quiesce(gba);
+
+    mem_write16(gba, IO_REG_SOUNDCNT_X, 1 << 7, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUNDCNT_L, 0xFF77, NON_SEQUENTIAL);
+    mem_write16(gba, IO_REG_SOUNDCNT_H, 0x330E, NON_SEQUENTIAL);
+
+    gba->apu.latch.channel_1 = 0x40;
+    gba->apu.latch.channel_2 = -0x60;
+    gba->apu.latch.channel_3 = 0x20;
+    gba->apu.latch.channel_4 = -0x10;
+    gba->apu.latch.fifo[FIFO_A] = 0x55;
+    gba->apu.latch.fifo[FIFO_B] = -0x33;
+}
+
+static
+void
+bench_apu_run(
+    struct gba *gba,
+    uint32_t param __unused,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        apu_resample(gba, (struct event_args){{ 0 }});
+        gba->shared_data.audio_rbuffer.size = 0;
+    }
+}
+
+/*
+** quicksave, quickload: the save states, of an emulator displaying the canned image of mode 0.
+**
+** One operation is one save state written or loaded.
+*/
+static
+void
+bench_quicksave_setup(
+    struct gba *gba,
+    uint32_t param __unused
+) {
+    bench_reset(gba, BACKUP_SRAM);
+    bench_load_canned_image(gba, 0);
+}
+
+static
+void
+bench_quicksave_run(
+    struct gba *gba,
+    uint32_t param __unused,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        uint8_t *data;
+        size_t size;
+
+        quicksave(gba, &data, &size);
+        free(data);
+    }
+}
+
+static
+void
+bench_quickload_setup(
+    struct gba *gba,
+    uint32_t param __unused
+) {
+    bench_quicksave_setup(gba, 0);
+
+    free(bench_qsave_data);
+    quicksave(gba, &bench_qsave_data, &bench_qsave_size);
+}
+
+static
+void
+bench_quickload_run(
+    struct gba *gba,
+    uint32_t param __unused,
+    uint64_t ops
+) {
+    uint64_t i;
+
+    for (i = 0; i < ops; ++i) {
+        hs_assert(!quickload(gba, bench_qsave_data, bench_qsave_size));
+    }
+}
+
+#define BENCH_MEM_READ(_region, _addr)                                                      \
+    { "mem/read8/" _region,         bench_mem_setup,        bench_mem_read8,    (_addr) },  \
+    { "mem/read16/" _region,        bench_mem_setup,        bench_mem_read16,   (_addr) },  \
+    { "mem/read32/" _region,        bench_mem_setup,        bench_mem_read32,   (_addr) }
+
+#define BENCH_MEM_WRITE(_region, _addr)                                                     \
+    { "mem/write8/" _region,        bench_mem_setup,        bench_mem_write8,   (_addr) },  \
+    { "mem/write16/" _region,       bench_mem_setup,        bench_mem_write16,  (_addr) },  \
+    { "mem/write32/" _region,       bench_mem_setup,        bench_mem_write32,  (_addr) }
+
+struct bench const benches[] = {
+    { "core/arm/iwram",             bench_core_setup,       bench_core_run,     IWRAM_START },
+    { "core/arm/rom",               bench_core_setup,       bench_core_run,     CART_0_START + BENCH_ARM_OFFSET },
+    { "core/thumb/iwram",           bench_core_setup,       bench_core_run,     IWRAM_START | BENCH_THUMB },
+    { "core/thumb/rom",             bench_core_setup,       bench_core_run,     (CART_0_START + BENCH_THUMB_OFFSET) | BENCH_THUMB },
+
+    BENCH_MEM_READ("ewram",         EWRAM_START),
+    BENCH_MEM_READ("iwram",         IWRAM_START),
+    BENCH_MEM_READ("io",            IO_REG_BG0HOFS),
+    BENCH_MEM_READ("palram",        PALRAM_START),
+    BENCH_MEM_READ("vram",          VRAM_START),
+    BENCH_MEM_READ("oam",           OAM_START),
+    BENCH_MEM_READ("rom",           CART_0_START),
+    { "mem/read8/sram",             bench_mem_setup,        bench_mem_read8,    SRAM_START },
+
+    BENCH_MEM_WRITE("ewram",        EWRAM_START),
+    BENCH_MEM_WRITE("iwram",        IWRAM_START),
+    BENCH_MEM_WRITE("io",           IO_REG_BG0HOFS),
+    BENCH_MEM_WRITE("palram",       PALRAM_START),
+    BENCH_MEM_WRITE("vram",         VRAM_START),
+    BENCH_MEM_WRITE("oam",          OAM_START),
+    { "mem/write8/sram",            bench_mem_setup,        bench_mem_write8,   SRAM_START },
+
+    { "sched/mix",                  bench_sched_setup,      bench_sched_run,    0 },
+    { "sched/mix+32",               bench_sched_setup,      bench_sched_run,    32 },
+
+    { "ppu/mode0",                  bench_ppu_setup,        bench_ppu_run,      0 },
+    { "ppu/mode1",                  bench_ppu_setup,        bench_ppu_run,      1 },
+    { "ppu/mode2",                  bench_ppu_setup,        bench_ppu_run,      2 },
+    { "ppu/mode3",                  bench_ppu_setup,        bench_ppu_run,      3 },
+    { "ppu/mode4",                  bench_ppu_setup,        bench_ppu_run,      4 },
+    { "ppu/mode5",                  bench_ppu_setup,        bench_ppu_run,      5 },
+
+    { "dma/16bit/16",               bench_dma_setup,        bench_dma_run,      16 },
+    { "dma/16bit/256",              bench_dma_setup,        bench_dma_run,      256 },
+    { "dma/16bit/4096",             bench_dma_setup,        bench_dma_run,      4096 },
+    { "dma/32bit/16",               bench_dma_setup,        bench_dma_run,      16 | BENCH_DMA_32 },
+    { "dma/32bit/256",              bench_dma_setup,        bench_dma_run,      256 | BENCH_DMA_32 },
+    { "dma/32bit/4096",             bench_dma_setup,        bench_dma_run,      4096 | BENCH_DMA_32 },
+    { "dma/32bit/4096/rom",         bench_dma_setup,        bench_dma_run,      4096 | BENCH_DMA_32 | BENCH_DMA_ROM },
+    { "dma/eeprom/write",           bench_dma_eeprom_setup, bench_dma_run,      2 + EEPROM_64K_ADDR_LEN + 64 + 1 },
+
+    { "apu/resample",               bench_apu_setup,        bench_apu_run,      0 },
+
+    { "quicksave",                  bench_quicksave_setup,  bench_quicksave_run, 0 },
+    { "quickload",                  bench_quickload_setup,  bench_quickload_run, 0 },
+};
+
+size_t const benches_len = array_length(benches);
@@ -0,0 +1,235 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** The micro-benchmarks runner.
+**
+** Each benchmark is first calibrated: the amount of operations of a repetition is
+** scaled so it lasts about the target duration. A few repetitions are then run to
+** warm up the caches and the branch predictors, before the measured ones.
+**
+** The results are in nanoseconds per operation.
+*/
+
+#include <inttypes.h>
+#include <math.h>
+#include "hades.h"
+#include "microbench/microbench.h"
+#include "gba/gba.h"
+#include "compat.h"
+
+struct bench_result {
+    uint64_t ops;
+    double min;
+    double median;
+    double mean;
+    double stddev;
+};
+
+static
+bool
+microbench_match(
+    struct microbench const *microbench,
+    struct bench const *bench
+) {
+    size_t i;
+
+    if (!microbench->args.filters_len) {
+        return (true);
+    }
+
+    for (i = 0; i < microbench->args.filters_len; ++i) {
+        if (strstr(bench->name, microbench->args.filters[i])) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+static
+int
+microbench_cmp_double(
+    void const *lhs,
+    void const *rhs
+) {
+    double a;
+    double b;
+
+    a = *(double const *)lhs;
+    b = *(double const *)rhs;
+    return ((a > b) - (a < b));
+}
+
+/*
+** Run one repetition of the given benchmark and return its duration, in nanoseconds.
+*/
+static
+uint64_t
+microbench_run_rep(
+    struct microbench *microbench,
+    struct bench const *bench,
+    uint64_t ops
+) {
+    uint64_t start;
+
+    start = hs_time_ns();
+    bench->run(microbench->gba, bench->param, ops);
+    return (hs_time_ns() - start);
+}
+
+/*
+** Find the amount of operations a repetition of the given benchmark must do to last
+** about the target duration.
+*/
+static
+uint64_t
+microbench_calibrate(
+    struct microbench *microbench,
+    struct bench const *bench
+) {
+    uint64_t target;
+    uint64_t ops;
+    uint64_t elapsed;
+
+    target = microbench->args.time_ms * 1000000;
+    ops = 1;
+
+    while (true) {
+        elapsed = microbench_run_rep(microbench, bench, ops);
+        if (elapsed >= target / 16 || ops >= UINT64_MAX / 2) {
+            break;
+        }
+        ops *= 2;
+    }
+
+    return (max((uint64_t)((double)ops * target / max(elapsed, 1ull)), 1ull));
+}
+
+static
+void
+microbench_run(
+    struct microbench *microbench,
+    struct bench const *bench,
+    struct bench_result *result
+) {
+    double *samples;
+    uint64_t i;
+
+    samples = calloc(microbench->args.reps, sizeof(*samples));
+    hs_assert(samples);
+
+    bench->setup(microbench->gba, bench->param);
+
+    result->ops = microbench_calibrate(microbench, bench);
+
+    for (i = 0; i < microbench->args.warmup; ++i) {
+        microbench_run_rep(microbench, bench, result->ops);
+    }
+
+    result->mean = 0.;
+    for (i = 0; i < microbench->args.reps; ++i) {
+        samples[i] = (double)microbench_run_rep(microbench, bench, result->ops) / result->ops;
+        result->mean += samples[i];
+    }
+    result->mean /= microbench->args.reps;
+
+    result->stddev = 0.;
+    for (i = 0; i < microbench->args.reps; ++i) {
+        result->stddev += (samples[i] - result->mean) * (samples[i] - result->mean);
+    }
+    result->stddev = sqrt(result->stddev / microbench->args.reps);
+
+    qsort(samples, microbench->args.reps, sizeof(*samples), microbench_cmp_double);
+    result->min = samples[0];
+    if (microbench->args.reps % 2) {
+        result->median = samples[microbench->args.reps / 2];
+    } else {
+        result->median = (samples[microbench->args.reps / 2 - 1] + samples[microbench->args.reps / 2]) / 2.;
+    }
+
+    free(samples);
+}
+
+int
+main(
+    int argc,
+    char *argv[]
+) {
+    struct microbench microbench;
+    size_t i;
+
+    memset(&microbench, 0, sizeof(microbench));
+
+    microbench.args.warmup = 3;
+    microbench.args.reps = 10;
+    microbench.args.time_ms = 50;
+
+    microbench_args_parse(&microbench, argc, argv);
+
+    if (microbench.args.list) {
+        for (i = 0; i < benches_len; ++i) {
+            if (microbench_match(&microbench, benches + i)) {
+                printf("%s\n", benches[i].name);
+            }
+        }
+        return (EXIT_SUCCESS);
+    }
+
+    // The resets of the benchmarks would flood the output.
+    g_verbose[HS_INFO] = false;
+    g_verbose[HS_WARNING] = false;
+
+    microbench.gba = gba_create();
+
+    if (microbench.args.csv) {
+        printf("name,ops,min_ns,median_ns,mean_ns,stddev_ns\n");
+    } else {
+        printf("%-24s %12s %12s %12s %12s %12s\n", "Name", "Ops/rep", "Min ns/op", "Median", "Mean", "Stddev");
+    }
+
+    for (i = 0; i < benches_len; ++i) {
+        struct bench_result result;
+        struct bench const *bench;
+
+        bench = benches + i;
+        if (!microbench_match(&microbench, bench)) {
+            continue;
+        }
+
+        microbench_run(&microbench, bench, &result);
+
+        if (microbench.args.csv) {
+            printf(
+                "%s,%" PRIu64 ",%.3f,%.3f,%.3f,%.3f\n",
+                bench->name,
+                result.ops,
+                result.min,
+                result.median,
+                result.mean,
+                result.stddev
+            );
+        } else {
+            printf(
+                "%s%-24s%s %12" PRIu64 " %12.2f %12.2f %12.2f %11.1f%%\n",
+                g_bold,
+                bench->name,
+                g_reset,
+                result.ops,
+                result.min,
+                result.median,
+                result.mean,
+                result.mean ? 100. * result.stddev / result.mean : 0.
+            );
+        }
+        fflush(stdout);
+    }
+
+    gba_delete(microbench.gba);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,167 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** Tests of the channels between the emulator and its frontends.
+**
+** A failure prints the failed check and exits with a non-zero status. A producer that
+** blocks forever shows up as a timeout of the test.
+*/
+
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+#include "gba/channel.h"
+#include "gba/event.h"
+
+#define check(expr)                                                                 \
+    do {                                                                            \
+        if (!(expr)) {                                                              \
+            fprintf(stderr, "%s:%i: check failed: %s\n", __FILE__, __LINE__, #expr); \
+            exit(EXIT_FAILURE);                                                     \
+        }                                                                           \
+    } while (0)
+
+// Not exported, the notifications are sent by the emulator itself.
+void gba_send_notification(struct gba *gba, enum notification_kind kind);
+
+struct test_event {
+    struct event_header header;
+    uint32_t value;
+};
+
+/*
+** Delete all the notifications of the given channel, like the frontends do.
+*/
+static
+size_t
+drain(
+    struct channel *channel
+) {
+    struct event_header const *event;
+    size_t count;
+
+    count = 0;
+    channel_lock(channel);
+
+    event = channel_peek(channel);
+    while (event) {
+        gba_delete_notification((struct notification const *)event);
+        channel_pop(channel);
+        event = channel_peek(channel);
+        ++count;
+    }
+
+    channel_release(channel);
+    return (count);
+}
+
+/*
+** Fill a channel with no consumer: `channel_try_push()` must drop the events that don't fit
+** instead of waiting, and the channel must work again once it is drained.
+*/
+static
+void
+test_try_push_full(
+    void
+) {
+    struct channel *channel;
+    struct test_event event;
+    struct test_event const *peeked;
+    size_t dropped;
+    uint32_t i;
+
+    channel = calloc(1, sizeof(*channel));
+    hs_assert(channel);
+    channel_init(channel);
+
+    event.header.kind = 0;
+    event.header.size = sizeof(event);
+
+    dropped = 0;
+    for (i = 0; i < 2 * CHANNEL_SLOTS; ++i) {
+        event.value = i;
+        dropped += channel_try_push(channel, &event.header);
+    }
+
+    check(dropped == CHANNEL_SLOTS);
+    check(channel_pending(channel) == CHANNEL_SLOTS);
+
+    // The oldest events are kept, the newest ones are dropped.
+    channel_lock(channel);
+    peeked = (struct test_event const *)channel_peek(channel);
+    check(peeked && peeked->value == 0);
+    channel_pop(channel);
+    channel_release(channel);
+
+    event.value = 0xCAFE;
+    check(!channel_try_push(channel, &event.header));
+    check(channel_pending(channel) == CHANNEL_SLOTS);
+
+    channel_lock(channel);
+    for (i = 1; i < CHANNEL_SLOTS; ++i) {
+        peeked = (struct test_event const *)channel_peek(channel);
+        check(peeked && peeked->value == i);
+        channel_pop(channel);
+    }
+    peeked = (struct test_event const *)channel_peek(channel);
+    check(peeked && peeked->value == 0xCAFE);
+    channel_pop(channel);
+    check(!channel_peek(channel));
+    channel_release(channel);
+
+    check(channel_pending(channel) == 0);
+    free(channel);
+}
+
+/*
+** Send many more notifications than a channel can hold while only the notifications
+** channel is drained, like hades-headless does.
+**
+** With the debugger, each notification is also sent to the debug channel, which nobody
+** drains here: the emulator must not wait for it.
+*/
+static
+void
+test_notifications_without_debugger(
+    void
+) {
+    struct gba *gba;
+    size_t received;
+    size_t i;
+
+    gba = gba_create();
+
+    received = 0;
+    for (i = 0; i < 4 * CHANNEL_SLOTS; ++i) {
+        gba_send_notification(gba, (i % 2) ? NOTIFICATION_PAUSE : NOTIFICATION_RUN);
+        received += drain(&gba->channels.notifications);
+    }
+
+    check(received == 4 * CHANNEL_SLOTS);
+
+#ifdef WITH_DEBUGGER
+    check(channel_pending(&gba->channels.debug) == CHANNEL_SLOTS);
+    check(drain(&gba->channels.debug) == CHANNEL_SLOTS);
+#endif
+
+    gba_delete(gba);
+}
+
+int
+main(
+    int argc __unused,
+    char *argv[] __unused
+) {
+    test_try_push_full();
+    test_notifications_without_debugger();
+
+    printf("All the channel tests passed.\n");
+    return (EXIT_SUCCESS);
+}
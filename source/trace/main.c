@@ -0,0 +1,377 @@
+/******************************************************************************\
+**
+**  This file is part of the Hades GBA Emulator, and is made available under
+**  the terms of the GNU General Public License version 2.
+**
+**  Copyright (C) 2021-2024 - The Hades Authors
+**
+\******************************************************************************/
+
+/*
+** Read, filter and disassemble the binary traces written by the debugger's `trace` command.
+**
+** Traces are usually made of a few hot loops, so the disassembly of each address is cached
+** and capstone is only called once per (address, op-code) pair.
+*/
+
+#include <archive.h>
+#include <archive_entry.h>
+#include <capstone/capstone.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include "hades.h"
+#include "gba/gba.h"
+
+#define DISAS_CACHE_LEN     (1 << 16)
+
+struct disas_entry {
+    uint32_t pc;
+    uint32_t opcode;
+    bool thumb;
+    bool valid;
+    char text[48];
+};
+
+struct trace_reader {
+    struct {
+        char const *path;
+        uint32_t pc_start;
+        uint32_t pc_end;
+        uint64_t limit;
+        bool regs;
+        bool mem;
+    } args;
+
+    struct archive *archive;
+    csh handle_arm;
+    csh handle_thumb;
+
+    struct disas_entry *cache;
+
+    // The memory accesses of the next instruction, which can be many if it triggers a DMA.
+    struct trace_record *mem;
+    size_t mem_len;
+    size_t mem_size;
+};
+
+static
+void
+print_usage(
+    FILE *file,
+    char const *name
+) {
+    fprintf(
+        file,
+        "Usage: %s [OPTION]... TRACE\n"
+        "\n"
+        "Options:\n"
+        "    -p, --pc=START[:END]               Only print the instructions whose address is within [START, END]\n"
+        "    -n, --limit=N                      Stop after printing N instructions\n"
+        "    -r, --regs                         Print the registers changed by each instruction\n"
+        "    -m, --mem                          Print the memory accesses of each instruction (if they were traced)\n"
+        "\n"
+        "    -h, --help                         Print this help and exit\n"
+        "    -v, --version                      Print the version information and exit\n"
+        "",
+        name
+    );
+}
+
+static
+void
+trace_args_parse(
+    struct trace_reader *reader,
+    int argc,
+    char * const argv[]
+) {
+    char const *name;
+
+    name = argv[0];
+    while (true) {
+        char *end;
+        int c;
+
+        static struct option long_options[] = {
+            { "pc",         required_argument,  0,  'p' },
+            { "limit",      required_argument,  0,  'n' },
+            { "regs",       no_argument,        0,  'r' },
+            { "mem",        no_argument,        0,  'm' },
+            { "help",       no_argument,        0,  'h' },
+            { "version",    no_argument,        0,  'v' },
+            { 0,            0,                  0,  0 }
+        };
+
+        c = getopt_long(argc, argv, "p:n:rmhv", long_options, NULL);
+
+        if (c == -1) {
+            break;
+        }
+
+        switch (c) {
+            case 'p': {
+                reader->args.pc_start = strtoul(optarg, &end, 0);
+                reader->args.pc_end = *end == ':' ? strtoul(end + 1, NULL, 0) : reader->args.pc_start;
+                break;
+            };
+            case 'n': {
+                reader->args.limit = strtoull(optarg, NULL, 0);
+                break;
+            };
+            case 'r': {
+                reader->args.regs = true;
+                break;
+            };
+            case 'm': {
+                reader->args.mem = true;
+                break;
+            };
+            case 'h': {
+                print_usage(stdout, name);
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            case 'v': {
+                printf("Hades v" HADES_VERSION "\n");
+                exit(EXIT_SUCCESS);
+                break;
+            };
+            default: {
+                print_usage(stderr, name);
+                exit(EXIT_FAILURE);
+                break;
+            };
+        }
+    }
+
+    if (argc - optind != 1) {
+        print_usage(stderr, name);
+        exit(EXIT_FAILURE);
+    }
+
+    reader->args.path = argv[optind];
+}
+
+/*
+** Read exactly `size` bytes of the trace.
+** Return true if the end of the trace was reached first.
+*/
+static
+bool
+trace_read(
+    struct trace_reader *reader,
+    void *data,
+    size_t size
+) {
+    size_t len;
+
+    len = 0;
+    while (len < size) {
+        ssize_t read_len;
+
+        read_len = archive_read_data(reader->archive, (uint8_t *)data + len, size - len);
+        if (read_len < 0) {
+            fprintf(stderr, "Failed to read %s: %s.\n", reader->args.path, archive_error_string(reader->archive));
+            exit(EXIT_FAILURE);
+        } else if (read_len == 0) {
+            return (true);
+        }
+        len += read_len;
+    }
+    return (false);
+}
+
+/*
+** Return the disassembly of the given instruction, from the cache if possible.
+*/
+static
+char const *
+trace_disas(
+    struct trace_reader *reader,
+    uint32_t pc,
+    uint32_t opcode,
+    bool thumb
+) {
+    struct disas_entry *entry;
+    uint8_t bytes[4];
+    cs_insn *insn;
+
+    entry = &reader->cache[(pc >> 1) % DISAS_CACHE_LEN];
+
+    // The op-code is part of the key in case the code at that address was rewritten.
+    if (entry->valid && entry->pc == pc && entry->opcode == opcode && entry->thumb == thumb) {
+        return (entry->text);
+    }
+
+    bytes[0] = opcode;
+    bytes[1] = opcode >> 8;
+    bytes[2] = opcode >> 16;
+    bytes[3] = opcode >> 24;
+
+    entry->pc = pc;
+    entry->opcode = opcode;
+    entry->thumb = thumb;
+    entry->valid = true;
+
+    if (cs_disasm(thumb ? reader->handle_thumb : reader->handle_arm, bytes, thumb ? 2 : 4, pc, 1, &insn) == 1) {
+        snprintf(entry->text, sizeof(entry->text), "%s %s", insn->mnemonic, insn->op_str);
+        cs_free(insn, 1);
+    } else {
+        snprintf(entry->text, sizeof(entry->text), "<unknown>");
+    }
+
+    return (entry->text);
+}
+
+static
+void
+trace_print_insn(
+    struct trace_reader *reader,
+    struct trace_record const *insn,
+    uint32_t const *regs
+) {
+    bool thumb;
+    size_t len;
+    size_t i;
+
+    thumb = bitfield_get(insn->insn.cpsr, 5);
+
+    printf(
+        "%12" PRIu64 "  %08x  %0*x%*s  %-40s",
+        insn->insn.cycles,
+        insn->insn.pc,
+        thumb ? 4 : 8,
+        insn->insn.opcode,
+        thumb ? 4 : 0,
+        "",
+        trace_disas(reader, insn->insn.pc, insn->insn.opcode, thumb)
+    );
+
+    if (reader->args.regs) {
+        len = 0;
+        for (i = 0; i < 15; ++i) {
+            if (insn->insn.changed & (1 << i)) {
+                printf(" r%zu=%08x", i, regs[len++]);
+            }
+        }
+    }
+
+    printf("\n");
+
+    if (reader->args.mem) {
+        for (i = 0; i < reader->mem_len; ++i) {
+            struct trace_record const *mem;
+
+            mem = &reader->mem[i];
+            printf(
+                "%*s%s%u %08x %s %0*x\n",
+                36,
+                "",
+                mem->mem.write ? "W" : "R",
+                mem->mem.size * 8,
+                mem->mem.addr,
+                mem->mem.write ? "<-" : "->",
+                mem->mem.size * 2,
+                mem->mem.val
+            );
+        }
+    }
+}
+
+int
+main(
+    int argc,
+    char *argv[]
+) {
+    struct trace_reader reader;
+    struct archive_entry *entry;
+    char magic[sizeof(TRACE_FILE_MAGIC) - 1];
+    uint64_t printed;
+
+    memset(&reader, 0, sizeof(reader));
+    reader.args.pc_end = UINT32_MAX;
+    trace_args_parse(&reader, argc, argv);
+
+    reader.cache = calloc(DISAS_CACHE_LEN, sizeof(struct disas_entry));
+    hs_assert(reader.cache);
+
+    if (cs_open(CS_ARCH_ARM, CS_MODE_ARM | CS_MODE_LITTLE_ENDIAN, &reader.handle_arm) != CS_ERR_OK
+        || cs_open(CS_ARCH_ARM, CS_MODE_THUMB | CS_MODE_LITTLE_ENDIAN, &reader.handle_thumb) != CS_ERR_OK
+    ) {
+        fprintf(stderr, "Failed to open capstone.\n");
+        return (EXIT_FAILURE);
+    }
+
+    reader.archive = archive_read_new();
+    hs_assert(reader.archive);
+
+    archive_read_support_filter_all(reader.archive);
+    archive_read_support_format_raw(reader.archive);
+
+    if (
+           archive_read_open_filename(reader.archive, reader.args.path, 1024 * 1024) != ARCHIVE_OK // 1MiB
+        || archive_read_next_header(reader.archive, &entry) != ARCHIVE_OK
+    ) {
+        fprintf(stderr, "Failed to open %s: %s.\n", reader.args.path, archive_error_string(reader.archive));
+        return (EXIT_FAILURE);
+    }
+
+    if (trace_read(&reader, magic, sizeof(magic)) || memcmp(magic, TRACE_FILE_MAGIC, sizeof(magic))) {
+        fprintf(stderr, "%s isn't a trace written by this version of Hades.\n", reader.args.path);
+        return (EXIT_FAILURE);
+    }
+
+    printed = 0;
+    while (!reader.args.limit || printed < reader.args.limit) {
+        struct trace_record record;
+        uint32_t regs[15];
+        size_t regs_len;
+        size_t i;
+
+        if (trace_read(&reader, &record, sizeof(record))) {
+            break;
+        }
+
+        if (record.kind == TRACE_RECORD_MEM) {
+            if (reader.mem_len == reader.mem_size) {
+                reader.mem_size = reader.mem_size ? reader.mem_size * 2 : 64;
+                reader.mem = realloc(reader.mem, reader.mem_size * sizeof(*reader.mem));
+                hs_assert(reader.mem);
+            }
+            reader.mem[reader.mem_len++] = record;
+            continue;
+        } else if (record.kind != TRACE_RECORD_INSN) {
+            fprintf(stderr, "%s is corrupted.\n", reader.args.path);
+            return (EXIT_FAILURE);
+        }
+
+        // Read the new values of the changed registers
+        regs_len = __builtin_popcount(record.insn.changed);
+        for (i = 0; i < regs_len; i += TRACE_RECORD_REGS_LEN) {
+            struct trace_record regs_record;
+
+            if (trace_read(&reader, &regs_record, sizeof(regs_record)) || regs_record.kind != TRACE_RECORD_REGS) {
+                fprintf(stderr, "%s is corrupted.\n", reader.args.path);
+                return (EXIT_FAILURE);
+            }
+
+            memcpy(regs + i, regs_record.regs, sizeof(uint32_t) * min(regs_len - i, TRACE_RECORD_REGS_LEN));
+        }
+
+        if (record.insn.pc >= reader.args.pc_start && record.insn.pc <= reader.args.pc_end) {
+            trace_print_insn(&reader, &record, regs);
+            ++printed;
+        }
+
+        reader.mem_len = 0;
+    }
+
+    archive_read_free(reader.archive);
+    cs_close(&reader.handle_arm);
+    cs_close(&reader.handle_thumb);
+    free(reader.cache);
+    free(reader.mem);
+
+    return (EXIT_SUCCESS);
+}